@@ -0,0 +1,523 @@
+#undef NO_LOGGING
+
+#include "goom/goom_logger.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+import Goom.Utils.DebuggingLogger;
+import Goom.Lib.FrameData;
+import Goom.Lib.GoomControl;
+import Goom.Lib.GoomGraphic;
+import Goom.Lib.GoomUtils;
+import Goom.Lib.Point2d;
+import Goom.Lib.SoundInfo;
+
+// Drives GoomControl without Kodi or an OpenGL context. A fixed number of updates are done,
+// using audio from a wav file or a synthetic signal, and the time taken by each update
+// stage is reported.
+
+namespace
+{
+
+using GOOM::AudioSamples;
+using GOOM::Dimensions;
+using GOOM::FrameData;
+using GOOM::GoomControl;
+using GOOM::GoomLogger;
+using GOOM::Pixel;
+using GOOM::Point2dFlt;
+using GOOM::SetRandSeed;
+
+constexpr auto DEFAULT_WIDTH      = 1280U;
+constexpr auto DEFAULT_HEIGHT     = 720U;
+constexpr auto DEFAULT_NUM_FRAMES = 1000U;
+constexpr auto DEFAULT_SEED       = uint64_t{1};
+constexpr auto NUM_CHANNELS       = size_t{2};
+constexpr auto FRAMES_PER_SECOND  = 25U;
+// Same as the number of pbo's the real renderer cycles through.
+constexpr auto NUM_FRAME_DATAS = 3U;
+
+struct BenchOptions
+{
+  uint32_t width          = DEFAULT_WIDTH;
+  uint32_t height         = DEFAULT_HEIGHT;
+  uint32_t numFrames      = DEFAULT_NUM_FRAMES;
+  uint64_t seed           = DEFAULT_SEED;
+  int32_t numPoolThreads  = 0;
+  bool drawFxConcurrently = false;
+  std::string wavFile;
+  std::string resourcesDirectory = GOOM_BENCH_RESOURCES_DIR;
+};
+
+auto PrintUsage() -> void
+{
+  std::cout << "Usage: goom_bench [options]\n"
+            << "  --width <pixels>     Width of the goom buffers (default "
+            << DEFAULT_WIDTH << ").\n"
+            << "  --height <pixels>    Height of the goom buffers (default "
+            << DEFAULT_HEIGHT << ").\n"
+            << "  --frames <num>       Number of updates to do (default "
+            << DEFAULT_NUM_FRAMES << ").\n"
+            << "  --seed <num>         Random seed (default " << DEFAULT_SEED << ").\n"
+            << "  --threads <num>      Max number of pool threads (default all cores).\n"
+            << "  --concurrent-fx      Draw the independent visual fx at the same time.\n"
+            << "  --wav <file>         16 bit pcm or float wav file to use as the audio.\n"
+            << "                       If not given, a synthetic signal is used.\n"
+            << "  --resources <dir>    Goom resources directory (default \""
+            << GOOM_BENCH_RESOURCES_DIR << "\").\n";
+}
+
+[[nodiscard]] auto GetBenchOptions(const std::span<char*> args) -> BenchOptions
+{
+  auto options = BenchOptions{};
+
+  for (auto i = 1U; i < args.size(); ++i)
+  {
+    const auto arg = std::string{args[i]};
+    if (arg == "--help")
+    {
+      PrintUsage();
+      std::exit(0); // NOLINT(concurrency-mt-unsafe)
+    }
+    if (arg == "--concurrent-fx")
+    {
+      options.drawFxConcurrently = true;
+      continue;
+    }
+    if ((i + 1) >= args.size())
+    {
+      throw std::runtime_error(std::format("Missing value for option \"{}\".", arg));
+    }
+    const auto value = std::string{args[++i]};
+
+    if (arg == "--width")
+    {
+      options.width = static_cast<uint32_t>(std::stoul(value));
+    }
+    else if (arg == "--height")
+    {
+      options.height = static_cast<uint32_t>(std::stoul(value));
+    }
+    else if (arg == "--frames")
+    {
+      options.numFrames = static_cast<uint32_t>(std::stoul(value));
+    }
+    else if (arg == "--seed")
+    {
+      options.seed = std::stoull(value);
+    }
+    else if (arg == "--threads")
+    {
+      options.numPoolThreads = std::stoi(value);
+    }
+    else if (arg == "--wav")
+    {
+      options.wavFile = value;
+    }
+    else if (arg == "--resources")
+    {
+      options.resourcesDirectory = value;
+    }
+    else
+    {
+      throw std::runtime_error(std::format("Unknown option \"{}\".", arg));
+    }
+  }
+
+  if ((0 == options.width) or (0 == options.height) or (0 == options.numFrames))
+  {
+    throw std::runtime_error("The width, height and number of frames must be > 0.");
+  }
+
+  return options;
+}
+
+// Supplies the stereo audio, with values in [-1, 1], for each update.
+class AudioSource
+{
+public:
+  virtual ~AudioSource() noexcept                            = default;
+  [[nodiscard]] virtual auto GetNextSamples() -> AudioSamples = 0;
+};
+
+class WavAudioSource : public AudioSource
+{
+public:
+  explicit WavAudioSource(const std::string& wavFile);
+
+  [[nodiscard]] auto GetNextSamples() -> AudioSamples override;
+
+private:
+  std::vector<float> m_stereoSamples;
+  size_t m_nextFrame          = 0U;
+  std::vector<float> m_buffer = std::vector<float>(NUM_CHANNELS * AudioSamples::AUDIO_SAMPLE_LEN);
+};
+
+template<typename T>
+[[nodiscard]] auto ReadValue(const std::span<const char> bytes, const size_t offset) -> T
+{
+  if ((offset + sizeof(T)) > bytes.size())
+  {
+    throw std::runtime_error("Truncated wav file.");
+  }
+  auto value = T{};
+  std::memcpy(&value, &bytes[offset], sizeof(T));
+  return value;
+}
+
+WavAudioSource::WavAudioSource(const std::string& wavFile)
+{
+  auto file = std::ifstream{wavFile, std::ios::binary};
+  if (not file)
+  {
+    throw std::runtime_error(std::format("Could not open wav file \"{}\".", wavFile));
+  }
+  const auto contents =
+      std::vector<char>{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+  const auto bytes = std::span<const char>{contents};
+
+  static constexpr auto RIFF_HEADER_SIZE = 12U;
+  if ((bytes.size() < RIFF_HEADER_SIZE) or (std::string{bytes.data(), 4} != "RIFF") or
+      (std::string{&bytes[8], 4} != "WAVE"))
+  {
+    throw std::runtime_error(std::format("\"{}\" is not a wav file.", wavFile));
+  }
+
+  static constexpr auto PCM_FORMAT        = uint16_t{1};
+  static constexpr auto FLOAT_FORMAT      = uint16_t{3};
+  static constexpr auto CHUNK_HEADER_SIZE = 8U;
+  auto format        = uint16_t{0};
+  auto numChannels   = uint16_t{0};
+  auto bitsPerSample = uint16_t{0};
+  auto data          = std::span<const char>{};
+
+  for (auto offset = size_t{RIFF_HEADER_SIZE}; (offset + CHUNK_HEADER_SIZE) <= bytes.size();)
+  {
+    const auto chunkId   = std::string{&bytes[offset], 4};
+    const auto chunkSize = ReadValue<uint32_t>(bytes, offset + 4);
+    const auto chunkData = bytes.subspan(offset + CHUNK_HEADER_SIZE);
+    const auto chunk = chunkData.first(std::min(static_cast<size_t>(chunkSize), chunkData.size()));
+    if (chunkId == "fmt ")
+    {
+      format        = ReadValue<uint16_t>(chunk, 0);
+      numChannels   = ReadValue<uint16_t>(chunk, 2);
+      bitsPerSample = ReadValue<uint16_t>(chunk, 14);
+    }
+    else if (chunkId == "data")
+    {
+      data = chunk;
+    }
+    // Chunks are padded to an even size.
+    offset += CHUNK_HEADER_SIZE + chunkSize + (chunkSize % 2);
+  }
+
+  const auto isPcm16   = (PCM_FORMAT == format) and (16 == bitsPerSample);
+  const auto isFloat32 = (FLOAT_FORMAT == format) and (32 == bitsPerSample);
+  if ((not isPcm16) and (not isFloat32))
+  {
+    throw std::runtime_error(
+        std::format("\"{}\": only 16 bit pcm and 32 bit float wav files are supported.", wavFile));
+  }
+  if ((numChannels < 1) or (numChannels > 2))
+  {
+    throw std::runtime_error(std::format("\"{}\": only mono and stereo are supported.", wavFile));
+  }
+
+  const auto bytesPerFrame = static_cast<size_t>(numChannels) * (bitsPerSample / 8U);
+  const auto numFrames     = data.size() / bytesPerFrame;
+  if (numFrames < AudioSamples::AUDIO_SAMPLE_LEN)
+  {
+    throw std::runtime_error(std::format("\"{}\": too few samples.", wavFile));
+  }
+
+  const auto getSample = [&data, &isPcm16, &bitsPerSample](const size_t sampleNum)
+  {
+    const auto offset = sampleNum * (bitsPerSample / 8U);
+    if (isPcm16)
+    {
+      static constexpr auto PCM16_SCALE = 1.0F / 32768.0F;
+      return PCM16_SCALE * static_cast<float>(ReadValue<int16_t>(data, offset));
+    }
+    return ReadValue<float>(data, offset);
+  };
+
+  m_stereoSamples.reserve(NUM_CHANNELS * numFrames);
+  for (auto frame = size_t{0}; frame < numFrames; ++frame)
+  {
+    const auto firstSample = frame * numChannels;
+    m_stereoSamples.emplace_back(getSample(firstSample));
+    m_stereoSamples.emplace_back(getSample(firstSample + (numChannels - 1U)));
+  }
+}
+
+auto WavAudioSource::GetNextSamples() -> AudioSamples
+{
+  const auto numFrames = m_stereoSamples.size() / NUM_CHANNELS;
+
+  // Loop back to the start if there are more updates than audio.
+  for (auto i = size_t{0}; i < AudioSamples::AUDIO_SAMPLE_LEN; ++i)
+  {
+    const auto frame                 = (m_nextFrame + i) % numFrames;
+    m_buffer[NUM_CHANNELS * i]       = m_stereoSamples[NUM_CHANNELS * frame];
+    m_buffer[(NUM_CHANNELS * i) + 1] = m_stereoSamples[(NUM_CHANNELS * frame) + 1];
+  }
+  m_nextFrame = (m_nextFrame + AudioSamples::AUDIO_SAMPLE_LEN) % numFrames;
+
+  return AudioSamples{NUM_CHANNELS, m_buffer};
+}
+
+// A couple of detuned tones with a regular beat. The beat gives goom some sound events to
+// react to, and the result is the same on every run.
+class SyntheticAudioSource : public AudioSource
+{
+public:
+  [[nodiscard]] auto GetNextSamples() -> AudioSamples override;
+
+private:
+  static constexpr auto SAMPLE_RATE          = 44100.0F;
+  static constexpr auto LEFT_FREQ            = 110.0F;
+  static constexpr auto RIGHT_FREQ           = 164.8F;
+  static constexpr auto BEAT_PERIOD_IN_SECS  = 0.5F;
+  static constexpr auto BEAT_DECAY_IN_SECS   = 0.1F;
+  static constexpr auto BACKGROUND_AMPLITUDE = 0.2F;
+  static constexpr auto BEAT_AMPLITUDE       = 0.7F;
+  uint64_t m_sampleNum        = 0U;
+  std::vector<float> m_buffer = std::vector<float>(NUM_CHANNELS * AudioSamples::AUDIO_SAMPLE_LEN);
+};
+
+auto SyntheticAudioSource::GetNextSamples() -> AudioSamples
+{
+  static constexpr auto TWO_PI = 2.0F * std::numbers::pi_v<float>;
+
+  for (auto i = size_t{0}; i < AudioSamples::AUDIO_SAMPLE_LEN; ++i)
+  {
+    const auto time          = static_cast<float>(m_sampleNum) / SAMPLE_RATE;
+    const auto timeSinceBeat = std::fmod(time, BEAT_PERIOD_IN_SECS);
+    const auto amplitude =
+        BACKGROUND_AMPLITUDE + (BEAT_AMPLITUDE * std::exp(-timeSinceBeat / BEAT_DECAY_IN_SECS));
+
+    m_buffer[NUM_CHANNELS * i]       = amplitude * std::sin(TWO_PI * LEFT_FREQ * time);
+    m_buffer[(NUM_CHANNELS * i) + 1] = amplitude * std::sin(TWO_PI * RIGHT_FREQ * time);
+    ++m_sampleNum;
+  }
+
+  return AudioSamples{NUM_CHANNELS, m_buffer};
+}
+
+// Stands in for the renderer's mapped pbo buffers.
+class BenchFrameDatas
+{
+public:
+  explicit BenchFrameDatas(const Dimensions& dimensions);
+
+  [[nodiscard]] auto GetFrameData(uint32_t slot) -> FrameData&;
+  // What the renderer does once it has uploaded a frame.
+  static auto ConsumeFrameData(FrameData& frameData) noexcept -> void;
+
+private:
+  std::array<FrameData, NUM_FRAME_DATAS> m_frameDatas{};
+  std::array<std::vector<Point2dFlt>, NUM_FRAME_DATAS> m_filterDestPosBuffers{};
+  std::array<std::vector<Pixel>, NUM_FRAME_DATAS> m_mainImageBuffers{};
+  std::array<std::vector<Pixel>, NUM_FRAME_DATAS> m_lowImageBuffers{};
+};
+
+BenchFrameDatas::BenchFrameDatas(const Dimensions& dimensions)
+{
+  for (auto i = 0U; i < NUM_FRAME_DATAS; ++i)
+  {
+    m_filterDestPosBuffers.at(i).resize(dimensions.GetSize());
+    m_mainImageBuffers.at(i).resize(dimensions.GetSize());
+    m_lowImageBuffers.at(i).resize(dimensions.GetSize());
+
+    // The buffers live as long as the bench, so goom can produce straight into them.
+    auto& frameData                                       = m_frameDatas.at(i);
+    frameData.filterPosArrays.filterDestPos               = m_filterDestPosBuffers.at(i);
+    frameData.filterPosArrays.filterDestPosMapGeneration = 1U;
+    frameData.imageArrays.mainImagePixelBuffer.SetPixelBuffer(m_mainImageBuffers.at(i),
+                                                              dimensions);
+    frameData.imageArrays.lowImagePixelBuffer.SetPixelBuffer(m_lowImageBuffers.at(i), dimensions);
+  }
+}
+
+auto BenchFrameDatas::GetFrameData(const uint32_t slot) -> FrameData&
+{
+  return m_frameDatas.at(slot);
+}
+
+auto BenchFrameDatas::ConsumeFrameData(FrameData& frameData) noexcept -> void
+{
+  frameData.filterPosArrays.filterDestPosNeedsUpdating    = false;
+  frameData.imageArrays.mainImagePixelBufferNeedsUpdating = false;
+  frameData.imageArrays.lowImagePixelBufferNeedsUpdating  = false;
+}
+
+[[nodiscard]] auto GetPercentile(const std::vector<double>& sortedValues, const double percentile)
+    -> double
+{
+  const auto index = static_cast<size_t>(
+      std::round((percentile / 100.0) * static_cast<double>(sortedValues.size() - 1)));
+  return sortedValues.at(index);
+}
+
+auto ReportUpdateTimes(std::vector<double> updateTimesInMs) -> void
+{
+  std::ranges::sort(updateTimesInMs);
+
+  auto totalTimeInMs = 0.0;
+  for (const auto updateTime : updateTimesInMs)
+  {
+    totalTimeInMs += updateTime;
+  }
+
+  std::cout << "\nUpdateGoomBuffers times (ms):\n";
+  std::cout << std::format("  mean {:8.3f}\n",
+                           totalTimeInMs / static_cast<double>(updateTimesInMs.size()));
+  std::cout << std::format("  min  {:8.3f}\n", updateTimesInMs.front());
+  std::cout << std::format("  p50  {:8.3f}\n", GetPercentile(updateTimesInMs, 50.0));
+  std::cout << std::format("  p95  {:8.3f}\n", GetPercentile(updateTimesInMs, 95.0));
+  std::cout << std::format("  p99  {:8.3f}\n", GetPercentile(updateTimesInMs, 99.0));
+  std::cout << std::format("  max  {:8.3f}\n", updateTimesInMs.back());
+}
+
+auto ReportStageTimes(const std::string& title,
+                      const std::vector<GoomControl::StageTiming>& stageTimings) -> void
+{
+  static constexpr auto NS_PER_MS = 1000000.0;
+  const auto toMs = [](const uint64_t timeInNs)
+  { return static_cast<double>(timeInNs) / NS_PER_MS; };
+
+  std::cout << std::format("\n{}:\n", title);
+  std::cout << std::format("  {:<28} {:>8} {:>12} {:>10} {:>10} {:>10} {:>10}\n",
+                           "stage",
+                           "count",
+                           "total (ms)",
+                           "mean (ms)",
+                           "p50 (ms)",
+                           "p95 (ms)",
+                           "p99 (ms)");
+  for (const auto& stageTiming : stageTimings)
+  {
+    const auto totalTimeInMs = toMs(stageTiming.totalTimeInNs);
+    const auto meanTimeInMs  = (0 == stageTiming.numTimes)
+                                   ? 0.0
+                                   : (totalTimeInMs / static_cast<double>(stageTiming.numTimes));
+    std::cout << std::format("  {:<28} {:>8} {:>12.3f} {:>10.3f} {:>10.3f} {:>10.3f} {:>10.3f}\n",
+                             stageTiming.stageName,
+                             stageTiming.numTimes,
+                             totalTimeInMs,
+                             meanTimeInMs,
+                             toMs(stageTiming.medianTimeInNs),
+                             toMs(stageTiming.p95TimeInNs),
+                             toMs(stageTiming.p99TimeInNs));
+  }
+}
+
+auto RunBench(const BenchOptions& options, GoomLogger& goomLogger) -> void
+{
+  SetRandSeed(options.seed);
+  GoomControl::SetPoolThreadOptions({.maxNumPoolThreads = options.numPoolThreads});
+
+  const auto dimensions = Dimensions{options.width, options.height};
+  auto frameDatas       = BenchFrameDatas{dimensions};
+  auto goomControl      = GoomControl{dimensions, options.resourcesDirectory, goomLogger};
+
+  auto audioSource = std::unique_ptr<AudioSource>{};
+  if (options.wavFile.empty())
+  {
+    audioSource = std::make_unique<SyntheticAudioSource>();
+  }
+  else
+  {
+    audioSource = std::make_unique<WavAudioSource>(options.wavFile);
+  }
+
+  std::cout << std::format("Resolution   : {} x {}\n", options.width, options.height);
+  std::cout << std::format("Frames       : {}\n", options.numFrames);
+  std::cout << std::format("Random seed  : {}\n", options.seed);
+  std::cout << std::format("Pool threads : {}\n", goomControl.GetNumPoolThreads());
+  std::cout << std::format("Parallel fx  : {}\n", options.drawFxConcurrently ? "yes" : "no");
+  std::cout << std::format(
+      "Audio        : {}\n", options.wavFile.empty() ? "synthetic" : options.wavFile);
+
+  goomControl.SetDrawFxConcurrently(options.drawFxConcurrently);
+  goomControl.SetFrameData(frameDatas.GetFrameData(0));
+  goomControl.Start();
+  goomControl.SetSongInfo(
+      {.title    = "goom_bench",
+       .genre    = "bench",
+       .duration = std::max(1U, options.numFrames / FRAMES_PER_SECOND)});
+
+  auto updateTimesInMs = std::vector<double>{};
+  updateTimesInMs.reserve(options.numFrames);
+
+  for (auto frame = 0U; frame < options.numFrames; ++frame)
+  {
+    const auto audioSamples = audioSource->GetNextSamples();
+    auto& frameData         = frameDatas.GetFrameData(frame % NUM_FRAME_DATAS);
+
+    const auto startTime = std::chrono::steady_clock::now();
+    goomControl.SetFrameData(frameData);
+    goomControl.UpdateGoomBuffers(audioSamples);
+    const auto timeTaken = std::chrono::steady_clock::now() - startTime;
+
+    updateTimesInMs.emplace_back(
+        std::chrono::duration<double, std::milli>(timeTaken).count());
+    BenchFrameDatas::ConsumeFrameData(frameData);
+  }
+
+  const auto stageTimings = goomControl.GetStageTimings();
+  const auto fxTimings    = goomControl.GetFxTimings();
+  goomControl.Finish();
+
+  ReportUpdateTimes(updateTimesInMs);
+  ReportStageTimes("Stage times", stageTimings);
+  ReportStageTimes("Visual fx times", fxTimings);
+}
+
+} // namespace
+
+auto main(int argc, char* argv[]) -> int
+{
+  auto goomLogger        = GoomControl::MakeGoomLogger();
+  const auto fConsoleLog = [](const GoomLogger::LogLevel, const std::string& str)
+  { std::clog << str << "\n"; };
+  AddLogHandler(*goomLogger, "console-log", fConsoleLog);
+  SetLogLevel(*goomLogger, GoomLogger::LogLevel::WARN);
+  SetLogLevelForFiles(*goomLogger, GoomLogger::LogLevel::WARN);
+  LogStart(*goomLogger);
+
+  GOOM::UTILS::SetGoomLogger(*goomLogger);
+
+  auto result = 0;
+  try
+  {
+    RunBench(GetBenchOptions(std::span{argv, static_cast<size_t>(argc)}), *goomLogger);
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << "goom_bench: " << e.what() << "\n";
+    result = 1;
+  }
+
+  LogStop(*goomLogger);
+
+  return result;
+}
@@ -26,6 +26,10 @@ struct FilterPosArrays
   static constexpr auto DEFAULT_POS1_POS2_MIX_FREQ = POS1_POS2_MIX_FREQ_RANGE.max;
   float filterPos1Pos2FreqMixFreq                  = 0.0F;
   bool filterDestPosNeedsUpdating                  = false;
+  // Non zero means 'filterDestPos' stays mapped, and is not read by the consumer unless
+  // 'filterDestPosNeedsUpdating' is set, until the generation changes. Goom can then write
+  // new dest positions straight into it. Zero means goom only ever copies into it.
+  uint32_t filterDestPosMapGeneration = 0U;
 };
 struct ImageArrays
 {
@@ -6,6 +6,7 @@ module;
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 export module Goom.Lib.GoomControl;
 
@@ -23,6 +24,17 @@ class GoomControl
 public:
   [[nodiscard]] static auto MakeGoomLogger() noexcept -> std::unique_ptr<GoomLogger>;
 
+  // All goom instances share one pool of worker threads. These options only take
+  // effect if set before the first GoomControl is constructed.
+  struct PoolThreadOptions
+  {
+    // If <= 0, use a default based on the number of cores.
+    int32_t maxNumPoolThreads = 0;
+    // If not empty, pool thread i is pinned to cpu 'cpuAffinity[i % size]'.
+    std::vector<uint32_t> cpuAffinity{};
+  };
+  static auto SetPoolThreadOptions(const PoolThreadOptions& options) noexcept -> void;
+
   GoomControl() = delete;
   GoomControl(const Dimensions& dimensions,
               const std::string& resourcesDirectory,
@@ -43,15 +55,57 @@ public:
 
   [[maybe_unused]] auto SetNoZooms(bool value) -> void;
   auto SetShowGoomState(bool value) -> void;
+  // Draw the visual fx that don't depend on each other at the same time, on the pool
+  // threads. The fx are still blended in the same order, but their random numbers come
+  // from the pool threads, so frames won't repeat exactly for a given random seed.
+  auto SetDrawFxConcurrently(bool value) -> void;
   auto SetDumpDirectory(const std::string& dumpDirectory) -> void;
   [[nodiscard]] auto GetDumpDirectory() const noexcept -> const std::string&;
 
+  // If 'filterPosArrays.filterDestPosMapGeneration' is non zero, new filter dest positions
+  // are produced straight into 'filterPosArrays.filterDestPos' of the frame data given here,
+  // possibly over several frames. So, until the generation changes, the consumer must keep
+  // that buffer mapped, and must only read it when 'filterDestPosNeedsUpdating' is set.
   auto SetFrameData(FrameData& frameData) -> void;
   auto UpdateGoomBuffers(const AudioSamples& audioSamples) -> void;
 
   [[nodiscard]] auto GetFrameData() const noexcept -> const FrameData&;
   [[nodiscard]] auto GetNumPoolThreads() const noexcept -> size_t;
 
+  // Wall times since Start. The percentiles are over the most recent times only, so they
+  // show what's happening now. These should be queried on the UpdateGoomBuffers thread.
+  struct StageTiming
+  {
+    std::string stageName;
+    uint64_t numTimes       = 0U;
+    uint64_t totalTimeInNs  = 0U;
+    uint64_t lastTimeInNs   = 0U;
+    uint64_t medianTimeInNs = 0U;
+    uint64_t p95TimeInNs    = 0U;
+    uint64_t p99TimeInNs    = 0U;
+    uint64_t maxTimeInNs    = 0U;
+  };
+  // The stages of UpdateGoomBuffers. The last stage, transform buffer production, runs in
+  // the background, so it doesn't add to the update time.
+  [[nodiscard]] auto GetStageTimings() const noexcept -> std::vector<StageTiming>;
+  // The visual fx drawing, which is part of the 'VISUAL_FX' stage, keyed by fx name.
+  [[nodiscard]] auto GetFxTimings() const noexcept -> std::vector<StageTiming>;
+
+  // Use of the per frame memory arenas, one per visual fx, plus the arena shared by the
+  // rest of the fx. A 'maxFrameNumBytes' more than 'blockSize' means that frame went to
+  // the heap - the block should have grown to fit by the next frame.
+  struct FrameArenaUsage
+  {
+    std::string fxName;
+    uint64_t numFrames              = 0U;
+    uint64_t totalNumAllocations    = 0U;
+    uint64_t totalNumBytes          = 0U;
+    uint64_t maxFrameNumAllocations = 0U;
+    uint64_t maxFrameNumBytes       = 0U;
+    uint64_t blockSize              = 0U;
+  };
+  [[nodiscard]] auto GetFrameArenaUsages() const noexcept -> std::vector<FrameArenaUsage>;
+
 private:
   class GoomControlImpl;
   spimpl::unique_impl_ptr<GoomControlImpl> m_pimpl;
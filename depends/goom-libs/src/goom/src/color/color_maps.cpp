@@ -84,6 +84,7 @@ public:
   [[nodiscard]] auto GetNumStops() const noexcept -> size_t override;
   [[nodiscard]] auto GetMapName() const noexcept -> ColorMapName override;
   [[nodiscard]] auto GetColor(float t) const noexcept -> Pixel override;
+  [[nodiscard]] auto GetExactColor(float t) const noexcept -> Pixel override;
 
 protected:
   [[nodiscard]] auto GetColorMap() const noexcept -> const IColorMap& { return *m_colorMapPtr; }
@@ -94,7 +95,7 @@ private:
   PixelChannelType m_defaultAlpha;
 };
 
-class RotatedColorMap : public ColorMapSharedPtrWrapper
+class RotatedColorMap final : public ColorMapSharedPtrWrapper
 {
 public:
   RotatedColorMap(const ConstColorMapSharedPtr& colorMapPtr,
@@ -102,14 +103,17 @@ public:
                   float tRotatePoint) noexcept;
 
   [[nodiscard]] auto GetColor(float t) const noexcept -> Pixel override;
+  [[nodiscard]] auto GetExactColor(float t) const noexcept -> Pixel override;
 
 private:
   static constexpr float MIN_ROTATE_POINT = 0.0F;
   static constexpr float MAX_ROTATE_POINT = 1.0F;
   float m_tRotatePoint;
+  [[nodiscard]] auto GetRotatedColor(float t) const noexcept -> Pixel;
+  ColorMapLut m_colorMapLut;
 };
 
-class TintedColorMap : public ColorMapSharedPtrWrapper
+class TintedColorMap final : public ColorMapSharedPtrWrapper
 {
 public:
   TintedColorMap(const ConstColorMapSharedPtr& colorMapPtr,
@@ -117,15 +121,18 @@ public:
                  const ColorMaps::TintProperties& tintProperties) noexcept;
 
   [[nodiscard]] auto GetColor(float t) const noexcept -> Pixel override;
+  [[nodiscard]] auto GetExactColor(float t) const noexcept -> Pixel override;
 
 private:
   static constexpr float MIN_LIGHTNESS = 0.1F;
   static constexpr float MAX_LIGHTNESS = 1.0F;
   float m_saturation;
   float m_lightness;
+  [[nodiscard]] auto GetTintedColor(float t) const noexcept -> Pixel;
+  ColorMapLut m_colorMapLut;
 };
 
-class PrebuiltColorMap : public IColorMap
+class PrebuiltColorMap final : public IColorMap
 {
 public:
   PrebuiltColorMap(ColorMapName mapName, const std::span<const vivid::srgb_t>& vividArray) noexcept;
@@ -141,12 +148,15 @@ public:
   }
   [[nodiscard]] auto GetMapName() const noexcept -> ColorMapName override { return m_mapName; }
   [[nodiscard]] auto GetColor(float t) const noexcept -> Pixel override;
+  [[nodiscard]] auto GetExactColor(float t) const noexcept -> Pixel override;
 
   static auto GetColorMix(const Pixel& col1, const Pixel& col2, float t) noexcept -> Pixel;
 
 private:
   ColorMapName m_mapName;
   vivid::ColorMap m_vividColorMap;
+  [[nodiscard]] auto GetVividColor(float t) const noexcept -> Pixel;
+  ColorMapLut m_colorMapLut;
 };
 
 namespace
@@ -348,6 +358,14 @@ inline auto ColorMapSharedPtrWrapper::GetColor(const float t) const noexcept ->
   };
 }
 
+inline auto ColorMapSharedPtrWrapper::GetExactColor(const float t) const noexcept -> Pixel
+{
+  const auto color = m_colorMapPtr->GetExactColor(t);
+  return Pixel{
+      {.red = color.R(), .green = color.G(), .blue = color.B(), .alpha = m_defaultAlpha}
+  };
+}
+
 RotatedColorMap::RotatedColorMap(const ConstColorMapSharedPtr& colorMapPtr,
                                  // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
                                  const PixelChannelType defaultAlpha,
@@ -359,13 +377,23 @@ RotatedColorMap::RotatedColorMap(const ConstColorMapSharedPtr& colorMapPtr,
 }
 
 inline auto RotatedColorMap::GetColor(const float t) const noexcept -> Pixel
+{
+  return m_colorMapLut.GetColor(t, [this](const float tEntry) { return GetRotatedColor(tEntry); });
+}
+
+auto RotatedColorMap::GetExactColor(const float t) const noexcept -> Pixel
+{
+  return GetRotatedColor(t);
+}
+
+auto RotatedColorMap::GetRotatedColor(const float t) const noexcept -> Pixel
 {
   auto tNew = m_tRotatePoint + t;
   if (tNew > 1.0F)
   {
     tNew = tNew - 1.0F;
   }
-  return ColorMapSharedPtrWrapper::GetColor(tNew);
+  return ColorMapSharedPtrWrapper::GetExactColor(tNew);
 }
 
 TintedColorMap::TintedColorMap(const ConstColorMapSharedPtr& colorMapPtr,
@@ -379,9 +407,20 @@ TintedColorMap::TintedColorMap(const ConstColorMapSharedPtr& colorMapPtr,
   Expects(tintProperties.lightness <= MAX_LIGHTNESS);
 }
 
-auto TintedColorMap::GetColor(const float t) const noexcept -> Pixel
+inline auto TintedColorMap::GetColor(const float t) const noexcept -> Pixel
 {
-  const auto color = GetColorMap().GetColor(t);
+  return m_colorMapLut.GetColor(t, [this](const float tEntry) { return GetTintedColor(tEntry); });
+}
+
+auto TintedColorMap::GetExactColor(const float t) const noexcept -> Pixel
+{
+  return GetTintedColor(t);
+}
+
+// Converting to hsv and back is slow, which is why this is only used to bake the lut.
+auto TintedColorMap::GetTintedColor(const float t) const noexcept -> Pixel
+{
+  const auto color = GetColorMap().GetExactColor(t);
   const auto rgb8  = vivid::col8_t{color.R(), color.G(), color.B()};
 
   static constexpr auto SATURATION_INDEX = 1;
@@ -404,6 +443,16 @@ inline PrebuiltColorMap::PrebuiltColorMap(const ColorMapName mapName,
 }
 
 inline auto PrebuiltColorMap::GetColor(const float t) const noexcept -> Pixel
+{
+  return m_colorMapLut.GetColor(t, [this](const float tEntry) { return GetVividColor(tEntry); });
+}
+
+auto PrebuiltColorMap::GetExactColor(const float t) const noexcept -> Pixel
+{
+  return GetVividColor(t);
+}
+
+auto PrebuiltColorMap::GetVividColor(const float t) const noexcept -> Pixel
 {
   const auto rgb8 = vivid::col8_t{vivid::rgb8::fromRgb(m_vividColorMap.at(t))};
   return Pixel{
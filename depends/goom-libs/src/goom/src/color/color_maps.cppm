@@ -1,20 +1,49 @@
 module;
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <span>
 
 export module Goom.Color.ColorMaps;
 
 import Goom.Color.ColorData.ColorMapEnums;
 import Goom.Color.ColorMapBase;
+import Goom.Color.ColorUtils;
 import Goom.Lib.GoomGraphic;
 import Goom.Lib.GoomTypes;
 
 export namespace GOOM::COLOR
 {
 
+// A color map sampled at evenly spaced points. A color is then just an index and a lerp
+// between neighbouring entries, however costly the original color map is. The entries are
+// baked from 'getColor' on the first 'GetColor', on whatever thread that is, so maps that
+// are made but never used cost nothing. Later 'getColor's are not called.
+class ColorMapLut
+{
+public:
+  static constexpr auto NUM_ENTRIES = 1024U;
+
+  ColorMapLut() noexcept = default;
+  ColorMapLut(const ColorMapLut&) = delete;
+  // Only for maps moved into place before use - the new lut bakes its own entries.
+  ColorMapLut(ColorMapLut&&) noexcept;
+  ~ColorMapLut() noexcept                            = default;
+  auto operator=(const ColorMapLut&) -> ColorMapLut& = delete;
+  auto operator=(ColorMapLut&&) -> ColorMapLut&      = delete;
+
+  template<typename GetColorFunc>
+  [[nodiscard]] auto GetColor(float t, const GetColorFunc& getColor) const noexcept -> Pixel;
+
+private:
+  mutable std::once_flag m_bakeOnce;
+  mutable std::array<Pixel, NUM_ENTRIES> m_colors{};
+};
+
 class ColorMapPtrWrapper : public IColorMap
 {
 public:
@@ -29,6 +58,7 @@ public:
   [[nodiscard]] auto GetNumStops() const noexcept -> size_t override;
   [[nodiscard]] auto GetMapName() const noexcept -> COLOR_DATA::ColorMapName override;
   [[nodiscard]] auto GetColor(float t) const noexcept -> Pixel override;
+  [[nodiscard]] auto GetExactColor(float t) const noexcept -> Pixel override;
 
   [[nodiscard]] auto IsNotNull() const noexcept -> bool;
 
@@ -124,6 +154,32 @@ private:
 namespace GOOM::COLOR
 {
 
+inline ColorMapLut::ColorMapLut([[maybe_unused]] ColorMapLut&& other) noexcept
+{
+}
+
+template<typename GetColorFunc>
+inline auto ColorMapLut::GetColor(const float t, const GetColorFunc& getColor) const noexcept
+    -> Pixel
+{
+  std::call_once(m_bakeOnce,
+                 [this, &getColor]
+                 {
+                   for (auto i = 0U; i < NUM_ENTRIES; ++i)
+                   {
+                     m_colors[i] =
+                         getColor(static_cast<float>(i) / static_cast<float>(NUM_ENTRIES - 1));
+                   }
+                 });
+
+  static constexpr auto MAX_T_INDEX = static_cast<float>(NUM_ENTRIES - 1);
+
+  const auto tIndex = std::clamp(t, 0.0F, 1.0F) * MAX_T_INDEX;
+  const auto index  = std::min(static_cast<uint32_t>(tIndex), NUM_ENTRIES - 2);
+
+  return GetRgbColorLerp(m_colors[index], m_colors[index + 1], tIndex - static_cast<float>(index));
+}
+
 inline ColorMapPtrWrapper::ColorMapPtrWrapper(const IColorMap* const colorMap,
                                               const PixelChannelType defaultAlpha) noexcept
   : m_colorMap{colorMap}, m_defaultAlpha{defaultAlpha}
@@ -148,6 +204,14 @@ inline auto ColorMapPtrWrapper::GetColor(const float t) const noexcept -> Pixel
   };
 }
 
+inline auto ColorMapPtrWrapper::GetExactColor(const float t) const noexcept -> Pixel
+{
+  const auto color = m_colorMap->GetExactColor(t);
+  return Pixel{
+      {.red = color.R(), .green = color.G(), .blue = color.B(), .alpha = m_defaultAlpha}
+  };
+}
+
 inline auto ColorMapPtrWrapper::IsNotNull() const noexcept -> bool
 {
   return m_colorMap != nullptr;
@@ -24,6 +24,9 @@ public:
   [[nodiscard]] virtual auto GetMapName() const -> COLOR_DATA::ColorMapName = 0;
 
   [[nodiscard]] virtual auto GetColor(float t) const -> Pixel = 0;
+  // Color maps baked into a lookup table return table colors from 'GetColor'. This
+  // returns the color the table was baked from - slower, but exact.
+  [[nodiscard]] virtual auto GetExactColor(float t) const -> Pixel { return GetColor(t); }
 };
 
 } // namespace GOOM::COLOR
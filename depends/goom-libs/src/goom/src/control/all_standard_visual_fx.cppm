@@ -1,20 +1,28 @@
 module;
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 export module Goom.Control.GoomAllVisualFx:AllStandardVisualFx;
 
 import Goom.Color.RandomColorMaps;
 import Goom.Control.GoomDrawables;
+import Goom.Control.GoomDrawablesData;
 import Goom.Control.GoomEffects;
+import Goom.Draw.GoomDrawToBuffer;
+import Goom.Draw.GoomDrawToLayer;
 import Goom.Control.GoomStateHandler;
 import Goom.Utils.EnumUtils;
+import Goom.Utils.FrameArena;
 import Goom.Utils.Parallel;
+import Goom.Utils.StageTimings;
 import Goom.Utils.Stopwatch;
 import Goom.Utils.Graphics.SmallImageBitmaps;
 import Goom.VisualFx.FxHelper;
@@ -38,9 +46,15 @@ import Goom.Lib.Point2d;
 import Goom.Lib.SoundInfo;
 import :VisualFxColorMaps;
 
+using GOOM::DRAW::GoomDrawToLayer;
+using GOOM::DRAW::GoomDrawToTwoBuffers;
+using GOOM::DRAW::LayerCompositor;
 using GOOM::UTILS::EnumMap;
+using GOOM::UTILS::FrameArena;
 using GOOM::UTILS::Parallel;
+using GOOM::UTILS::StageTimings;
 using GOOM::UTILS::Stopwatch;
+using GOOM::UTILS::TaskPriority;
 using GOOM::UTILS::GRAPHICS::SmallImageBitmaps;
 using GOOM::VISUAL_FX::FxHelper;
 using GOOM::VISUAL_FX::IVisualFx;
@@ -55,6 +69,7 @@ class AllStandardVisualFx
 public:
   AllStandardVisualFx(Parallel& parallel,
                       FxHelper& fxHelper,
+                      GoomDrawToTwoBuffers& multiBufferDraw,
                       const SmallImageBitmaps& smallBitmaps,
                       const std::string& resourcesDirectory) noexcept;
 
@@ -75,6 +90,10 @@ public:
   auto ResumeFx() -> void;
   auto ChangeAllFxPixelBlenders(const IVisualFx::PixelBlenderParams& pixelBlenderParams) noexcept
       -> void;
+  // If set, the fx that can draw to their own layer are drawn at the same time on the pool
+  // threads. The layers are then composited in the same order as the fx would have been
+  // drawn, so the pixel blending is unchanged.
+  auto SetDrawFxConcurrently(bool val) noexcept -> void;
   auto SetZoomMidpoint(const Point2dInt& zoomMidpoint) -> void;
 
   [[nodiscard]] auto GetFrameMiscData() const noexcept -> const MiscData&;
@@ -86,14 +105,42 @@ public:
 
   auto ChangeShaderVariables() -> void;
 
+  // One stage per drawable, in GoomDrawables order, then the shader fx.
+  [[nodiscard]] auto GetFxTimings() const noexcept -> const StageTimings&;
+
+  // Must be called before each update, when no fx is drawing.
+  auto ResetFxFrameArenas() noexcept -> void;
+  [[nodiscard]] auto GetFxName(GoomDrawables drawable) const noexcept -> std::string;
+  [[nodiscard]] auto GetFxFrameArena(GoomDrawables drawable) const noexcept -> const FrameArena&;
+
 private:
   std::unique_ptr<ShaderFx> m_shaderFx;
+  // Each fx gets its own fx helper, with its own frame arena, so the fx can use their
+  // arenas when drawn at the same time. An fx that can draw to a layer also gets its own
+  // draw - otherwise 'layerDraw' is null and the fx draws with the shared draw.
+  struct FxResources
+  {
+    FxResources(GoomDrawToTwoBuffers& multiBufferDraw,
+                FxHelper& sharedFxHelper,
+                bool canDrawToLayer) noexcept;
+    std::unique_ptr<GoomDrawToLayer> layerDraw;
+    FrameArena frameArena;
+    FxHelper fxHelper;
+  };
+  using AllFxResources = EnumMap<GoomDrawables, std::unique_ptr<FxResources>>;
+  AllFxResources m_allFxResources;
+  [[nodiscard]] static auto GetAllFxResources(GoomDrawToTwoBuffers& multiBufferDraw,
+                                              FxHelper& fxHelper) -> AllFxResources;
+  [[nodiscard]] auto IsLayered(GoomDrawables drawable) const noexcept -> bool;
   EnumMap<GoomDrawables, std::unique_ptr<IVisualFx>> m_drawablesMap;
   [[nodiscard]] static auto GetDrawablesMap(Parallel& parallel,
-                                            FxHelper& fxHelper,
+                                            AllFxResources& allFxResources,
                                             const SmallImageBitmaps& smallBitmaps,
                                             const std::string& resourcesDirectory)
       -> EnumMap<GoomDrawables, std::unique_ptr<IVisualFx>>;
+  StageTimings m_fxTimings{GetFxTimingsStageNames()};
+  [[nodiscard]] auto GetFxTimingsStageNames() const noexcept -> std::vector<std::string>;
+  [[nodiscard]] static auto GetShaderFxTimingsStage() noexcept -> uint32_t;
   VisualFxColorMaps m_visualFxColorMaps;
   MiscData* m_frameMiscData = nullptr;
   auto ChangeDotsColorMaps() noexcept -> void;
@@ -111,6 +158,16 @@ private:
 
   auto ApplyStandardFxToImageBuffers(const AudioSamples& soundData) -> void;
   auto ApplyShaderFxToImageBuffers() -> void;
+  auto PrepareFxToDraw(GoomDrawables drawable, const AudioSamples& soundData) -> void;
+  auto DrawFx(GoomDrawables drawable) -> void;
+
+  bool m_drawFxConcurrently = false;
+  Parallel m_fxParallel{TaskPriority::FRAME_CRITICAL};
+  LayerCompositor m_layerCompositor;
+  std::vector<GoomDrawables> m_layeredDrawables;
+  std::vector<GoomDrawToLayer*> m_layersToComposite;
+  auto ApplyStandardFxToImageBuffersConcurrently(const AudioSamples& soundData) -> void;
+  auto CompositeLayers() -> void;
 };
 
 } // namespace GOOM::CONTROL
@@ -138,6 +195,17 @@ inline void AllStandardVisualFx::SetResetDrawBuffSettingsFunc(
 inline void AllStandardVisualFx::ResetDrawBuffSettings(const GoomDrawables fx)
 {
   m_resetCurrentDrawBuffSettingsFunc(fx);
+
+  if (IsLayered(fx))
+  {
+    auto& layerDraw = *m_allFxResources[fx]->layerDraw;
+    layerDraw.SetBuffIntensity(layerDraw.GetDestDraw().GetBuffIntensity());
+  }
+}
+
+inline auto AllStandardVisualFx::SetDrawFxConcurrently(const bool val) noexcept -> void
+{
+  m_drawFxConcurrently = val;
 }
 
 inline auto AllStandardVisualFx::GetFrameMiscData() const noexcept -> const MiscData&
@@ -167,6 +235,34 @@ inline auto AllStandardVisualFx::ApplyCurrentStateToImageBuffers(const AudioSamp
   ApplyShaderFxToImageBuffers();
 }
 
+inline auto AllStandardVisualFx::GetFxTimings() const noexcept -> const StageTimings&
+{
+  return m_fxTimings;
+}
+
+inline auto AllStandardVisualFx::ResetFxFrameArenas() noexcept -> void
+{
+  std::ranges::for_each(m_allFxResources,
+                        [](auto& fxResources) { fxResources->frameArena.Reset(); });
+}
+
+inline auto AllStandardVisualFx::GetFxName(const GoomDrawables drawable) const noexcept
+    -> std::string
+{
+  return m_drawablesMap[drawable]->GetFxName();
+}
+
+inline auto AllStandardVisualFx::GetFxFrameArena(const GoomDrawables drawable) const noexcept
+    -> const FrameArena&
+{
+  return m_allFxResources[drawable]->frameArena;
+}
+
+inline auto AllStandardVisualFx::IsLayered(const GoomDrawables drawable) const noexcept -> bool
+{
+  return m_allFxResources[drawable]->layerDraw != nullptr;
+}
+
 } // namespace GOOM::CONTROL
 
 namespace GOOM::CONTROL
@@ -174,6 +270,7 @@ namespace GOOM::CONTROL
 
 using CONTROL::GoomDrawables;
 using UTILS::NUM;
+using UTILS::ScopedStageTimer;
 using VISUAL_FX::CirclesFx;
 using VISUAL_FX::FlyingStarsFx;
 using VISUAL_FX::GoomDotsFx;
@@ -189,37 +286,93 @@ using VISUAL_FX::FLYING_STARS::StarTypesContainer;
 
 AllStandardVisualFx::AllStandardVisualFx(Parallel& parallel,
                                          FxHelper& fxHelper,
+                                         GoomDrawToTwoBuffers& multiBufferDraw,
                                          const SmallImageBitmaps& smallBitmaps,
                                          const std::string& resourcesDirectory) noexcept
   : m_shaderFx{std::make_unique<ShaderFx>(fxHelper)},
-    m_drawablesMap{GetDrawablesMap(parallel, fxHelper, smallBitmaps, resourcesDirectory)},
-    m_visualFxColorMaps{fxHelper.GetGoomRand()}
+    m_allFxResources{GetAllFxResources(multiBufferDraw, fxHelper)},
+    m_drawablesMap{GetDrawablesMap(parallel, m_allFxResources, smallBitmaps, resourcesDirectory)},
+    m_visualFxColorMaps{fxHelper.GetGoomRand()},
+    m_layerCompositor{m_fxParallel, multiBufferDraw.GetDirtyTiles()}
 {
   Expects(NUM<GoomDrawables> == m_drawablesMap.size());
+
+  m_layeredDrawables.reserve(NUM<GoomDrawables>);
+  m_layersToComposite.reserve(NUM<GoomDrawables>);
+}
+
+AllStandardVisualFx::FxResources::FxResources(GoomDrawToTwoBuffers& multiBufferDraw,
+                                              FxHelper& sharedFxHelper,
+                                              const bool canDrawToLayer) noexcept
+  : layerDraw{canDrawToLayer ? std::make_unique<GoomDrawToLayer>(multiBufferDraw) : nullptr},
+    fxHelper{layerDraw != nullptr ? *layerDraw : sharedFxHelper.GetDraw(),
+             sharedFxHelper.GetGoomInfo(),
+             sharedFxHelper.GetGoomRand(),
+             sharedFxHelper.GetGoomLogger(),
+             sharedFxHelper.GetBlend2dContexts(),
+             frameArena}
+{
+}
+
+auto AllStandardVisualFx::GetAllFxResources(GoomDrawToTwoBuffers& multiBufferDraw,
+                                            FxHelper& fxHelper) -> AllFxResources
+{
+  auto allFxResources = AllFxResources{};
+
+  for (auto i = 0U; i < NUM<GoomDrawables>; ++i)
+  {
+    const auto drawable      = static_cast<GoomDrawables>(i);
+    allFxResources[drawable] =
+        std::make_unique<FxResources>(multiBufferDraw, fxHelper, CanDrawToLayer(drawable));
+  }
+
+  return allFxResources;
 }
 
 auto AllStandardVisualFx::GetDrawablesMap(Parallel& parallel,
-                                          FxHelper& fxHelper,
+                                          AllFxResources& allFxResources,
                                           const SmallImageBitmaps& smallBitmaps,
                                           const std::string& resourcesDirectory)
     -> UTILS::EnumMap<GoomDrawables, std::unique_ptr<IVisualFx>>
 {
+  const auto getFxHelper = [&allFxResources](const GoomDrawables drawable) -> FxHelper&
+  { return allFxResources[drawable]->fxHelper; };
+
+  using enum GoomDrawables;
   return UTILS::EnumMap<GoomDrawables, std::unique_ptr<IVisualFx>>{{{
-      {GoomDrawables::CIRCLES, std::make_unique<CirclesFx>(fxHelper, smallBitmaps)},
-      {GoomDrawables::DOTS, std::make_unique<GoomDotsFx>(fxHelper, smallBitmaps)},
-      {GoomDrawables::IFS, std::make_unique<IfsDancersFx>(fxHelper, smallBitmaps)},
-      {GoomDrawables::IMAGE, std::make_unique<ImageFx>(parallel, fxHelper, resourcesDirectory)},
-      {GoomDrawables::L_SYSTEM, std::make_unique<LSystemFx>(fxHelper, resourcesDirectory)},
-      {GoomDrawables::LINES, std::make_unique<LinesFx>(fxHelper, smallBitmaps)},
-      {GoomDrawables::PARTICLES, std::make_unique<ParticlesFx>(fxHelper, smallBitmaps)},
-      {GoomDrawables::RAINDROPS, std::make_unique<RaindropsFx>(fxHelper)},
-      {GoomDrawables::SHAPES, std::make_unique<ShapesFx>(fxHelper)},
-      {GoomDrawables::STARS, std::make_unique<FlyingStarsFx>(fxHelper, smallBitmaps)},
-      {GoomDrawables::TENTACLES, std::make_unique<TentaclesFx>(fxHelper)},
-      {GoomDrawables::TUBES, std::make_unique<TubesFx>(fxHelper, smallBitmaps)},
+      {CIRCLES, std::make_unique<CirclesFx>(getFxHelper(CIRCLES), smallBitmaps)},
+      {DOTS, std::make_unique<GoomDotsFx>(getFxHelper(DOTS), smallBitmaps)},
+      {IFS, std::make_unique<IfsDancersFx>(parallel, getFxHelper(IFS), smallBitmaps)},
+      {IMAGE, std::make_unique<ImageFx>(parallel, getFxHelper(IMAGE), resourcesDirectory)},
+      {L_SYSTEM, std::make_unique<LSystemFx>(getFxHelper(L_SYSTEM), resourcesDirectory)},
+      {LINES, std::make_unique<LinesFx>(getFxHelper(LINES), smallBitmaps)},
+      {PARTICLES, std::make_unique<ParticlesFx>(getFxHelper(PARTICLES), smallBitmaps)},
+      {RAINDROPS, std::make_unique<RaindropsFx>(getFxHelper(RAINDROPS))},
+      {SHAPES, std::make_unique<ShapesFx>(getFxHelper(SHAPES))},
+      {STARS, std::make_unique<FlyingStarsFx>(getFxHelper(STARS), smallBitmaps)},
+      {TENTACLES, std::make_unique<TentaclesFx>(getFxHelper(TENTACLES))},
+      {TUBES, std::make_unique<TubesFx>(getFxHelper(TUBES), smallBitmaps)},
   }}};
 }
 
+auto AllStandardVisualFx::GetFxTimingsStageNames() const noexcept -> std::vector<std::string>
+{
+  auto stageNames = std::vector<std::string>{};
+
+  for (auto i = 0U; i < NUM<GoomDrawables>; ++i)
+  {
+    stageNames.emplace_back(m_drawablesMap[static_cast<GoomDrawables>(i)]->GetFxName());
+  }
+  stageNames.emplace_back(m_shaderFx->GetFxName());
+
+  return stageNames;
+}
+
+inline auto AllStandardVisualFx::GetShaderFxTimingsStage() noexcept -> uint32_t
+{
+  return NUM<GoomDrawables>;
+}
+
 inline auto AllStandardVisualFx::GetLinesFx() noexcept -> VISUAL_FX::LinesFx&
 {
   return *dynamic_cast<LinesFx*>(m_drawablesMap[GoomDrawables::LINES].get());
@@ -303,20 +456,93 @@ inline auto AllStandardVisualFx::SetFrameMiscDataToStandardFx() -> void
 inline auto AllStandardVisualFx::ApplyStandardFxToImageBuffers(const AudioSamples& soundData)
     -> void
 {
+  if (m_drawFxConcurrently)
+  {
+    ApplyStandardFxToImageBuffersConcurrently(soundData);
+    return;
+  }
+
   std::ranges::for_each(m_currentDrawablesState.GetDrawables(),
                         [this, &soundData](const auto drawable)
                         {
-                          auto& visualFx = *m_drawablesMap[drawable];
+                          PrepareFxToDraw(drawable, soundData);
+                          DrawFx(drawable);
+                        });
+}
 
-                          visualFx.SetSoundData(soundData);
+auto AllStandardVisualFx::ApplyStandardFxToImageBuffersConcurrently(
+    const AudioSamples& soundData) -> void
+{
+  const auto& drawables = m_currentDrawablesState.GetDrawables();
 
-                          ResetDrawBuffSettings(drawable);
-                          visualFx.ApplyToImageBuffers();
-                        });
+  m_layeredDrawables.clear();
+  std::ranges::copy_if(drawables,
+                       std::back_inserter(m_layeredDrawables),
+                       [this](const auto drawable) { return IsLayered(drawable); });
+
+  for (const auto drawable : m_layeredDrawables)
+  {
+    PrepareFxToDraw(drawable, soundData);
+    m_allFxResources[drawable]->layerDraw->SetDrawToLayer(true);
+  }
+  if (not m_layeredDrawables.empty())
+  {
+    m_fxParallel.ForLoop(m_layeredDrawables.size(),
+                         [this](const size_t i) { DrawFx(m_layeredDrawables[i]); });
+  }
+
+  // Now go through the fx in order. Layers are composited as late as possible, so more
+  // of them can be done in one go, but always before an fx that draws straight to the
+  // buffers.
+  m_layersToComposite.clear();
+  for (const auto drawable : drawables)
+  {
+    if (IsLayered(drawable))
+    {
+      m_layersToComposite.emplace_back(m_allFxResources[drawable]->layerDraw.get());
+      continue;
+    }
+
+    CompositeLayers();
+    PrepareFxToDraw(drawable, soundData);
+    DrawFx(drawable);
+  }
+  CompositeLayers();
+
+  for (const auto drawable : m_layeredDrawables)
+  {
+    m_allFxResources[drawable]->layerDraw->SetDrawToLayer(false);
+  }
+}
+
+inline auto AllStandardVisualFx::CompositeLayers() -> void
+{
+  if (m_layersToComposite.empty())
+  {
+    return;
+  }
+
+  m_layerCompositor.CompositeLayers(m_layersToComposite);
+  m_layersToComposite.clear();
+}
+
+inline auto AllStandardVisualFx::PrepareFxToDraw(const GoomDrawables drawable,
+                                                 const AudioSamples& soundData) -> void
+{
+  m_drawablesMap[drawable]->SetSoundData(soundData);
+  ResetDrawBuffSettings(drawable);
+}
+
+inline auto AllStandardVisualFx::DrawFx(const GoomDrawables drawable) -> void
+{
+  // Safe on the pool threads - each fx has its own timings stage.
+  const auto fxTimer = ScopedStageTimer{m_fxTimings, static_cast<uint32_t>(drawable)};
+  m_drawablesMap[drawable]->ApplyToImageBuffers();
 }
 
 inline auto AllStandardVisualFx::ApplyShaderFxToImageBuffers() -> void
 {
+  const auto fxTimer = ScopedStageTimer{m_fxTimings, GetShaderFxTimingsStage()};
   m_shaderFx->ApplyToImageBuffers();
 }
 
@@ -8,6 +8,8 @@ module Goom.Control.GoomAllVisualFx;
 
 import Goom.Control.GoomDrawables;
 import Goom.Control.GoomStateHandler;
+import Goom.Draw.GoomDrawToBuffer;
+import Goom.Utils.FrameArena;
 import Goom.VisualFx.FxHelper;
 import Goom.VisualFx.FxUtils;
 import Goom.Lib.FrameData;
@@ -21,7 +23,10 @@ namespace GOOM::CONTROL
 {
 
 using CONTROL::GoomDrawables;
+using DRAW::GoomDrawToTwoBuffers;
+using UTILS::FrameArena;
 using UTILS::Parallel;
+using UTILS::StageTimings;
 using UTILS::Stopwatch;
 using UTILS::GRAPHICS::SmallImageBitmaps;
 using VISUAL_FX::FxHelper;
@@ -30,13 +35,14 @@ using VISUAL_FX::FX_UTILS::RandomPixelBlender;
 
 GoomAllVisualFx::GoomAllVisualFx(Parallel& parallel,
                                  FxHelper& fxHelper,
+                                 GoomDrawToTwoBuffers& multiBufferDraw,
                                  const SmallImageBitmaps& smallBitmaps,
                                  const std::string& resourcesDirectory,
                                  IGoomStateHandler& goomStateHandler) noexcept
   : m_goomRand{&fxHelper.GetGoomRand()},
     m_goomLogger{&fxHelper.GetGoomLogger()},
     m_allStandardVisualFx{spimpl::make_unique_impl<AllStandardVisualFx>(
-        parallel, fxHelper, smallBitmaps, resourcesDirectory)},
+        parallel, fxHelper, multiBufferDraw, smallBitmaps, resourcesDirectory)},
     m_goomStateHandler{&goomStateHandler}
 {
   m_allStandardVisualFx->SetResetDrawBuffSettingsFunc([this](const GoomDrawables fx)
@@ -158,6 +164,27 @@ auto GoomAllVisualFx::ApplyEndEffectIfNearEnd(const Stopwatch::TimeValues& timeV
   m_allStandardVisualFx->ApplyEndEffectIfNearEnd(timeValues);
 }
 
+auto GoomAllVisualFx::GetFxTimings() const noexcept -> const StageTimings&
+{
+  return m_allStandardVisualFx->GetFxTimings();
+}
+
+auto GoomAllVisualFx::ResetFxFrameArenas() noexcept -> void
+{
+  m_allStandardVisualFx->ResetFxFrameArenas();
+}
+
+auto GoomAllVisualFx::GetFxName(const GoomDrawables drawable) const noexcept -> std::string
+{
+  return m_allStandardVisualFx->GetFxName(drawable);
+}
+
+auto GoomAllVisualFx::GetFxFrameArena(const GoomDrawables drawable) const noexcept
+    -> const FrameArena&
+{
+  return m_allStandardVisualFx->GetFxFrameArena(drawable);
+}
+
 auto GoomAllVisualFx::GetCurrentColorMapsNames() noexcept -> std::unordered_set<std::string>
 {
   return AllStandardVisualFx::GetActiveColorMapsNames();
@@ -11,7 +11,10 @@ export module Goom.Control.GoomAllVisualFx;
 
 import Goom.Control.GoomDrawables;
 import Goom.Control.GoomStateHandler;
+import Goom.Draw.GoomDrawToBuffer;
+import Goom.Utils.FrameArena;
 import Goom.Utils.Parallel;
+import Goom.Utils.StageTimings;
 import Goom.Utils.Stopwatch;
 import Goom.Utils.Graphics.SmallImageBitmaps;
 import Goom.Utils.Math.GoomRand;
@@ -26,7 +29,10 @@ import Goom.Lib.SPimpl;
 import :AllStandardVisualFx;
 import :VisualFxColorMaps;
 
+using GOOM::DRAW::GoomDrawToTwoBuffers;
+using GOOM::UTILS::FrameArena;
 using GOOM::UTILS::Parallel;
+using GOOM::UTILS::StageTimings;
 using GOOM::UTILS::Stopwatch;
 using GOOM::UTILS::GRAPHICS::SmallImageBitmaps;
 using GOOM::UTILS::MATH::GoomRand;
@@ -43,6 +49,7 @@ public:
   GoomAllVisualFx() noexcept = delete;
   GoomAllVisualFx(Parallel& parallel,
                   FxHelper& fxHelper,
+                  GoomDrawToTwoBuffers& multiBufferDraw,
                   const SmallImageBitmaps& smallBitmaps,
                   const std::string& resourcesDirectory,
                   IGoomStateHandler& goomStateHandler) noexcept;
@@ -51,6 +58,7 @@ public:
   auto Finish() noexcept -> void;
 
   auto SetAllowMultiThreadedStates(bool val) noexcept -> void;
+  auto SetDrawFxConcurrently(bool val) noexcept -> void;
 
   auto SetZoomMidpoint(const Point2dInt& zoomMidpoint) noexcept -> void;
 
@@ -71,6 +79,14 @@ public:
 
   [[nodiscard]] static auto GetCurrentColorMapsNames() noexcept -> std::unordered_set<std::string>;
 
+  // The wall times of each visual fx, keyed by 'IVisualFx::GetFxName()'.
+  [[nodiscard]] auto GetFxTimings() const noexcept -> const StageTimings&;
+
+  // Each drawable has its own frame arena. They must be reset before each update.
+  auto ResetFxFrameArenas() noexcept -> void;
+  [[nodiscard]] auto GetFxName(GoomDrawables drawable) const noexcept -> std::string;
+  [[nodiscard]] auto GetFxFrameArena(GoomDrawables drawable) const noexcept -> const FrameArena&;
+
 private:
   const GoomRand* m_goomRand;
   [[maybe_unused]] GoomLogger* m_goomLogger;
@@ -115,6 +131,11 @@ inline auto GoomAllVisualFx::SetAllowMultiThreadedStates(const bool val) noexcep
   m_allowMultiThreadedStates = val;
 }
 
+inline auto GoomAllVisualFx::SetDrawFxConcurrently(const bool val) noexcept -> void
+{
+  m_allStandardVisualFx->SetDrawFxConcurrently(val);
+}
+
 inline auto GoomAllVisualFx::SetNextState() noexcept -> void
 {
   ChangeState();
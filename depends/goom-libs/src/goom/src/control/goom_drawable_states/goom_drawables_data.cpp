@@ -65,6 +65,21 @@ static constexpr auto STATE_MULTI_THREADED = EnumMap<GoomDrawables, bool>{{{
     {GoomDrawables::TUBES, false},
 }}};
 
+static constexpr auto STATE_CAN_DRAW_TO_LAYER = EnumMap<GoomDrawables, bool>{{{
+    {GoomDrawables::CIRCLES, true},
+    {GoomDrawables::DOTS, true},
+    {GoomDrawables::IFS, false}, // the low density blurrer reads pixels back
+    {GoomDrawables::L_SYSTEM, true},
+    {GoomDrawables::LINES, true},
+    {GoomDrawables::IMAGE, false}, // already multi-threaded
+    {GoomDrawables::PARTICLES, true},
+    {GoomDrawables::RAINDROPS, false}, // uses the shared blend2d contexts
+    {GoomDrawables::SHAPES, false},    // uses the shared blend2d contexts
+    {GoomDrawables::STARS, true},
+    {GoomDrawables::TENTACLES, true},
+    {GoomDrawables::TUBES, true},
+}}};
+
 static constexpr auto PROB_SINGLE_DRAWABLE = EnumMap<GoomDrawables, float>{{{
     {GoomDrawables::CIRCLES, 1.0F},
     {GoomDrawables::DOTS, 1.0F},
@@ -119,4 +134,9 @@ auto GetProbCanBeSingleDrawable(const GoomDrawables drawable) noexcept -> float
   return PROB_SINGLE_DRAWABLE[drawable];
 }
 
+auto CanDrawToLayer(const GoomDrawables drawable) noexcept -> bool
+{
+  return STATE_CAN_DRAW_TO_LAYER[drawable];
+}
+
 } // namespace GOOM::CONTROL
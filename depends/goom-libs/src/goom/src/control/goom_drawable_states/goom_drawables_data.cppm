@@ -28,4 +28,8 @@ export namespace GOOM::CONTROL
 
 [[nodiscard]] auto GetProbCanBeSingleDrawable(GoomDrawables drawable) noexcept -> float;
 
+// True if the drawable only draws through its fx helper's draw, and doesn't read pixels
+// back, use blend2d or use its own threads. So it can draw to a layer on another thread.
+[[nodiscard]] auto CanDrawToLayer(GoomDrawables drawable) noexcept -> bool;
+
 } // namespace GOOM::CONTROL
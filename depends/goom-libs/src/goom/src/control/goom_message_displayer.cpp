@@ -14,6 +14,7 @@ module Goom.Control.GoomMessageDisplayer;
 import Goom.Color.ColorUtils;
 import Goom.Draw.GoomDrawBase;
 import Goom.Draw.ShaperDrawers.TextDrawer;
+import Goom.Utils.Text.CachedText;
 import Goom.Lib.GoomGraphic;
 import Goom.Lib.GoomTypes;
 import Goom.Lib.Point2d;
@@ -25,47 +26,49 @@ using COLOR::GetBrighterColor;
 using COLOR::GetSimpleColor;
 using DRAW::IGoomDraw;
 using DRAW::SHAPE_DRAWERS::TextDrawer;
+using UTILS::TEXT::CachedText;
+
+static constexpr auto TEXT_BRIGHTNESS    = 50.0F;
+static constexpr auto OUTLINE_BRIGHTNESS = TEXT_BRIGHTNESS;
 
 GoomMessageDisplayer::GoomMessageDisplayer(IGoomDraw& draw, const std::string& messagesFontFile)
-  : m_draw{&draw}, m_messagesDisplayer{GetMessagesDisplayer(messagesFontFile)}
+  : m_draw{&draw},
+    m_messagesDisplayer{GetMessagesDisplayer(messagesFontFile)},
+    m_getFontColor{GetFontColorFunc(TEXT_BRIGHTNESS)},
+    m_getOutlineFontColor{GetFontColorFunc(OUTLINE_BRIGHTNESS)}
 {
 }
 
 auto GoomMessageDisplayer::GetMessagesDisplayer(const std::string& messagesFontFile) const
     -> TextDrawer
 {
-
-  static constexpr auto TEXT_BRIGHTNESS = 50.0F;
-  const auto getFontColor               = [this]([[maybe_unused]] const size_t textIndexOfChar,
-                                   [[maybe_unused]] const Point2dInt& point,
-                                   [[maybe_unused]] const Dimensions& charDimensions)
-  { return GetBrighterColor(TEXT_BRIGHTNESS, m_currentTextColor); };
-
-  static constexpr auto OUTLINE_BRIGHTNESS = TEXT_BRIGHTNESS;
-  // const auto outlineColor                  = GetBrighterColor(OUTLINE_BRIGHTNESS, WHITE_PIXEL);
-  const auto getOutlineFontColor = [this]([[maybe_unused]] const size_t textIndexOfChar,
-                                          [[maybe_unused]] const Point2dInt& point,
-                                          [[maybe_unused]] const Dimensions& charDimensions)
-  { return GetBrighterColor(OUTLINE_BRIGHTNESS, m_currentTextColor); };
-
   auto displayer = TextDrawer{*m_draw};
 
   displayer.SetFontFile(messagesFontFile);
   displayer.SetFontSize(MESSAGES_FONT_SIZE);
   displayer.SetOutlineWidth(1);
   displayer.SetAlignment(TextDrawer::TextAlignment::LEFT);
-  displayer.SetFontColorFunc(getFontColor);
-  displayer.SetOutlineFontColorFunc(getOutlineFontColor);
   displayer.SetParallelRender(false);
 
   return displayer;
 }
 
+auto GoomMessageDisplayer::GetFontColorFunc(const float brightness) const
+    -> TextDrawer::FontColorFunc
+{
+  return [this, brightness]([[maybe_unused]] const size_t textIndexOfChar,
+                            [[maybe_unused]] const Point2dInt& point,
+                            [[maybe_unused]] const Dimensions& charDimensions)
+  { return GetBrighterColor(brightness, m_currentTextColor); };
+}
+
 auto GoomMessageDisplayer::DisplayMessageGroups(const std::vector<MessageGroup>& messageGroups)
     -> void
 {
   static constexpr auto Y_START = 0;
 
+  m_numMessageLinesDrawn = 0U;
+
   auto y = Y_START;
   for (const auto& messageGroup : messageGroups)
   {
@@ -97,12 +100,26 @@ auto GoomMessageDisplayer::DisplayMessageGroup(const int32_t yStart,
     yPos = yStart +
            static_cast<int32_t>(totalMessagesHeight - ((numberOfLinesInMessage - i) * LINE_HEIGHT));
 
-    m_messagesDisplayer.SetText(messageGroup.messages[i]);
-    m_messagesDisplayer.Prepare();
-    m_messagesDisplayer.Draw({.x = X_POS, .y = yPos});
+    DrawMessageLine(messageGroup.messages[i], {.x = X_POS, .y = yPos});
   }
 
   return yPos + BETWEEN_GROUP_SPACING;
 }
 
+auto GoomMessageDisplayer::DrawMessageLine(const std::string& message, const Point2dInt& pen)
+    -> void
+{
+  if (m_numMessageLinesDrawn == m_cachedMessageLines.size())
+  {
+    m_cachedMessageLines.emplace_back(*m_draw, m_messagesDisplayer);
+    m_cachedMessageLines.back().SetParallelRender(false);
+  }
+
+  auto& cachedMessageLine = m_cachedMessageLines[m_numMessageLinesDrawn];
+  cachedMessageLine.SetText(message);
+  cachedMessageLine.Draw(pen, m_getFontColor, m_getOutlineFontColor);
+
+  ++m_numMessageLinesDrawn;
+}
+
 } // namespace GOOM::CONTROL
@@ -1,5 +1,6 @@
 module;
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -8,7 +9,9 @@ export module Goom.Control.GoomMessageDisplayer;
 import Goom.Color.ColorUtils;
 import Goom.Draw.GoomDrawBase;
 import Goom.Draw.ShaperDrawers.TextDrawer;
+import Goom.Utils.Text.CachedText;
 import Goom.Lib.GoomGraphic;
+import Goom.Lib.Point2d;
 
 using GOOM::COLOR::SimpleColors;
 using GOOM::DRAW::IGoomDraw;
@@ -42,6 +45,15 @@ private:
   Pixel m_currentTextColor;
   TextDrawer m_messagesDisplayer;
   [[nodiscard]] auto GetMessagesDisplayer(const std::string& messagesFontFile) const -> TextDrawer;
+  [[nodiscard]] auto GetFontColorFunc(float brightness) const -> TextDrawer::FontColorFunc;
+  TextDrawer::FontColorFunc m_getFontColor;
+  TextDrawer::FontColorFunc m_getOutlineFontColor;
+
+  // The messages are mostly the same from frame to frame, so each message line keeps its
+  // laid out text.
+  std::vector<UTILS::TEXT::CachedText> m_cachedMessageLines;
+  size_t m_numMessageLinesDrawn = 0U;
+  auto DrawMessageLine(const std::string& message, const Point2dInt& pen) -> void;
 };
 
 } // namespace GOOM::CONTROL
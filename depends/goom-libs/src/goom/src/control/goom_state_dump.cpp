@@ -197,6 +197,7 @@ auto GoomStateDump::DumpData(const std::string& directory) -> void
   SetCurrentDatedDirectory(directory);
 
   DumpSummary();
+  DumpStageTimings();
 
   DumpDataArray("update_times", m_cumulativeState->GetUpdateTimesInMs());
 
@@ -243,6 +244,65 @@ auto GoomStateDump::DumpSummary() const -> void
   out << std::format("Time Left:  {}\n", m_stopwatch->GetTimeValues().timeRemainingInMs);
 }
 
+auto GoomStateDump::DumpStageTimings() const -> void
+{
+  static constexpr auto* STAGE_TIMINGS_FILENAME = "stage_timings.dat";
+  auto out = std::ofstream{m_datedDirectory + "/" + STAGE_TIMINGS_FILENAME, std::ofstream::out};
+
+  static constexpr auto NS_PER_US = 1000.0;
+  const auto dumpTimings = [&out](const std::vector<GoomControl::StageTiming>& stageTimings)
+  {
+    out << std::format("{:<32} {:>8} {:>10} {:>10} {:>10} {:>10} {:>10}\n",
+                       "Stage",
+                       "Count",
+                       "Mean us",
+                       "P50 us",
+                       "P95 us",
+                       "P99 us",
+                       "Max us");
+    for (const auto& stageTiming : stageTimings)
+    {
+      const auto meanTimeInNs =
+          0 == stageTiming.numTimes ? 0.0
+                                    : static_cast<double>(stageTiming.totalTimeInNs) /
+                                          static_cast<double>(stageTiming.numTimes);
+      out << std::format("{:<32} {:>8} {:>10.1f} {:>10.1f} {:>10.1f} {:>10.1f} {:>10.1f}\n",
+                         stageTiming.stageName,
+                         stageTiming.numTimes,
+                         meanTimeInNs / NS_PER_US,
+                         static_cast<double>(stageTiming.medianTimeInNs) / NS_PER_US,
+                         static_cast<double>(stageTiming.p95TimeInNs) / NS_PER_US,
+                         static_cast<double>(stageTiming.p99TimeInNs) / NS_PER_US,
+                         static_cast<double>(stageTiming.maxTimeInNs) / NS_PER_US);
+    }
+  };
+
+  dumpTimings(m_goomControl->GetStageTimings());
+  out << "\n";
+  dumpTimings(m_goomControl->GetFxTimings());
+  out << "\n";
+
+  out << std::format("{:<32} {:>8} {:>12} {:>14} {:>10} {:>12} {:>10}\n",
+                     "Frame Arena",
+                     "Frames",
+                     "Allocs",
+                     "Bytes",
+                     "Max Allocs",
+                     "Max Bytes",
+                     "Block");
+  for (const auto& frameArenaUsage : m_goomControl->GetFrameArenaUsages())
+  {
+    out << std::format("{:<32} {:>8} {:>12} {:>14} {:>10} {:>12} {:>10}\n",
+                       frameArenaUsage.fxName,
+                       frameArenaUsage.numFrames,
+                       frameArenaUsage.totalNumAllocations,
+                       frameArenaUsage.totalNumBytes,
+                       frameArenaUsage.maxFrameNumAllocations,
+                       frameArenaUsage.maxFrameNumBytes,
+                       frameArenaUsage.blockSize);
+  }
+}
+
 template<typename T>
 auto GoomStateDump::DumpDataArray(const std::string& filename,
                                   const std::vector<T>& dataArray) const -> void
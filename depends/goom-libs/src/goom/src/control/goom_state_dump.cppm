@@ -71,6 +71,7 @@ private:
   std::string m_datedDirectory{};
   auto SetCurrentDatedDirectory(const std::string& parentDirectory) -> void;
   auto DumpSummary() const -> void;
+  auto DumpStageTimings() const -> void;
   template<typename T>
   auto DumpDataArray(const std::string& filename, const std::vector<T>& dataArray) const -> void;
   template<typename T>
@@ -8,6 +8,7 @@ module;
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 module Goom.Control.GoomTitleDisplayer;
 
@@ -16,6 +17,7 @@ import Goom.Color.ColorMaps;
 import Goom.Draw.GoomDrawBase;
 import Goom.Draw.ShaperDrawers.TextDrawer;
 import Goom.Utils.Math.Misc;
+import Goom.Utils.Text.CachedText;
 import Goom.Utils.Text.DrawableText;
 import Goom.Lib.GoomConfigPaths;
 import Goom.Lib.GoomGraphic;
@@ -35,6 +37,7 @@ using UTILS::MATH::GetFltFraction;
 using UTILS::MATH::GoomRand;
 using UTILS::MATH::I_HALF;
 using UTILS::MATH::NumberRange;
+using UTILS::TEXT::CachedText;
 using UTILS::TEXT::GetLeftAlignedPenForCentringStringAt;
 using UTILS::TEXT::GetLinesOfWords;
 
@@ -92,6 +95,7 @@ GoomTitleDisplayer::GoomTitleDisplayer(IGoomDraw& draw,
                                        const GoomRand& goomRand,
                                        const std::string& fontDirectory)
   : m_goomRand{&goomRand},
+    m_draw{&draw},
     m_textDrawer{std::make_unique<TextDrawer>(draw)},
     m_screenWidth{draw.GetDimensions().GetIntWidth()},
     m_screenHeight{draw.GetDimensions().GetIntHeight()},
@@ -224,25 +228,22 @@ void GoomTitleDisplayer::DrawText(const std::string& text)
     return m_textColorAdjust.GetAdjustment(textBrightness, color);
   };
 
-  const auto charSpacing = GetCharSpacing();
+  m_textDrawer->SetCharSpacing(GetCharSpacing());
 
-  const auto drawStr = [this, &charSpacing, &getFontColor, &getOutlineFontColor](
-                           const std::string& str, const Point2dInt& point)
+  const auto textStrings = GetLinesOfWords(text, MAX_LINE_LENGTH);
+  while (m_cachedTextLines.size() < textStrings.size())
   {
-    m_textDrawer->SetText(str);
-    m_textDrawer->SetFontColorFunc(getFontColor);
-    m_textDrawer->SetOutlineFontColorFunc(getOutlineFontColor);
-    m_textDrawer->SetCharSpacing(charSpacing);
-    m_textDrawer->Prepare();
-    m_textDrawer->Draw(point);
-  };
+    m_cachedTextLines.emplace_back(*m_draw, *m_textDrawer);
+  }
 
-  const auto textStrings = GetLinesOfWords(text, MAX_LINE_LENGTH);
   const auto lineSpacing = m_textDrawer->GetFontSize() + m_textDrawer->GetLineSpacing();
   auto y                 = static_cast<int32_t>(std::round(m_yPos));
-  for (const auto& str : textStrings)
+  for (auto i = 0U; i < textStrings.size(); ++i)
   {
-    drawStr(str, {.x = static_cast<int32_t>(std::round(m_xPos)), .y = y});
+    auto& cachedTextLine = m_cachedTextLines[i];
+    cachedTextLine.SetText(textStrings[i]);
+    cachedTextLine.Draw(
+        {.x = static_cast<int32_t>(std::round(m_xPos)), .y = y}, getFontColor, getOutlineFontColor);
     y += lineSpacing;
   }
 }
@@ -4,6 +4,7 @@ module;
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 export module Goom.Control.GoomTitleDisplayer;
 
@@ -14,6 +15,7 @@ import Goom.Draw.GoomDrawBase;
 import Goom.Draw.ShaperDrawers.TextDrawer;
 import Goom.Utils.Math.GoomRand;
 import Goom.Utils.Math.Misc;
+import Goom.Utils.Text.CachedText;
 import Goom.Lib.GoomGraphic;
 import Goom.Lib.GoomTypes;
 import Goom.Lib.Point2d;
@@ -49,7 +51,10 @@ private:
   float m_xPos                                      = 0.0F;
   float m_yPos                                      = 0.0F;
   int32_t m_timeLeftOfTitleDisplay                  = MAX_TEXT_DISPLAY_TIME;
+  DRAW::IGoomDraw* m_draw;
   std::unique_ptr<DRAW::SHAPE_DRAWERS::TextDrawer> m_textDrawer;
+  // One per line of the title, so it's only laid out again when the font size changes.
+  std::vector<UTILS::TEXT::CachedText> m_cachedTextLines;
   int32_t m_screenWidth;
   int32_t m_screenHeight;
   std::string m_fontDirectory;
@@ -0,0 +1,248 @@
+module;
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// SSE2 is always there on x86-64, so no runtime check is needed for the streaming stores.
+#if defined(__x86_64__) || defined(_M_X64)
+#include <emmintrin.h>
+#define GOOM_HAS_STREAMING_STORES
+#endif
+
+module Goom.Draw.DirtyTiles;
+
+import Goom.Lib.AssertUtils;
+import Goom.Lib.GoomGraphic;
+import Goom.Lib.GoomTypes;
+import Goom.Lib.Point2d;
+
+namespace GOOM::DRAW
+{
+
+namespace
+{
+
+[[nodiscard]] constexpr auto GetNumTilesSpanning(const uint32_t numPixels) noexcept -> uint32_t
+{
+  return (numPixels + (TileGrid::TILE_SIZE - 1)) >> TileGrid::TILE_SHIFT;
+}
+
+// Calls 'runFunc(y, xBegin, xEnd)' for each row of the flagged tiles. Neighbouring flagged
+// tiles are merged so each row is done with as few, and as long, runs as possible.
+template<typename RunFunc>
+auto ForEachTileRun(const Dimensions& dimensions,
+                    const DirtyTiles::TileMask& tileMask,
+                    const RunFunc& runFunc) noexcept -> void
+{
+  const auto width     = dimensions.GetWidth();
+  const auto height    = dimensions.GetHeight();
+  const auto numTilesX = GetNumTilesSpanning(width);
+  const auto numTilesY = GetNumTilesSpanning(height);
+  Expects(tileMask.size() == (static_cast<size_t>(numTilesX) * numTilesY));
+
+  for (auto tileY = 0U; tileY < numTilesY; ++tileY)
+  {
+    const auto yBegin = tileY * DirtyTiles::TILE_SIZE;
+    const auto yEnd   = std::min(yBegin + DirtyTiles::TILE_SIZE, height);
+    const auto flags  = std::span{tileMask}.subspan(static_cast<size_t>(tileY) * numTilesX,
+                                                   numTilesX);
+
+    auto tileX = 0U;
+    while (tileX < numTilesX)
+    {
+      if (0U == flags[tileX])
+      {
+        ++tileX;
+        continue;
+      }
+      const auto runBegin = tileX;
+      while ((tileX < numTilesX) and (0U != flags[tileX]))
+      {
+        ++tileX;
+      }
+
+      const auto xBegin = runBegin * DirtyTiles::TILE_SIZE;
+      const auto xEnd   = std::min(tileX * DirtyTiles::TILE_SIZE, width);
+      for (auto y = yBegin; y < yEnd; ++y)
+      {
+        runFunc(y, xBegin, xEnd);
+      }
+    }
+  }
+}
+
+auto StreamPixels(const std::span<const Pixel> srce, const std::span<Pixel> dest) noexcept
+    -> void
+{
+#ifdef GOOM_HAS_STREAMING_STORES
+  static constexpr auto STREAM_ALIGNMENT     = 16U;
+  static constexpr auto NUM_PIXELS_PER_STORE = STREAM_ALIGNMENT / sizeof(Pixel);
+
+  auto i = size_t{0};
+  // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast): Needed for the intrinsics.
+  // A destination that is not pixel aligned can never reach the stream alignment.
+  if ((reinterpret_cast<uintptr_t>(dest.data()) % sizeof(Pixel)) == 0)
+  {
+    while ((i < dest.size()) and
+           ((reinterpret_cast<uintptr_t>(&dest[i]) % STREAM_ALIGNMENT) != 0))
+    {
+      dest[i] = srce[i];
+      ++i;
+    }
+    for (; (i + NUM_PIXELS_PER_STORE) <= dest.size(); i += NUM_PIXELS_PER_STORE)
+    {
+      _mm_stream_si128(reinterpret_cast<__m128i*>(&dest[i]),
+                       _mm_loadu_si128(reinterpret_cast<const __m128i*>(&srce[i])));
+    }
+  }
+  // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+  std::copy(srce.begin() + static_cast<std::ptrdiff_t>(i),
+            srce.end(),
+            dest.begin() + static_cast<std::ptrdiff_t>(i));
+#else
+  std::ranges::copy(srce, dest.begin());
+#endif
+}
+
+} // namespace
+
+TileGrid::TileGrid(const Dimensions& dimensions) noexcept
+  : m_dimensions{dimensions},
+    m_numTilesX{GetNumTilesSpanning(dimensions.GetWidth())},
+    m_numTilesY{GetNumTilesSpanning(dimensions.GetHeight())}
+{
+}
+
+DirtyTiles::DirtyTiles(const Dimensions& dimensions) noexcept
+  : m_tileGrid{dimensions}, m_dirtyFlags(m_tileGrid.GetNumTiles())
+{
+  MarkAll();
+}
+
+auto DirtyTiles::MarkRectangle(const Point2dInt& topLeft, const Point2dInt& bottomRight) noexcept
+    -> void
+{
+  const auto maxX = m_tileGrid.GetDimensions().GetIntWidth() - 1;
+  const auto maxY = m_tileGrid.GetDimensions().GetIntHeight() - 1;
+  if ((bottomRight.x < 0) or (bottomRight.y < 0) or (topLeft.x > maxX) or (topLeft.y > maxY))
+  {
+    return;
+  }
+
+  const auto firstTileX = static_cast<uint32_t>(std::max(topLeft.x, 0)) >> TILE_SHIFT;
+  const auto firstTileY = static_cast<uint32_t>(std::max(topLeft.y, 0)) >> TILE_SHIFT;
+  const auto lastTileX  = static_cast<uint32_t>(std::min(bottomRight.x, maxX)) >> TILE_SHIFT;
+  const auto lastTileY  = static_cast<uint32_t>(std::min(bottomRight.y, maxY)) >> TILE_SHIFT;
+  for (auto tileY = firstTileY; tileY <= lastTileY; ++tileY)
+  {
+    for (auto tileX = firstTileX; tileX <= lastTileX; ++tileX)
+    {
+      MarkTile((tileY * m_tileGrid.GetNumTilesX()) + tileX);
+    }
+  }
+}
+
+auto DirtyTiles::MarkAll() noexcept -> void
+{
+  for (auto& dirtyFlag : m_dirtyFlags)
+  {
+    dirtyFlag.store(1U, std::memory_order_relaxed);
+  }
+}
+
+auto DirtyTiles::Clear() noexcept -> void
+{
+  for (auto& dirtyFlag : m_dirtyFlags)
+  {
+    dirtyFlag.store(0U, std::memory_order_relaxed);
+  }
+}
+
+auto DirtyTiles::GetNumDirtyTiles() const noexcept -> uint32_t
+{
+  return static_cast<uint32_t>(std::ranges::count_if(
+      m_dirtyFlags,
+      [](const std::atomic<uint8_t>& dirtyFlag)
+      { return 0U != dirtyFlag.load(std::memory_order_relaxed); }));
+}
+
+auto DirtyTiles::GetDirtyTileIndexes(std::vector<uint32_t>& tileIndexes) const noexcept -> void
+{
+  tileIndexes.clear();
+  for (auto i = 0U; i < m_dirtyFlags.size(); ++i)
+  {
+    if (0U != m_dirtyFlags[i].load(std::memory_order_relaxed))
+    {
+      tileIndexes.emplace_back(i);
+    }
+  }
+}
+
+auto DirtyTiles::AddToTileMask(TileMask& tileMask) const noexcept -> void
+{
+  Expects(tileMask.size() == m_dirtyFlags.size());
+
+  for (auto i = 0U; i < tileMask.size(); ++i)
+  {
+    tileMask[i] |= m_dirtyFlags[i].load(std::memory_order_relaxed);
+  }
+}
+
+auto DirtyTiles::GetTileMask() const noexcept -> TileMask
+{
+  auto tileMask = TileMask(m_dirtyFlags.size(), 0U);
+  AddToTileMask(tileMask);
+  return tileMask;
+}
+
+auto FillTiles(PixelBuffer& buffer,
+               const DirtyTiles::TileMask& tileMask,
+               const Pixel& pixel) noexcept -> void
+{
+  const auto dimensions = Dimensions{buffer.GetWidth(), buffer.GetHeight()};
+  const auto pixels     = buffer.GetPixelBuffer();
+
+  ForEachTileRun(
+      dimensions,
+      tileMask,
+      [&pixels, &buffer, &pixel](const uint32_t y, const uint32_t xBegin, const uint32_t xEnd)
+      {
+        const auto rowStart =
+            buffer.GetBuffPos(static_cast<size_t>(xBegin), static_cast<size_t>(y));
+        std::fill_n(pixels.begin() + static_cast<std::ptrdiff_t>(rowStart), xEnd - xBegin, pixel);
+      });
+}
+
+auto CopyTiles(const PixelBuffer& srceBuffer,
+               PixelBuffer& destBuffer,
+               const DirtyTiles::TileMask& tileMask) noexcept -> void
+{
+  Expects(srceBuffer.GetWidth() == destBuffer.GetWidth());
+  Expects(srceBuffer.GetHeight() == destBuffer.GetHeight());
+
+  const auto dimensions = Dimensions{srceBuffer.GetWidth(), srceBuffer.GetHeight()};
+  const auto srce       = std::span<const Pixel>{srceBuffer.GetPixelBuffer()};
+  const auto dest       = destBuffer.GetPixelBuffer();
+
+  ForEachTileRun(
+      dimensions,
+      tileMask,
+      [&srce, &dest, &srceBuffer](const uint32_t y, const uint32_t xBegin, const uint32_t xEnd)
+      {
+        const auto rowStart =
+            srceBuffer.GetBuffPos(static_cast<size_t>(xBegin), static_cast<size_t>(y));
+        const auto runLen = static_cast<size_t>(xEnd - xBegin);
+        StreamPixels(srce.subspan(rowStart, runLen), dest.subspan(rowStart, runLen));
+      });
+
+#ifdef GOOM_HAS_STREAMING_STORES
+  // Make the streamed pixels visible before the buffer is handed over.
+  _mm_sfence();
+#endif
+}
+
+} // namespace GOOM::DRAW
@@ -0,0 +1,226 @@
+module;
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+export module Goom.Draw.DirtyTiles;
+
+import Goom.Lib.AssertUtils;
+import Goom.Lib.GoomGraphic;
+import Goom.Lib.GoomTypes;
+import Goom.Lib.Point2d;
+
+export namespace GOOM::DRAW
+{
+
+// The geometry of the square tiles covering a screen sized buffer.
+class TileGrid
+{
+public:
+  static constexpr auto TILE_SHIFT = 6U;
+  static constexpr auto TILE_SIZE  = 1U << TILE_SHIFT;
+
+  // Tiles on the right and bottom edges are short if the buffer is not a multiple of the
+  // tile size.
+  struct TileBounds
+  {
+    uint32_t xBegin;
+    uint32_t xEnd;
+    uint32_t yBegin;
+    uint32_t yEnd;
+  };
+
+  explicit TileGrid(const Dimensions& dimensions) noexcept;
+
+  [[nodiscard]] auto GetDimensions() const noexcept -> const Dimensions&;
+  [[nodiscard]] auto GetNumTilesX() const noexcept -> uint32_t;
+  [[nodiscard]] auto GetNumTilesY() const noexcept -> uint32_t;
+  [[nodiscard]] auto GetNumTiles() const noexcept -> uint32_t;
+
+  [[nodiscard]] auto GetTileIndex(const Point2dInt& point) const noexcept -> uint32_t;
+  [[nodiscard]] auto GetTileBounds(uint32_t tileIndex) const noexcept -> TileBounds;
+
+private:
+  Dimensions m_dimensions;
+  uint32_t m_numTilesX;
+  uint32_t m_numTilesY;
+};
+
+// Keeps track of which square tiles of a screen sized buffer have been drawn to, so
+// buffer clears and copies only need to touch those tiles.
+class DirtyTiles
+{
+public:
+  static constexpr auto TILE_SHIFT = TileGrid::TILE_SHIFT;
+  static constexpr auto TILE_SIZE  = TileGrid::TILE_SIZE;
+
+  // One flag per tile, in row major order.
+  using TileMask   = std::vector<uint8_t>;
+  using TileBounds = TileGrid::TileBounds;
+
+  // All the tiles start off dirty, so the first clear covers the whole buffer.
+  explicit DirtyTiles(const Dimensions& dimensions) noexcept;
+
+  [[nodiscard]] auto GetTileGrid() const noexcept -> const TileGrid&;
+  [[nodiscard]] auto GetDimensions() const noexcept -> const Dimensions&;
+  [[nodiscard]] auto GetNumTilesX() const noexcept -> uint32_t;
+  [[nodiscard]] auto GetNumTilesY() const noexcept -> uint32_t;
+  [[nodiscard]] auto GetNumTiles() const noexcept -> uint32_t;
+
+  [[nodiscard]] auto GetTileIndex(const Point2dInt& point) const noexcept -> uint32_t;
+  [[nodiscard]] auto GetTileBounds(uint32_t tileIndex) const noexcept -> TileBounds;
+
+  // Safe to call from several threads at once.
+  auto MarkPoint(const Point2dInt& point) noexcept -> void;
+  auto MarkTile(uint32_t tileIndex) noexcept -> void;
+  // Marks the tiles under 'length' pixels along a row, starting at 'start'.
+  auto MarkHorizontalSpan(const Point2dInt& start, uint32_t length) noexcept -> void;
+  // Marks the tiles under the rectangle, clipped to the buffer. Both corners are inclusive.
+  auto MarkRectangle(const Point2dInt& topLeft, const Point2dInt& bottomRight) noexcept -> void;
+  auto MarkAll() noexcept -> void;
+  auto Clear() noexcept -> void;
+
+  [[nodiscard]] auto IsDirty(uint32_t tileIndex) const noexcept -> bool;
+  [[nodiscard]] auto GetNumDirtyTiles() const noexcept -> uint32_t;
+  // Replaces the contents of 'tileIndexes', so a reused vector keeps its capacity.
+  auto GetDirtyTileIndexes(std::vector<uint32_t>& tileIndexes) const noexcept -> void;
+  // Sets the flags in 'tileMask' of all the dirty tiles. Other flags are left alone.
+  auto AddToTileMask(TileMask& tileMask) const noexcept -> void;
+  [[nodiscard]] auto GetTileMask() const noexcept -> TileMask;
+
+private:
+  TileGrid m_tileGrid;
+  std::vector<std::atomic<uint8_t>> m_dirtyFlags;
+};
+
+// Only the tiles flagged in 'tileMask' are touched.
+auto FillTiles(PixelBuffer& buffer,
+               const DirtyTiles::TileMask& tileMask,
+               const Pixel& pixel) noexcept -> void;
+// Uses non-temporal stores where possible - the destination is normally memory that is
+// only read by the gpu, so there's no point in pulling it into the cache.
+auto CopyTiles(const PixelBuffer& srceBuffer,
+               PixelBuffer& destBuffer,
+               const DirtyTiles::TileMask& tileMask) noexcept -> void;
+
+} // namespace GOOM::DRAW
+
+namespace GOOM::DRAW
+{
+
+inline auto TileGrid::GetDimensions() const noexcept -> const Dimensions&
+{
+  return m_dimensions;
+}
+
+inline auto TileGrid::GetNumTilesX() const noexcept -> uint32_t
+{
+  return m_numTilesX;
+}
+
+inline auto TileGrid::GetNumTilesY() const noexcept -> uint32_t
+{
+  return m_numTilesY;
+}
+
+inline auto TileGrid::GetNumTiles() const noexcept -> uint32_t
+{
+  return m_numTilesX * m_numTilesY;
+}
+
+inline auto TileGrid::GetTileIndex(const Point2dInt& point) const noexcept -> uint32_t
+{
+  return ((static_cast<uint32_t>(point.y) >> TILE_SHIFT) * m_numTilesX) +
+         (static_cast<uint32_t>(point.x) >> TILE_SHIFT);
+}
+
+inline auto TileGrid::GetTileBounds(const uint32_t tileIndex) const noexcept -> TileBounds
+{
+  Expects(tileIndex < GetNumTiles());
+
+  const auto xBegin = (tileIndex % m_numTilesX) * TILE_SIZE;
+  const auto yBegin = (tileIndex / m_numTilesX) * TILE_SIZE;
+  return {
+      .xBegin = xBegin,
+      .xEnd   = std::min(xBegin + TILE_SIZE, m_dimensions.GetWidth()),
+      .yBegin = yBegin,
+      .yEnd   = std::min(yBegin + TILE_SIZE, m_dimensions.GetHeight()),
+  };
+}
+
+inline auto DirtyTiles::GetTileGrid() const noexcept -> const TileGrid&
+{
+  return m_tileGrid;
+}
+
+inline auto DirtyTiles::GetDimensions() const noexcept -> const Dimensions&
+{
+  return m_tileGrid.GetDimensions();
+}
+
+inline auto DirtyTiles::GetNumTilesX() const noexcept -> uint32_t
+{
+  return m_tileGrid.GetNumTilesX();
+}
+
+inline auto DirtyTiles::GetNumTilesY() const noexcept -> uint32_t
+{
+  return m_tileGrid.GetNumTilesY();
+}
+
+inline auto DirtyTiles::GetNumTiles() const noexcept -> uint32_t
+{
+  return m_tileGrid.GetNumTiles();
+}
+
+inline auto DirtyTiles::GetTileIndex(const Point2dInt& point) const noexcept -> uint32_t
+{
+  return m_tileGrid.GetTileIndex(point);
+}
+
+inline auto DirtyTiles::GetTileBounds(const uint32_t tileIndex) const noexcept -> TileBounds
+{
+  return m_tileGrid.GetTileBounds(tileIndex);
+}
+
+inline auto DirtyTiles::MarkPoint(const Point2dInt& point) noexcept -> void
+{
+  MarkTile(GetTileIndex(point));
+}
+
+inline auto DirtyTiles::MarkTile(const uint32_t tileIndex) noexcept -> void
+{
+  // Check first - most pixels land in already dirty tiles, and a plain load doesn't
+  // bounce the cache line between drawing threads.
+  auto& dirtyFlag = m_dirtyFlags[tileIndex];
+  if (0U == dirtyFlag.load(std::memory_order_relaxed))
+  {
+    dirtyFlag.store(1U, std::memory_order_relaxed);
+  }
+}
+
+inline auto DirtyTiles::MarkHorizontalSpan(const Point2dInt& start, const uint32_t length) noexcept
+    -> void
+{
+  Expects(length > 0U);
+
+  const auto rowTileIndex =
+      (static_cast<uint32_t>(start.y) >> TILE_SHIFT) * m_tileGrid.GetNumTilesX();
+  const auto firstTileX   = static_cast<uint32_t>(start.x) >> TILE_SHIFT;
+  const auto lastTileX    = (static_cast<uint32_t>(start.x) + (length - 1)) >> TILE_SHIFT;
+  for (auto tileX = firstTileX; tileX <= lastTileX; ++tileX)
+  {
+    MarkTile(rowTileIndex + tileX);
+  }
+}
+
+inline auto DirtyTiles::IsDirty(const uint32_t tileIndex) const noexcept -> bool
+{
+  Expects(tileIndex < GetNumTiles());
+
+  return 0U != m_dirtyFlags[tileIndex].load(std::memory_order_relaxed);
+}
+
+} // namespace GOOM::DRAW
@@ -1,8 +1,12 @@
 module;
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <span>
 
 export module Goom.Draw.GoomDrawBase;
 
@@ -29,6 +33,14 @@ struct MultiplePixels
 [[nodiscard]] auto GetMainColor(const MultiplePixels& colors) noexcept -> Pixel;
 [[nodiscard]] auto GetLowColor(const MultiplePixels& colors) noexcept -> Pixel;
 
+// Blends a run of colors, one 'colors' entry per pixel, into one or two rows with a row
+// blend. 'pixels2' is empty for single buffer devices.
+auto BlendPixelRunRows(UTILS::GRAPHICS::PixelBlendRowType blendType,
+                       uint32_t intBuffIntensity,
+                       std::span<const MultiplePixels> colors,
+                       std::span<Pixel> pixels1,
+                       std::span<Pixel> pixels2) noexcept -> void;
+
 class IGoomDraw
 {
 public:
@@ -42,6 +54,7 @@ public:
 
   [[nodiscard]] auto GetDimensions() const noexcept -> const Dimensions&;
 
+  static constexpr float DEFAULT_BUFF_INTENSITY = 0.5F;
   [[nodiscard]] auto GetBuffIntensity() const noexcept -> float;
   auto SetBuffIntensity(float val) noexcept -> void;
 
@@ -54,6 +67,15 @@ public:
 
   auto DrawPixels(const Point2dInt& point, const MultiplePixels& colors) noexcept -> void;
   auto DrawClippedPixels(const Point2dInt& point, const MultiplePixels& colors) noexcept -> void;
+  // Draw 'length' pixels along a row, all with the same colors. The whole span must be
+  // on screen.
+  auto DrawHorizontalSpan(const Point2dInt& start,
+                          uint32_t length,
+                          const MultiplePixels& colors) noexcept -> void;
+  // Draw consecutive pixels along a row, one 'colors' entry per pixel. The whole run must
+  // be on screen.
+  auto DrawPixelRun(const Point2dInt& start, std::span<const MultiplePixels> colors) noexcept
+      -> void;
 
   [[nodiscard]] virtual auto GetPixel(const Point2dInt& point) const noexcept -> Pixel = 0;
   virtual auto DrawPixelsUnblended(const Point2dInt& point, const MultiplePixels& colors) noexcept
@@ -72,18 +94,35 @@ protected:
 
   virtual auto DrawPixelsToDevice(const Point2dInt& point, const MultiplePixels& colors) noexcept
       -> void = 0;
+  // These default to drawing one pixel at a time. Devices that can get at a whole row
+  // should override them.
+  virtual auto DrawHorizontalSpanToDevice(const Point2dInt& start,
+                                          uint32_t length,
+                                          const MultiplePixels& colors) noexcept -> void;
+  virtual auto DrawPixelRunToDevice(const Point2dInt& start,
+                                    std::span<const MultiplePixels> colors) noexcept -> void;
+
+  // Blend whole rows with the current blend function, so the choice of blend is made once
+  // per row, not once per pixel. The default blend uses the SIMD row kernels. 'pixels2' is
+  // empty for single buffer devices.
+  auto BlendHorizontalSpan(const MultiplePixels& colors,
+                           std::span<Pixel> pixels1,
+                           std::span<Pixel> pixels2) const noexcept -> void;
+  auto BlendPixelRun(std::span<const MultiplePixels> colors,
+                     std::span<Pixel> pixels1,
+                     std::span<Pixel> pixels2) const noexcept -> void;
 
 private:
   Dimensions m_dimensions;
 
   PixelBlendFunc m_pixelBlendFunc;
+  bool m_usingDefaultPixelBlendFunc = true;
   [[nodiscard]] static auto GetColorAddPixelBlend(const Pixel& bgndColor,
                                                   uint32_t intBuffIntensity,
                                                   const Pixel& fgndColor,
                                                   PixelChannelType newAlpha) noexcept -> Pixel;
-  static constexpr float DEFAULT_BUFF_INTENSITY = 0.5F;
-  float m_buffIntensity                         = DEFAULT_BUFF_INTENSITY;
-  uint32_t m_intBuffIntensity                   = GetIntBuffIntensity(DEFAULT_BUFF_INTENSITY);
+  float m_buffIntensity       = DEFAULT_BUFF_INTENSITY;
+  uint32_t m_intBuffIntensity = GetIntBuffIntensity(DEFAULT_BUFF_INTENSITY);
 };
 
 } // namespace GOOM::DRAW
@@ -117,6 +156,38 @@ inline auto GetLowColor(const MultiplePixels& colors) noexcept -> Pixel
   return colors.color2;
 }
 
+inline auto BlendPixelRunRows(const UTILS::GRAPHICS::PixelBlendRowType blendType,
+                              const uint32_t intBuffIntensity,
+                              const std::span<const MultiplePixels> colors,
+                              const std::span<Pixel> pixels1,
+                              const std::span<Pixel> pixels2) noexcept -> void
+{
+  // The row kernels want the fgnd colors of each buffer together, so they're gathered a
+  // chunk at a time.
+  static constexpr auto CHUNK_SIZE = 64U;
+  auto fgndColors                  = std::array<Pixel, CHUNK_SIZE>{};
+
+  const auto blendChunks = [blendType, intBuffIntensity, &colors, &fgndColors](
+                               const std::span<Pixel> pixels, const auto getColor)
+  {
+    for (auto chunkStart = 0U; chunkStart < pixels.size(); chunkStart += CHUNK_SIZE)
+    {
+      const auto chunkSize = std::min<size_t>(CHUNK_SIZE, pixels.size() - chunkStart);
+      for (auto i = 0U; i < chunkSize; ++i)
+      {
+        fgndColors[i] = getColor(colors[chunkStart + i]);
+      }
+      UTILS::GRAPHICS::BlendPixelRow(blendType,
+                                     intBuffIntensity,
+                                     std::span{fgndColors}.first(chunkSize),
+                                     pixels.subspan(chunkStart, chunkSize));
+    }
+  };
+
+  blendChunks(pixels1, [](const MultiplePixels& pixelColors) { return pixelColors.color1; });
+  blendChunks(pixels2, [](const MultiplePixels& pixelColors) { return pixelColors.color2; });
+}
+
 inline auto IGoomDraw::GetDimensions() const noexcept -> const Dimensions&
 {
   return m_dimensions;
@@ -146,7 +217,8 @@ inline auto IGoomDraw::GetIntBuffIntensity() const noexcept -> uint32_t
 
 inline auto IGoomDraw::SetPixelBlendFunc(const PixelBlendFunc& func) noexcept -> void
 {
-  m_pixelBlendFunc = func;
+  m_pixelBlendFunc             = func;
+  m_usingDefaultPixelBlendFunc = false;
 }
 
 inline auto IGoomDraw::SetDefaultPixelBlendFunc() noexcept -> void
@@ -156,6 +228,7 @@ inline auto IGoomDraw::SetDefaultPixelBlendFunc() noexcept -> void
                         const Pixel& fgndColor,
                         const PixelChannelType newAlpha)
   { return GetColorAddPixelBlend(bgndColor, intBuffIntensity, fgndColor, newAlpha); };
+  m_usingDefaultPixelBlendFunc = true;
 }
 
 inline auto IGoomDraw::GetBlendedPixel(const Pixel& bgndColor,
@@ -189,6 +262,110 @@ inline auto IGoomDraw::DrawClippedPixels(const Point2dInt& point,
   DrawPixelsToDevice(point, colors);
 }
 
+inline auto IGoomDraw::DrawHorizontalSpan(const Point2dInt& start,
+                                          const uint32_t length,
+                                          const MultiplePixels& colors) noexcept -> void
+{
+  Expects(start.x >= 0);
+  Expects(start.y >= 0);
+  Expects(static_cast<uint32_t>(start.x) + length <= m_dimensions.GetWidth());
+  Expects(start.y < m_dimensions.GetIntHeight());
+
+  if (0U == length)
+  {
+    return;
+  }
+
+  DrawHorizontalSpanToDevice(start, length, colors);
+}
+
+inline auto IGoomDraw::DrawPixelRun(const Point2dInt& start,
+                                    const std::span<const MultiplePixels> colors) noexcept -> void
+{
+  Expects(start.x >= 0);
+  Expects(start.y >= 0);
+  Expects(static_cast<size_t>(start.x) + colors.size() <= m_dimensions.GetWidth());
+  Expects(start.y < m_dimensions.GetIntHeight());
+
+  if (colors.empty())
+  {
+    return;
+  }
+
+  DrawPixelRunToDevice(start, colors);
+}
+
+inline auto IGoomDraw::DrawHorizontalSpanToDevice(const Point2dInt& start,
+                                                  const uint32_t length,
+                                                  const MultiplePixels& colors) noexcept -> void
+{
+  const auto xEnd = start.x + static_cast<int32_t>(length);
+  for (auto x = start.x; x < xEnd; ++x)
+  {
+    DrawPixelsToDevice({.x = x, .y = start.y}, colors);
+  }
+}
+
+inline auto IGoomDraw::DrawPixelRunToDevice(const Point2dInt& start,
+                                            const std::span<const MultiplePixels> colors) noexcept
+    -> void
+{
+  auto point = start;
+  for (const auto& pixelColors : colors)
+  {
+    DrawPixelsToDevice(point, pixelColors);
+    ++point.x;
+  }
+}
+
+inline auto IGoomDraw::BlendHorizontalSpan(const MultiplePixels& colors,
+                                           const std::span<Pixel> pixels1,
+                                           const std::span<Pixel> pixels2) const noexcept -> void
+{
+  const auto blendRow = [this](const Pixel& color, const std::span<Pixel> pixels)
+  {
+    if (m_usingDefaultPixelBlendFunc)
+    {
+      UTILS::GRAPHICS::BlendPixelRow(
+          UTILS::GRAPHICS::PixelBlendRowType::COLOR_ADD, m_intBuffIntensity, color, pixels);
+      return;
+    }
+    for (auto& pixel : pixels)
+    {
+      pixel = m_pixelBlendFunc(pixel, m_intBuffIntensity, color, color.A());
+    }
+  };
+
+  blendRow(colors.color1, pixels1);
+  blendRow(colors.color2, pixels2);
+}
+
+inline auto IGoomDraw::BlendPixelRun(const std::span<const MultiplePixels> colors,
+                                     const std::span<Pixel> pixels1,
+                                     const std::span<Pixel> pixels2) const noexcept -> void
+{
+  if (m_usingDefaultPixelBlendFunc)
+  {
+    BlendPixelRunRows(UTILS::GRAPHICS::PixelBlendRowType::COLOR_ADD,
+                      m_intBuffIntensity,
+                      colors,
+                      pixels1,
+                      pixels2);
+    return;
+  }
+
+  for (auto i = 0U; i < pixels1.size(); ++i)
+  {
+    const auto& color1 = colors[i].color1;
+    pixels1[i]         = m_pixelBlendFunc(pixels1[i], m_intBuffIntensity, color1, color1.A());
+  }
+  for (auto i = 0U; i < pixels2.size(); ++i)
+  {
+    const auto& color2 = colors[i].color2;
+    pixels2[i]         = m_pixelBlendFunc(pixels2[i], m_intBuffIntensity, color2, color2.A());
+  }
+}
+
 inline auto IGoomDraw::GetColorAddPixelBlend(const Pixel& bgndColor,
                                              const uint32_t intBuffIntensity,
                                              const Pixel& fgndColor,
@@ -0,0 +1,366 @@
+module;
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+export module Goom.Draw.GoomDrawTo;
+
+import Goom.Draw.DirtyTiles;
+import Goom.Draw.GoomDrawBase;
+import Goom.Draw.GoomDrawToBuffer;
+import Goom.Utils.Graphics.PixelBlend;
+import Goom.Lib.AssertUtils;
+import Goom.Lib.GoomGraphic;
+import Goom.Lib.GoomTypes;
+import Goom.Lib.Point2d;
+
+export namespace GOOM::DRAW
+{
+
+// What happens to a fully transparent bgnd pixel, as left by clearing the buffers. The
+// random pixel blenders of the visual fx don't blend with it, they just take the fgnd
+// color.
+enum class TransparentBgnd : UnderlyingEnumType
+{
+  BLEND,
+  USE_FGND,
+};
+
+// A draw target with the number of buffers and the blend fixed at compile time, so the
+// shape drawers' inner loops inline down to the blend itself - no virtual calls and no
+// std::function calls. It has the same drawing interface as IGoomDraw, so the shape
+// drawers can be instantiated with either. Use IGoomDraw when the blend has to be changed
+// at runtime.
+template<uint32_t NUM_BUFFERS,
+         UTILS::GRAPHICS::PixelBlendRowType BLEND_TYPE,
+         TransparentBgnd TRANSPARENT_BGND = TransparentBgnd::BLEND>
+class GoomDrawTo
+{
+  static_assert((1U == NUM_BUFFERS) or (2U == NUM_BUFFERS));
+
+public:
+  using Buffers = std::array<PixelBuffer*, NUM_BUFFERS>;
+
+  // Drawn pixels are also marked in 'dirtyTiles', if it's not null.
+  GoomDrawTo(const Dimensions& dimensions,
+             const Buffers& buffers,
+             DirtyTiles* dirtyTiles) noexcept;
+  // Draws into the same buffers, with the same intensity, as 'draw', and marks the same
+  // dirty tiles. The blend of 'draw' is not used.
+  explicit GoomDrawTo(GoomDrawToTwoBuffers& draw) noexcept
+    requires(2U == NUM_BUFFERS);
+
+  [[nodiscard]] auto GetDimensions() const noexcept -> const Dimensions&;
+
+  [[nodiscard]] auto GetBuffIntensity() const noexcept -> float;
+  auto SetBuffIntensity(float val) noexcept -> void;
+
+  [[nodiscard]] auto GetPixel(const Point2dInt& point) const noexcept -> Pixel;
+
+  auto DrawPixels(const Point2dInt& point, const MultiplePixels& colors) noexcept -> void;
+  auto DrawClippedPixels(const Point2dInt& point, const MultiplePixels& colors) noexcept -> void;
+  auto DrawPixelsUnblended(const Point2dInt& point, const MultiplePixels& colors) noexcept
+      -> void;
+  // As for IGoomDraw, the whole span or run must be on screen.
+  auto DrawHorizontalSpan(const Point2dInt& start,
+                          uint32_t length,
+                          const MultiplePixels& colors) noexcept -> void;
+  auto DrawPixelRun(const Point2dInt& start, std::span<const MultiplePixels> colors) noexcept
+      -> void;
+
+private:
+  Dimensions m_dimensions;
+  Buffers m_buffers;
+  DirtyTiles* m_dirtyTiles;
+  float m_buffIntensity       = IGoomDraw::DEFAULT_BUFF_INTENSITY;
+  uint32_t m_intBuffIntensity = IGoomDraw::GetIntBuffIntensity(m_buffIntensity);
+
+  [[nodiscard]] static auto GetColor(const MultiplePixels& colors, uint32_t buffNum) noexcept
+      -> const Pixel&;
+  [[nodiscard]] auto GetRow(uint32_t buffNum, size_t buffPos, size_t length) const noexcept
+      -> std::span<Pixel>;
+  [[nodiscard]] auto GetBlendedPixel(const Pixel& bgndColor, const Pixel& fgndColor) const noexcept
+      -> Pixel;
+  auto DrawPixelsToDevice(const Point2dInt& point, const MultiplePixels& colors) noexcept
+      -> void;
+  auto MarkDirty(const Point2dInt& start, uint32_t length) noexcept -> void;
+};
+
+} // namespace GOOM::DRAW
+
+namespace GOOM::DRAW
+{
+
+template<uint32_t NUM_BUFFERS,
+         UTILS::GRAPHICS::PixelBlendRowType BLEND_TYPE,
+         TransparentBgnd TRANSPARENT_BGND>
+inline GoomDrawTo<NUM_BUFFERS, BLEND_TYPE, TRANSPARENT_BGND>::GoomDrawTo(
+    const Dimensions& dimensions, const Buffers& buffers, DirtyTiles* const dirtyTiles) noexcept
+  : m_dimensions{dimensions}, m_buffers{buffers}, m_dirtyTiles{dirtyTiles}
+{
+  for (const auto* buffer : m_buffers)
+  {
+    Expects(buffer != nullptr);
+    Expects(buffer->GetWidth() == m_dimensions.GetWidth());
+    Expects(buffer->GetHeight() == m_dimensions.GetHeight());
+  }
+}
+
+template<uint32_t NUM_BUFFERS,
+         UTILS::GRAPHICS::PixelBlendRowType BLEND_TYPE,
+         TransparentBgnd TRANSPARENT_BGND>
+inline GoomDrawTo<NUM_BUFFERS, BLEND_TYPE, TRANSPARENT_BGND>::GoomDrawTo(
+    GoomDrawToTwoBuffers& draw) noexcept
+  requires(2U == NUM_BUFFERS)
+  : GoomDrawTo{draw.GetDimensions(),
+               {&draw.GetBuffer1(), &draw.GetBuffer2()},
+               &draw.GetDirtyTiles()}
+{
+  SetBuffIntensity(draw.GetBuffIntensity());
+}
+
+template<uint32_t NUM_BUFFERS,
+         UTILS::GRAPHICS::PixelBlendRowType BLEND_TYPE,
+         TransparentBgnd TRANSPARENT_BGND>
+inline auto GoomDrawTo<NUM_BUFFERS, BLEND_TYPE, TRANSPARENT_BGND>::GetDimensions() const noexcept
+    -> const Dimensions&
+{
+  return m_dimensions;
+}
+
+template<uint32_t NUM_BUFFERS,
+         UTILS::GRAPHICS::PixelBlendRowType BLEND_TYPE,
+         TransparentBgnd TRANSPARENT_BGND>
+inline auto GoomDrawTo<NUM_BUFFERS, BLEND_TYPE, TRANSPARENT_BGND>::GetBuffIntensity()
+    const noexcept -> float
+{
+  return m_buffIntensity;
+}
+
+template<uint32_t NUM_BUFFERS,
+         UTILS::GRAPHICS::PixelBlendRowType BLEND_TYPE,
+         TransparentBgnd TRANSPARENT_BGND>
+inline auto GoomDrawTo<NUM_BUFFERS, BLEND_TYPE, TRANSPARENT_BGND>::SetBuffIntensity(
+    const float val) noexcept -> void
+{
+  m_buffIntensity    = val;
+  m_intBuffIntensity = IGoomDraw::GetIntBuffIntensity(m_buffIntensity);
+}
+
+template<uint32_t NUM_BUFFERS,
+         UTILS::GRAPHICS::PixelBlendRowType BLEND_TYPE,
+         TransparentBgnd TRANSPARENT_BGND>
+inline auto GoomDrawTo<NUM_BUFFERS, BLEND_TYPE, TRANSPARENT_BGND>::GetColor(
+    const MultiplePixels& colors, const uint32_t buffNum) noexcept -> const Pixel&
+{
+  return 0U == buffNum ? colors.color1 : colors.color2;
+}
+
+template<uint32_t NUM_BUFFERS,
+         UTILS::GRAPHICS::PixelBlendRowType BLEND_TYPE,
+         TransparentBgnd TRANSPARENT_BGND>
+inline auto GoomDrawTo<NUM_BUFFERS, BLEND_TYPE, TRANSPARENT_BGND>::GetRow(
+    const uint32_t buffNum, const size_t buffPos, const size_t length) const noexcept
+    -> std::span<Pixel>
+{
+  return m_buffers[buffNum]->GetPixelBuffer().subspan(buffPos, length);
+}
+
+template<uint32_t NUM_BUFFERS,
+         UTILS::GRAPHICS::PixelBlendRowType BLEND_TYPE,
+         TransparentBgnd TRANSPARENT_BGND>
+inline auto GoomDrawTo<NUM_BUFFERS, BLEND_TYPE, TRANSPARENT_BGND>::GetBlendedPixel(
+    const Pixel& bgndColor, const Pixel& fgndColor) const noexcept -> Pixel
+{
+  if constexpr (TRANSPARENT_BGND == TransparentBgnd::USE_FGND)
+  {
+    if (0 == bgndColor.A())
+    {
+      return fgndColor;
+    }
+  }
+
+  return UTILS::GRAPHICS::GetPixelBlend<BLEND_TYPE>(
+      bgndColor, m_intBuffIntensity, fgndColor, fgndColor.A());
+}
+
+template<uint32_t NUM_BUFFERS,
+         UTILS::GRAPHICS::PixelBlendRowType BLEND_TYPE,
+         TransparentBgnd TRANSPARENT_BGND>
+inline auto GoomDrawTo<NUM_BUFFERS, BLEND_TYPE, TRANSPARENT_BGND>::MarkDirty(
+    const Point2dInt& start, const uint32_t length) noexcept -> void
+{
+  if (m_dirtyTiles == nullptr)
+  {
+    return;
+  }
+  if (1U == length)
+  {
+    m_dirtyTiles->MarkPoint(start);
+  }
+  else
+  {
+    m_dirtyTiles->MarkHorizontalSpan(start, length);
+  }
+}
+
+template<uint32_t NUM_BUFFERS,
+         UTILS::GRAPHICS::PixelBlendRowType BLEND_TYPE,
+         TransparentBgnd TRANSPARENT_BGND>
+inline auto GoomDrawTo<NUM_BUFFERS, BLEND_TYPE, TRANSPARENT_BGND>::GetPixel(
+    const Point2dInt& point) const noexcept -> Pixel
+{
+  return (*m_buffers[0])(point.x, point.y);
+}
+
+template<uint32_t NUM_BUFFERS,
+         UTILS::GRAPHICS::PixelBlendRowType BLEND_TYPE,
+         TransparentBgnd TRANSPARENT_BGND>
+inline auto GoomDrawTo<NUM_BUFFERS, BLEND_TYPE, TRANSPARENT_BGND>::DrawPixels(
+    const Point2dInt& point, const MultiplePixels& colors) noexcept -> void
+{
+  Expects(point.x >= 0);
+  Expects(point.y >= 0);
+  Expects(point.x < m_dimensions.GetIntWidth());
+  Expects(point.y < m_dimensions.GetIntHeight());
+
+  DrawPixelsToDevice(point, colors);
+}
+
+template<uint32_t NUM_BUFFERS,
+         UTILS::GRAPHICS::PixelBlendRowType BLEND_TYPE,
+         TransparentBgnd TRANSPARENT_BGND>
+inline auto GoomDrawTo<NUM_BUFFERS, BLEND_TYPE, TRANSPARENT_BGND>::DrawClippedPixels(
+    const Point2dInt& point, const MultiplePixels& colors) noexcept -> void
+{
+  if ((point.x < 0) or (point.y < 0) or (point.x >= m_dimensions.GetIntWidth()) or
+      (point.y >= m_dimensions.GetIntHeight()))
+  {
+    return;
+  }
+
+  DrawPixelsToDevice(point, colors);
+}
+
+template<uint32_t NUM_BUFFERS,
+         UTILS::GRAPHICS::PixelBlendRowType BLEND_TYPE,
+         TransparentBgnd TRANSPARENT_BGND>
+inline auto GoomDrawTo<NUM_BUFFERS, BLEND_TYPE, TRANSPARENT_BGND>::DrawPixelsToDevice(
+    const Point2dInt& point, const MultiplePixels& colors) noexcept -> void
+{
+  // All the buffers have the same dimensions, so one buffer position does for all of them.
+  const auto buffPos = m_buffers[0]->GetBuffPos(point.x, point.y);
+
+  for (auto buffNum = 0U; buffNum < NUM_BUFFERS; ++buffNum)
+  {
+    auto& pixel = m_buffers[buffNum]->GetPixel(buffPos);
+    pixel       = GetBlendedPixel(pixel, GetColor(colors, buffNum));
+  }
+
+  MarkDirty(point, 1U);
+}
+
+template<uint32_t NUM_BUFFERS,
+         UTILS::GRAPHICS::PixelBlendRowType BLEND_TYPE,
+         TransparentBgnd TRANSPARENT_BGND>
+inline auto GoomDrawTo<NUM_BUFFERS, BLEND_TYPE, TRANSPARENT_BGND>::DrawPixelsUnblended(
+    const Point2dInt& point, const MultiplePixels& colors) noexcept -> void
+{
+  const auto buffPos = m_buffers[0]->GetBuffPos(point.x, point.y);
+
+  for (auto buffNum = 0U; buffNum < NUM_BUFFERS; ++buffNum)
+  {
+    m_buffers[buffNum]->GetPixel(buffPos) = GetColor(colors, buffNum);
+  }
+
+  MarkDirty(point, 1U);
+}
+
+// The SIMD row kernels always blend, so a transparent bgnd that uses the fgnd is done a
+// pixel at a time.
+template<uint32_t NUM_BUFFERS,
+         UTILS::GRAPHICS::PixelBlendRowType BLEND_TYPE,
+         TransparentBgnd TRANSPARENT_BGND>
+inline auto GoomDrawTo<NUM_BUFFERS, BLEND_TYPE, TRANSPARENT_BGND>::DrawHorizontalSpan(
+    const Point2dInt& start, const uint32_t length, const MultiplePixels& colors) noexcept
+    -> void
+{
+  Expects(start.x >= 0);
+  Expects(start.y >= 0);
+  Expects(static_cast<uint32_t>(start.x) + length <= m_dimensions.GetWidth());
+  Expects(start.y < m_dimensions.GetIntHeight());
+
+  if (0U == length)
+  {
+    return;
+  }
+
+  const auto buffPos = m_buffers[0]->GetBuffPos(start.x, start.y);
+  for (auto buffNum = 0U; buffNum < NUM_BUFFERS; ++buffNum)
+  {
+    const auto& color = GetColor(colors, buffNum);
+    const auto pixels = GetRow(buffNum, buffPos, length);
+    if constexpr (TRANSPARENT_BGND == TransparentBgnd::USE_FGND)
+    {
+      for (auto& pixel : pixels)
+      {
+        pixel = GetBlendedPixel(pixel, color);
+      }
+    }
+    else
+    {
+      UTILS::GRAPHICS::BlendPixelRow(BLEND_TYPE, m_intBuffIntensity, color, pixels);
+    }
+  }
+
+  MarkDirty(start, length);
+}
+
+template<uint32_t NUM_BUFFERS,
+         UTILS::GRAPHICS::PixelBlendRowType BLEND_TYPE,
+         TransparentBgnd TRANSPARENT_BGND>
+inline auto GoomDrawTo<NUM_BUFFERS, BLEND_TYPE, TRANSPARENT_BGND>::DrawPixelRun(
+    const Point2dInt& start, const std::span<const MultiplePixels> colors) noexcept -> void
+{
+  Expects(start.x >= 0);
+  Expects(start.y >= 0);
+  Expects(static_cast<size_t>(start.x) + colors.size() <= m_dimensions.GetWidth());
+  Expects(start.y < m_dimensions.GetIntHeight());
+
+  if (colors.empty())
+  {
+    return;
+  }
+
+  const auto buffPos = m_buffers[0]->GetBuffPos(start.x, start.y);
+  if constexpr (TRANSPARENT_BGND == TransparentBgnd::USE_FGND)
+  {
+    for (auto buffNum = 0U; buffNum < NUM_BUFFERS; ++buffNum)
+    {
+      const auto pixels = GetRow(buffNum, buffPos, colors.size());
+      for (auto i = 0U; i < pixels.size(); ++i)
+      {
+        pixels[i] = GetBlendedPixel(pixels[i], GetColor(colors[i], buffNum));
+      }
+    }
+  }
+  else if constexpr (1U == NUM_BUFFERS)
+  {
+    BlendPixelRunRows(
+        BLEND_TYPE, m_intBuffIntensity, colors, GetRow(0U, buffPos, colors.size()), {});
+  }
+  else
+  {
+    BlendPixelRunRows(BLEND_TYPE,
+                      m_intBuffIntensity,
+                      colors,
+                      GetRow(0U, buffPos, colors.size()),
+                      GetRow(1U, buffPos, colors.size()));
+  }
+
+  MarkDirty(start, static_cast<uint32_t>(colors.size()));
+}
+
+} // namespace GOOM::DRAW
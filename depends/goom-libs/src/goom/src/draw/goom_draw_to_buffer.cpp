@@ -6,6 +6,7 @@ module;
 
 module Goom.Draw.GoomDrawToBuffer;
 
+import Goom.Draw.DirtyTiles;
 import Goom.Draw.GoomDrawBase;
 import Goom.Lib.AssertUtils;
 import Goom.Lib.GoomTypes;
@@ -25,7 +26,11 @@ GoomDrawToTwoBuffers::GoomDrawToTwoBuffers(const Dimensions& dimensions,
                                            GoomLogger& goomLogger,
                                            PixelBuffer& buffer1,
                                            PixelBuffer& buffer2) noexcept
-  : IGoomDraw{dimensions}, m_goomLogger{&goomLogger}, m_buffer1{&buffer1}, m_buffer2{&buffer2}
+  : IGoomDraw{dimensions},
+    m_goomLogger{&goomLogger},
+    m_buffer1{&buffer1},
+    m_buffer2{&buffer2},
+    m_dirtyTiles{dimensions}
 {
   Expects(buffer1.GetWidth() == dimensions.GetWidth());
   Expects(buffer2.GetWidth() == dimensions.GetWidth());
@@ -2,8 +2,12 @@ module;
 
 #include "goom/goom_logger.h"
 
+#include <cstdint>
+#include <span>
+
 export module Goom.Draw.GoomDrawToBuffer;
 
+import Goom.Draw.DirtyTiles;
 import Goom.Draw.GoomDrawBase;
 import Goom.Lib.GoomGraphic;
 import Goom.Lib.AssertUtils;
@@ -23,6 +27,8 @@ public:
   [[nodiscard]] auto GetBuffer() const noexcept -> const PixelBuffer&;
   [[nodiscard]] auto GetBuffer() noexcept -> PixelBuffer&;
   auto SetBuffer(PixelBuffer& buff) noexcept -> void;
+  // Drawn pixels are also marked in 'dirtyTiles'.
+  auto SetDirtyTiles(DirtyTiles& dirtyTiles) noexcept -> void;
 
   [[nodiscard]] auto GetPixel(const Point2dInt& point) const noexcept -> Pixel override;
   auto DrawPixelsUnblended(const Point2dInt& point, const MultiplePixels& colors) noexcept
@@ -31,10 +37,18 @@ public:
 protected:
   auto DrawPixelsToDevice(const Point2dInt& point, const MultiplePixels& colors) noexcept
       -> void override;
+  auto DrawHorizontalSpanToDevice(const Point2dInt& start,
+                                  uint32_t length,
+                                  const MultiplePixels& colors) noexcept -> void override;
+  auto DrawPixelRunToDevice(const Point2dInt& start,
+                            std::span<const MultiplePixels> colors) noexcept -> void override;
 
 private:
   [[maybe_unused]] GoomLogger* m_goomLogger;
   PixelBuffer* m_buffer{};
+  DirtyTiles* m_dirtyTiles = nullptr;
+  auto MarkDirty(const Point2dInt& point) noexcept -> void;
+  auto MarkDirty(const Point2dInt& start, uint32_t length) noexcept -> void;
 };
 
 class GoomDrawToTwoBuffers : public IGoomDraw
@@ -50,6 +64,11 @@ public:
   [[nodiscard]] auto GetBuffer2() const noexcept -> const PixelBuffer&;
   [[nodiscard]] auto GetBuffer2() noexcept -> PixelBuffer&;
 
+  // The tiles of both buffers that have been drawn to. Anything that writes to the
+  // buffers directly needs to mark the tiles it touches.
+  [[nodiscard]] auto GetDirtyTiles() const noexcept -> const DirtyTiles&;
+  [[nodiscard]] auto GetDirtyTiles() noexcept -> DirtyTiles&;
+
   [[nodiscard]] auto GetPixel(const Point2dInt& point) const noexcept -> Pixel override;
   auto DrawPixelsUnblended(const Point2dInt& point, const MultiplePixels& colors) noexcept
       -> void override;
@@ -57,11 +76,17 @@ public:
 protected:
   auto DrawPixelsToDevice(const Point2dInt& point, const MultiplePixels& colors) noexcept
       -> void override;
+  auto DrawHorizontalSpanToDevice(const Point2dInt& start,
+                                  uint32_t length,
+                                  const MultiplePixels& colors) noexcept -> void override;
+  auto DrawPixelRunToDevice(const Point2dInt& start,
+                            std::span<const MultiplePixels> colors) noexcept -> void override;
 
 private:
   [[maybe_unused]] GoomLogger* m_goomLogger;
   PixelBuffer* m_buffer1{};
   PixelBuffer* m_buffer2{};
+  DirtyTiles m_dirtyTiles;
 };
 
 } // namespace GOOM::DRAW
@@ -84,6 +109,28 @@ inline auto GoomDrawToSingleBuffer::SetBuffer(PixelBuffer& buff) noexcept -> voi
   m_buffer = &buff;
 }
 
+inline auto GoomDrawToSingleBuffer::SetDirtyTiles(DirtyTiles& dirtyTiles) noexcept -> void
+{
+  m_dirtyTiles = &dirtyTiles;
+}
+
+inline auto GoomDrawToSingleBuffer::MarkDirty(const Point2dInt& point) noexcept -> void
+{
+  if (m_dirtyTiles != nullptr)
+  {
+    m_dirtyTiles->MarkPoint(point);
+  }
+}
+
+inline auto GoomDrawToSingleBuffer::MarkDirty(const Point2dInt& start,
+                                              const uint32_t length) noexcept -> void
+{
+  if (m_dirtyTiles != nullptr)
+  {
+    m_dirtyTiles->MarkHorizontalSpan(start, length);
+  }
+}
+
 inline auto GoomDrawToSingleBuffer::GetPixel(const Point2dInt& point) const noexcept -> Pixel
 {
   Expects(m_buffer != nullptr);
@@ -96,6 +143,7 @@ inline auto GoomDrawToSingleBuffer::DrawPixelsUnblended(const Point2dInt& point,
     -> void
 {
   (*m_buffer)(point.x, point.y) = colors.color1;
+  MarkDirty(point);
 }
 
 inline auto GoomDrawToSingleBuffer::DrawPixelsToDevice(const Point2dInt& point,
@@ -106,6 +154,29 @@ inline auto GoomDrawToSingleBuffer::DrawPixelsToDevice(const Point2dInt& point,
 
   auto& pixel = m_buffer->GetPixel(buffPos);
   pixel       = GetBlendedPixel(pixel, GetIntBuffIntensity(), colors.color1, colors.color1.A());
+  MarkDirty(point);
+}
+
+inline auto GoomDrawToSingleBuffer::DrawHorizontalSpanToDevice(
+    const Point2dInt& start, const uint32_t length, const MultiplePixels& colors) noexcept -> void
+{
+  const auto pixels =
+      m_buffer->GetPixelBuffer().subspan(m_buffer->GetBuffPos(start.x, start.y), length);
+
+  BlendHorizontalSpan(colors, pixels, {});
+
+  MarkDirty(start, length);
+}
+
+inline auto GoomDrawToSingleBuffer::DrawPixelRunToDevice(
+    const Point2dInt& start, const std::span<const MultiplePixels> colors) noexcept -> void
+{
+  const auto pixels =
+      m_buffer->GetPixelBuffer().subspan(m_buffer->GetBuffPos(start.x, start.y), colors.size());
+
+  BlendPixelRun(colors, pixels, {});
+
+  MarkDirty(start, static_cast<uint32_t>(colors.size()));
 }
 
 inline auto GoomDrawToTwoBuffers::GetBuffer1() const noexcept -> const PixelBuffer&
@@ -128,6 +199,16 @@ inline auto GoomDrawToTwoBuffers::GetBuffer2() noexcept -> PixelBuffer&
   return *m_buffer2;
 }
 
+inline auto GoomDrawToTwoBuffers::GetDirtyTiles() const noexcept -> const DirtyTiles&
+{
+  return m_dirtyTiles;
+}
+
+inline auto GoomDrawToTwoBuffers::GetDirtyTiles() noexcept -> DirtyTiles&
+{
+  return m_dirtyTiles;
+}
+
 inline auto GoomDrawToTwoBuffers::GetPixel(const Point2dInt& point) const noexcept -> Pixel
 {
   return (*m_buffer1)(point.x, point.y);
@@ -140,6 +221,7 @@ inline auto GoomDrawToTwoBuffers::DrawPixelsUnblended(const Point2dInt& point,
 
   m_buffer1->GetPixel(buffPos) = colors.color1;
   m_buffer2->GetPixel(buffPos) = colors.color2;
+  m_dirtyTiles.MarkPoint(point);
 }
 
 inline auto GoomDrawToTwoBuffers::DrawPixelsToDevice(const Point2dInt& point,
@@ -152,6 +234,32 @@ inline auto GoomDrawToTwoBuffers::DrawPixelsToDevice(const Point2dInt& point,
 
   auto& pixel2 = m_buffer2->GetPixel(buffPos);
   pixel2       = GetBlendedPixel(pixel2, GetIntBuffIntensity(), colors.color2, colors.color2.A());
+
+  m_dirtyTiles.MarkPoint(point);
+}
+
+inline auto GoomDrawToTwoBuffers::DrawHorizontalSpanToDevice(
+    const Point2dInt& start, const uint32_t length, const MultiplePixels& colors) noexcept -> void
+{
+  const auto buffPos = m_buffer1->GetBuffPos(start.x, start.y);
+
+  BlendHorizontalSpan(colors,
+                      m_buffer1->GetPixelBuffer().subspan(buffPos, length),
+                      m_buffer2->GetPixelBuffer().subspan(buffPos, length));
+
+  m_dirtyTiles.MarkHorizontalSpan(start, length);
+}
+
+inline auto GoomDrawToTwoBuffers::DrawPixelRunToDevice(
+    const Point2dInt& start, const std::span<const MultiplePixels> colors) noexcept -> void
+{
+  const auto buffPos = m_buffer1->GetBuffPos(start.x, start.y);
+
+  BlendPixelRun(colors,
+                m_buffer1->GetPixelBuffer().subspan(buffPos, colors.size()),
+                m_buffer2->GetPixelBuffer().subspan(buffPos, colors.size()));
+
+  m_dirtyTiles.MarkHorizontalSpan(start, static_cast<uint32_t>(colors.size()));
 }
 
 } // namespace GOOM::DRAW
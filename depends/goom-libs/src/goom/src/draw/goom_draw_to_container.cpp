@@ -1,5 +1,6 @@
 module;
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
@@ -19,33 +20,26 @@ namespace GOOM::DRAW
 using COLOR::GetBrighterColorInt;
 
 GoomDrawToContainer::GoomDrawToContainer(const Dimensions& dimensions) noexcept
-  : IGoomDraw{dimensions}, m_xyPixelList(dimensions.GetHeight())
+  : IGoomDraw{dimensions},
+    m_generations(dimensions.GetSize(), 0U),
+    m_counts(dimensions.GetSize(), 0U),
+    m_colorsArrays(dimensions.GetSize())
 {
-  for (auto& xPixelList : m_xyPixelList)
-  {
-    xPixelList.resize(dimensions.GetWidth());
-  }
 }
 
 auto GoomDrawToContainer::ClearAll() noexcept -> void
 {
   m_orderedXYPixelList.clear();
 
-  for (auto& xPixelList : m_xyPixelList)
+  ++m_currentGeneration;
+  if (0U == m_currentGeneration)
   {
-    for (auto& colorsList : xPixelList)
-    {
-      colorsList.count = 0;
-    }
+    // Wrapped around - the old generations could now look current.
+    std::ranges::fill(m_generations, 0U);
+    m_currentGeneration = 1U;
   }
 }
 
-inline auto GoomDrawToContainer::GetWriteableColorsList(const Point2dInt& point) noexcept
-    -> ColorsList&
-{
-  return m_xyPixelList.at(static_cast<size_t>(point.y)).at(static_cast<size_t>(point.x));
-}
-
 auto GoomDrawToContainer::DrawPixelsUnblended(
     [[maybe_unused]] const Point2dInt& point,
     [[maybe_unused]] const MultiplePixels& colors) noexcept -> void
@@ -56,9 +50,15 @@ auto GoomDrawToContainer::DrawPixelsUnblended(
 auto GoomDrawToContainer::DrawPixelsToDevice(const Point2dInt& point,
                                              const MultiplePixels& colors) noexcept -> void
 {
-  auto& colorsList = GetWriteableColorsList(point);
+  const auto index = GetIndex(point);
+  if (m_generations[index] != m_currentGeneration)
+  {
+    m_generations[index] = m_currentGeneration;
+    m_counts[index]      = 0U;
+  }
 
-  if (colorsList.count == colorsList.colorsArray.size())
+  auto& count = m_counts[index];
+  if (count == MAX_NUM_COLORS_LIST)
   {
     return;
   }
@@ -66,9 +66,9 @@ auto GoomDrawToContainer::DrawPixelsToDevice(const Point2dInt& point,
   // NOTE: Just save the first pixel in 'colors'. May need to improve this.
   const auto newColor = GetBrighterColorInt(GetIntBuffIntensity(), colors.color1);
 
-  colorsList.colorsArray.at(colorsList.count) = newColor;
-  ++colorsList.count;
-  if (1 == colorsList.count)
+  m_colorsArrays[index][count] = newColor;
+  ++count;
+  if (1 == count)
   {
     m_orderedXYPixelList.emplace_back(point);
   }
@@ -84,7 +84,7 @@ auto GoomDrawToContainer::ResizeChangedCoordsKeepingNewest(const size_t numToKee
 
   for (auto coords = eraseFrom; coords != eraseTo; ++coords)
   {
-    GetWriteableColorsList(*coords).count = 0;
+    m_counts[GetIndex(*coords)] = 0U;
   }
 
   m_orderedXYPixelList.erase(eraseFrom, eraseTo);
@@ -96,9 +96,8 @@ auto GoomDrawToContainer::IterateChangedCoordsNewToOld(const CoordsFunc& func) c
 {
   const auto runFunc = [this, &func](const size_t i)
   {
-    const auto& coords     = m_orderedXYPixelList[i];
-    const auto& colorsList = GetColorsList(coords);
-    func(coords, colorsList);
+    const auto& coords = m_orderedXYPixelList[i];
+    func(coords, GetColorsList(coords));
   };
 
   // Start with the newest coords added.
@@ -4,6 +4,7 @@ module;
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <span>
 #include <vector>
 
 export module Goom.Draw.GoomDrawToContainer;
@@ -29,21 +30,24 @@ public:
 
   static constexpr size_t MAX_NUM_COLORS_LIST = 3;
   using ColorsArray                           = std::array<Pixel, MAX_NUM_COLORS_LIST>;
+  // The first 'count' colors drawn at a pixel, oldest first. A view of the container's
+  // own per pixel array, so it's only good until the next draw or clear.
   struct ColorsList
   {
     uint8_t count = 0;
-    ColorsArray colorsArray{};
+    std::span<const Pixel> colors{};
   };
   [[nodiscard]] auto GetNumChangedCoords() const noexcept -> size_t;
   [[nodiscard]] auto GetChangedCoordsList() const noexcept -> const std::vector<Point2dInt>&;
   // IMPORTANT: The above is ordered from oldest to newest.
-  [[nodiscard]] auto GetColorsList(const Point2dInt& point) const noexcept -> const ColorsList&;
+  [[nodiscard]] auto GetColorsList(const Point2dInt& point) const noexcept -> ColorsList;
 
   using CoordsFunc = std::function<void(const Point2dInt& point, const ColorsList& colorsList)>;
   // NOTE: 'func' must be thread-safe.
   auto IterateChangedCoordsNewToOld(const CoordsFunc& func) const noexcept -> void;
 
   auto ResizeChangedCoordsKeepingNewest(size_t numToKeep) noexcept -> void;
+  // Only bumps the generation - the per pixel counts are not touched.
   auto ClearAll() noexcept -> void;
 
 protected:
@@ -51,9 +55,15 @@ protected:
       -> void override;
 
 private:
-  std::vector<std::vector<ColorsList>> m_xyPixelList;
+  // Flat, row major, per pixel arrays. A pixel's count is only valid if its generation is
+  // the current generation, otherwise the pixel has not been drawn since the last clear.
+  uint32_t m_currentGeneration = 1U;
+  std::vector<uint32_t> m_generations;
+  std::vector<uint8_t> m_counts;
+  std::vector<ColorsArray> m_colorsArrays;
   std::vector<Point2dInt> m_orderedXYPixelList;
-  [[nodiscard]] auto GetWriteableColorsList(const Point2dInt& point) noexcept -> ColorsList&;
+  [[nodiscard]] auto GetIndex(const Point2dInt& point) const noexcept -> size_t;
+  [[nodiscard]] auto GetCount(size_t index) const noexcept -> uint8_t;
   [[nodiscard]] auto GetLastDrawnColor(const Point2dInt& point) const noexcept -> Pixel;
   [[nodiscard]] auto GetLastDrawnColors(const Point2dInt& point) const noexcept -> MultiplePixels;
 };
@@ -73,10 +83,23 @@ inline auto GoomDrawToContainer::GetPixels(const Point2dInt& point) const noexce
   return GetLastDrawnColors(point);
 }
 
+inline auto GoomDrawToContainer::GetIndex(const Point2dInt& point) const noexcept -> size_t
+{
+  return (static_cast<size_t>(point.y) * GetDimensions().GetWidth()) +
+         static_cast<size_t>(point.x);
+}
+
+inline auto GoomDrawToContainer::GetCount(const size_t index) const noexcept -> uint8_t
+{
+  return m_generations[index] == m_currentGeneration ? m_counts[index] : uint8_t{0};
+}
+
 inline auto GoomDrawToContainer::GetColorsList(const Point2dInt& point) const noexcept
-    -> const ColorsList&
+    -> ColorsList
 {
-  return m_xyPixelList.at(static_cast<size_t>(point.y)).at(static_cast<size_t>(point.x));
+  const auto index = GetIndex(point);
+  const auto count = GetCount(index);
+  return {.count = count, .colors = std::span{m_colorsArrays[index]}.first(count)};
 }
 
 inline auto GoomDrawToContainer::GetNumChangedCoords() const noexcept -> size_t
@@ -92,12 +115,13 @@ inline auto GoomDrawToContainer::GetChangedCoordsList() const noexcept
 
 inline auto GoomDrawToContainer::GetLastDrawnColor(const Point2dInt& point) const noexcept -> Pixel
 {
-  const auto& colorsList = GetColorsList(point);
-  if (0 == colorsList.count)
+  const auto index = GetIndex(point);
+  const auto count = GetCount(index);
+  if (0 == count)
   {
     return BLACK_PIXEL;
   }
-  return colorsList.colorsArray.at(static_cast<size_t>(colorsList.count - 1));
+  return m_colorsArrays[index][static_cast<size_t>(count - 1)];
 }
 
 inline auto GoomDrawToContainer::GetLastDrawnColors(const Point2dInt& point) const noexcept
@@ -0,0 +1,124 @@
+module;
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+module Goom.Draw.GoomDrawToLayer;
+
+import Goom.Draw.DirtyTiles;
+import Goom.Draw.GoomDrawToBuffer;
+import Goom.Utils.Parallel;
+import Goom.Lib.AssertUtils;
+
+namespace GOOM::DRAW
+{
+
+using UTILS::Parallel;
+
+GoomDrawToLayer::GoomDrawToLayer(GoomDrawToTwoBuffers& destDraw) noexcept
+  : IGoomDraw{destDraw.GetDimensions()},
+    m_destDraw{&destDraw},
+    m_tilePixels(destDraw.GetDirtyTiles().GetNumTiles())
+{
+}
+
+auto GoomDrawToLayer::SetDrawToLayer(const bool drawToLayer) noexcept -> void
+{
+  ClearLayer();
+  m_drawToLayer = drawToLayer;
+}
+
+auto GoomDrawToLayer::GetNumLayerPixels() const noexcept -> size_t
+{
+  auto numPixels = size_t{0};
+  for (const auto tileIndex : m_layerTiles)
+  {
+    numPixels += m_tilePixels[tileIndex].size();
+  }
+  return numPixels;
+}
+
+auto GoomDrawToLayer::CompositeTile(const uint32_t tileIndex) noexcept -> void
+{
+  Expects(tileIndex < m_tilePixels.size());
+
+  const auto& tilePixels = m_tilePixels[tileIndex];
+  if (tilePixels.empty())
+  {
+    return;
+  }
+
+  for (const auto& layerPixel : tilePixels)
+  {
+    if (layerPixel.blended)
+    {
+      BlendPixels(layerPixel.buffPos, layerPixel.colors);
+    }
+    else
+    {
+      SetPixels(layerPixel.buffPos, layerPixel.colors);
+    }
+  }
+  m_destDraw->GetDirtyTiles().MarkTile(tileIndex);
+}
+
+auto GoomDrawToLayer::ClearLayer() noexcept -> void
+{
+  // Only clear - the tile vectors keep their capacity for the next frame.
+  for (const auto tileIndex : m_layerTiles)
+  {
+    m_tilePixels[tileIndex].clear();
+  }
+  m_layerTiles.clear();
+}
+
+LayerCompositor::LayerCompositor(Parallel& parallel, const DirtyTiles& dirtyTiles) noexcept
+  : m_parallel{&parallel}, m_tileFlags(dirtyTiles.GetNumTiles(), 0U)
+{
+  m_tilesToComposite.reserve(dirtyTiles.GetNumTiles());
+}
+
+auto LayerCompositor::CompositeLayers(const std::span<GoomDrawToLayer* const> layers) noexcept
+    -> void
+{
+  for (const auto* layer : layers)
+  {
+    for (const auto tileIndex : layer->GetLayerTiles())
+    {
+      if (0U == m_tileFlags[tileIndex])
+      {
+        m_tileFlags[tileIndex] = 1U;
+        m_tilesToComposite.emplace_back(tileIndex);
+      }
+    }
+  }
+
+  if (not m_tilesToComposite.empty())
+  {
+    // Each tile is only touched by one thread, and within a tile the layers go in order,
+    // so every pixel sees the same sequence of blends as a straight draw would.
+    m_parallel->ForLoop(m_tilesToComposite.size(),
+                        [this, &layers](const size_t i)
+                        {
+                          for (auto* layer : layers)
+                          {
+                            layer->CompositeTile(m_tilesToComposite[i]);
+                          }
+                        });
+  }
+
+  for (const auto tileIndex : m_tilesToComposite)
+  {
+    m_tileFlags[tileIndex] = 0U;
+  }
+  m_tilesToComposite.clear();
+
+  for (auto* layer : layers)
+  {
+    layer->ClearLayer();
+  }
+}
+
+} // namespace GOOM::DRAW
@@ -0,0 +1,182 @@
+module;
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+export module Goom.Draw.GoomDrawToLayer;
+
+import Goom.Draw.DirtyTiles;
+import Goom.Draw.GoomDrawBase;
+import Goom.Draw.GoomDrawToBuffer;
+import Goom.Utils.Parallel;
+import Goom.Lib.AssertUtils;
+import Goom.Lib.GoomGraphic;
+import Goom.Lib.Point2d;
+
+export namespace GOOM::DRAW
+{
+
+// Draws to the buffers of 'destDraw', but with its own blend function and buffer
+// intensity. When drawing to the layer, pixels are not blended straight away, they are
+// recorded, binned by tile, so the drawing can be done on another thread. Compositing the
+// layer later replays the pixels in the order they were drawn, so the buffers end up
+// exactly as if the layer had not been used.
+class GoomDrawToLayer : public IGoomDraw
+{
+public:
+  explicit GoomDrawToLayer(GoomDrawToTwoBuffers& destDraw) noexcept;
+
+  [[nodiscard]] auto GetDestDraw() const noexcept -> const GoomDrawToTwoBuffers&;
+  [[nodiscard]] auto GetDestDraw() noexcept -> GoomDrawToTwoBuffers&;
+
+  [[nodiscard]] auto IsDrawingToLayer() const noexcept -> bool;
+  // Any pixels left in the layer are thrown away.
+  auto SetDrawToLayer(bool drawToLayer) noexcept -> void;
+
+  [[nodiscard]] auto GetNumLayerPixels() const noexcept -> size_t;
+  [[nodiscard]] auto GetLayerTiles() const noexcept -> const std::vector<uint32_t>&;
+  // The blend function and buffer intensity at the time of compositing are used for all
+  // the layer's pixels, so they must not be changed between drawing and compositing.
+  auto CompositeTile(uint32_t tileIndex) noexcept -> void;
+  auto ClearLayer() noexcept -> void;
+
+  // What's under the layer isn't known until it's composited, so this can't be used
+  // when drawing to the layer.
+  [[nodiscard]] auto GetPixel(const Point2dInt& point) const noexcept -> Pixel override;
+  auto DrawPixelsUnblended(const Point2dInt& point, const MultiplePixels& colors) noexcept
+      -> void override;
+
+protected:
+  auto DrawPixelsToDevice(const Point2dInt& point, const MultiplePixels& colors) noexcept
+      -> void override;
+
+private:
+  GoomDrawToTwoBuffers* m_destDraw;
+  bool m_drawToLayer = false;
+
+  struct LayerPixel
+  {
+    uint32_t buffPos;
+    bool blended;
+    MultiplePixels colors;
+  };
+  std::vector<std::vector<LayerPixel>> m_tilePixels;
+  std::vector<uint32_t> m_layerTiles;
+  auto AddLayerPixel(const Point2dInt& point, bool blended, const MultiplePixels& colors) noexcept
+      -> void;
+  auto BlendPixels(size_t buffPos, const MultiplePixels& colors) noexcept -> void;
+  auto SetPixels(size_t buffPos, const MultiplePixels& colors) noexcept -> void;
+};
+
+// Composites layers that all draw to the same buffers. Layers are composited in the order
+// given, and tiles are composited in parallel.
+class LayerCompositor
+{
+public:
+  LayerCompositor(UTILS::Parallel& parallel, const DirtyTiles& dirtyTiles) noexcept;
+
+  // The layers are cleared afterwards.
+  auto CompositeLayers(std::span<GoomDrawToLayer* const> layers) noexcept -> void;
+
+private:
+  UTILS::Parallel* m_parallel;
+  std::vector<uint8_t> m_tileFlags;
+  std::vector<uint32_t> m_tilesToComposite;
+};
+
+} // namespace GOOM::DRAW
+
+namespace GOOM::DRAW
+{
+
+inline auto GoomDrawToLayer::GetDestDraw() const noexcept -> const GoomDrawToTwoBuffers&
+{
+  return *m_destDraw;
+}
+
+inline auto GoomDrawToLayer::GetDestDraw() noexcept -> GoomDrawToTwoBuffers&
+{
+  return *m_destDraw;
+}
+
+inline auto GoomDrawToLayer::IsDrawingToLayer() const noexcept -> bool
+{
+  return m_drawToLayer;
+}
+
+inline auto GoomDrawToLayer::GetLayerTiles() const noexcept -> const std::vector<uint32_t>&
+{
+  return m_layerTiles;
+}
+
+inline auto GoomDrawToLayer::GetPixel(const Point2dInt& point) const noexcept -> Pixel
+{
+  Expects(not m_drawToLayer);
+
+  return m_destDraw->GetPixel(point);
+}
+
+inline auto GoomDrawToLayer::DrawPixelsUnblended(const Point2dInt& point,
+                                                 const MultiplePixels& colors) noexcept -> void
+{
+  if (m_drawToLayer)
+  {
+    AddLayerPixel(point, false, colors);
+    return;
+  }
+
+  SetPixels(m_destDraw->GetBuffer1().GetBuffPos(point.x, point.y), colors);
+  m_destDraw->GetDirtyTiles().MarkPoint(point);
+}
+
+inline auto GoomDrawToLayer::DrawPixelsToDevice(const Point2dInt& point,
+                                                const MultiplePixels& colors) noexcept -> void
+{
+  if (m_drawToLayer)
+  {
+    AddLayerPixel(point, true, colors);
+    return;
+  }
+
+  BlendPixels(m_destDraw->GetBuffer1().GetBuffPos(point.x, point.y), colors);
+  m_destDraw->GetDirtyTiles().MarkPoint(point);
+}
+
+inline auto GoomDrawToLayer::AddLayerPixel(const Point2dInt& point,
+                                           const bool blended,
+                                           const MultiplePixels& colors) noexcept -> void
+{
+  const auto tileIndex = m_destDraw->GetDirtyTiles().GetTileIndex(point);
+
+  auto& tilePixels = m_tilePixels[tileIndex];
+  if (tilePixels.empty())
+  {
+    m_layerTiles.emplace_back(tileIndex);
+  }
+  tilePixels.emplace_back(LayerPixel{
+      .buffPos = static_cast<uint32_t>(m_destDraw->GetBuffer1().GetBuffPos(point.x, point.y)),
+      .blended = blended,
+      .colors  = colors,
+  });
+}
+
+inline auto GoomDrawToLayer::BlendPixels(const size_t buffPos,
+                                         const MultiplePixels& colors) noexcept -> void
+{
+  auto& pixel1 = m_destDraw->GetBuffer1().GetPixel(buffPos);
+  pixel1       = GetBlendedPixel(pixel1, GetIntBuffIntensity(), colors.color1, colors.color1.A());
+
+  auto& pixel2 = m_destDraw->GetBuffer2().GetPixel(buffPos);
+  pixel2       = GetBlendedPixel(pixel2, GetIntBuffIntensity(), colors.color2, colors.color2.A());
+}
+
+inline auto GoomDrawToLayer::SetPixels(const size_t buffPos, const MultiplePixels& colors) noexcept
+    -> void
+{
+  m_destDraw->GetBuffer1().GetPixel(buffPos) = colors.color1;
+  m_destDraw->GetBuffer2().GetPixel(buffPos) = colors.color2;
+}
+
+} // namespace GOOM::DRAW
@@ -1,5 +1,6 @@
 module;
 
+#include <algorithm>
 #include <cstdint>
 #include <vector>
 
@@ -21,59 +22,58 @@ auto BitmapDrawer::Bitmap(const Point2dInt& centre,
   const auto bitmapWidth  = bitmap.GetIntWidth();
   const auto bitmapHeight = bitmap.GetIntHeight();
 
-  auto x0 = centre.x - (bitmapWidth / 2);
-  auto y0 = centre.y - (bitmapHeight / 2);
-  auto x1 = x0 + (bitmapWidth - 1);
-  auto y1 = y0 + (bitmapHeight - 1);
+  const auto x0 = centre.x - (bitmapWidth / 2);
+  const auto y0 = centre.y - (bitmapHeight / 2);
 
-  if ((x0 >= m_draw->GetDimensions().GetIntWidth()) or
-      (y0 >= m_draw->GetDimensions().GetIntHeight()) or (x1 < 0) or (y1 < 0))
+  // Clip once - only the part of the bitmap that's on the screen gets looked at.
+  const auto bitmapXBegin = std::max(0, -x0);
+  const auto bitmapXEnd   = std::min(bitmapWidth, m_draw->GetDimensions().GetIntWidth() - x0);
+  const auto bitmapYBegin = std::max(0, -y0);
+  const auto bitmapYEnd   = std::min(bitmapHeight, m_draw->GetDimensions().GetIntHeight() - y0);
+  if ((bitmapXBegin >= bitmapXEnd) or (bitmapYBegin >= bitmapYEnd))
   {
     return;
   }
 
-  x0 = std::max(x0, 0);
-  y0 = std::max(y0, 0);
-
-  if (x1 >= m_draw->GetDimensions().GetIntWidth())
-  {
-    x1 = m_draw->GetDimensions().GetIntWidth() - 1;
-  }
-  if (y1 >= m_draw->GetDimensions().GetIntHeight())
+  // Only the pixel runs worth drawing are visited, and each run goes to the device in one go.
+  const auto drawRowRuns = [this, &x0, &y0, &bitmapXBegin, &bitmapXEnd, &bitmap, &getColors](
+                               const uint32_t bitmapY)
   {
-    y1 = m_draw->GetDimensions().GetIntHeight() - 1;
-  }
+    const auto buffY = y0 + static_cast<int32_t>(bitmapY);
 
-  const auto actualBitmapWidth  = static_cast<uint32_t>(x1 - x0) + 1;
-  const auto actualBitmapHeight = static_cast<uint32_t>(y1 - y0) + 1;
-
-  const auto setDestPixelRow =
-      [this, &x0, &y0, &actualBitmapWidth, &bitmap, &getColors](const uint32_t bitmapY)
-  {
-    const int buffY  = y0 + static_cast<int>(bitmapY);
-    auto finalColors = MultiplePixels{};
-    for (auto bitmapX = 0U; bitmapX < actualBitmapWidth; ++bitmapX)
+    for (const auto& pixelRun : bitmap.GetRowRuns(bitmapY))
     {
-      const auto bitmapColor = bitmap(bitmapX, bitmapY);
-      if ((0 == bitmapColor.A()) || (bitmapColor.IsBlack()))
+      const auto runXBegin = std::max(pixelRun.xBegin, static_cast<uint32_t>(bitmapXBegin));
+      const auto runXEnd   = std::min(pixelRun.xEnd, static_cast<uint32_t>(bitmapXEnd));
+      if (runXBegin >= runXEnd)
       {
         continue;
       }
 
-      finalColors.color1 = getColors[0](GetPoint2dInt(bitmapX, bitmapY), bitmapColor);
-      if (getColors.size() > 1)
+      auto finalColors = MultiplePixels{};
+      m_runColors.clear();
+      for (auto bitmapX = runXBegin; bitmapX < runXEnd; ++bitmapX)
       {
-        finalColors.color2 = getColors[1](GetPoint2dInt(bitmapX, bitmapY), bitmapColor);
+        const auto bitmapColor = bitmap(bitmapX, bitmapY);
+
+        finalColors.color1 = getColors[0](GetPoint2dInt(bitmapX, bitmapY), bitmapColor);
+        if (getColors.size() > 1)
+        {
+          finalColors.color2 = getColors[1](GetPoint2dInt(bitmapX, bitmapY), bitmapColor);
+        }
+
+        m_runColors.emplace_back(finalColors);
       }
 
-      const auto buffX = x0 + static_cast<int>(bitmapX);
-      m_draw->DrawPixels({.x = buffX, .y = buffY}, finalColors);
+      m_draw->DrawPixelRun({.x = x0 + static_cast<int32_t>(runXBegin), .y = buffY}, m_runColors);
     }
   };
 
-  for (auto yBitmap = 0U; yBitmap < actualBitmapHeight; ++yBitmap)
+  for (auto bitmapY = static_cast<uint32_t>(bitmapYBegin);
+       bitmapY < static_cast<uint32_t>(bitmapYEnd);
+       ++bitmapY)
   {
-    setDestPixelRow(yBitmap);
+    drawRowRuns(bitmapY);
   }
 }
 
@@ -29,6 +29,8 @@ public:
 
 private:
   IGoomDraw* m_draw;
+  // Reused for each run of drawn pixels along a bitmap row.
+  std::vector<MultiplePixels> m_runColors;
 };
 
 } // namespace GOOM::DRAW::SHAPE_DRAWERS
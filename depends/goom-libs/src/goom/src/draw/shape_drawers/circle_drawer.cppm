@@ -1,22 +1,24 @@
 module;
 
 #include <cstdint>
-#include <functional>
-#include <vector>
 
 export module Goom.Draw.ShaperDrawers.CircleDrawer;
 
 import Goom.Draw.GoomDrawBase;
+import Goom.Draw.ShaperDrawers.DrawerUtils;
+import Goom.Lib.AssertUtils;
 import Goom.Lib.GoomGraphic;
 import Goom.Lib.Point2d;
 
 export namespace GOOM::DRAW::SHAPE_DRAWERS
 {
 
-class CircleDrawer
+// 'DrawT' is IGoomDraw, or a GoomDrawTo for a fully inlined draw.
+template<class DrawT>
+class BasicCircleDrawer
 {
 public:
-  explicit CircleDrawer(IGoomDraw& draw) noexcept;
+  explicit BasicCircleDrawer(DrawT& draw) noexcept;
 
   auto DrawCircle(const Point2dInt& centre, int32_t radius, const MultiplePixels& colors) noexcept
       -> void;
@@ -25,9 +27,9 @@ public:
                         const MultiplePixels& colors) noexcept -> void;
 
 private:
-  IGoomDraw* m_draw;
-  using PlotCirclePointsFunc =
-      std::function<void(const Point2dInt& point1, const Point2dInt& point2)>;
+  DrawT* m_draw;
+  // 'plot(point1, point2)' is called with pairs of points on the same row.
+  template<typename PlotCirclePointsFunc>
   static auto DrawBresenhamCircle(const Point2dInt& centre,
                                   int32_t radius,
                                   const PlotCirclePointsFunc& plot) noexcept -> void;
@@ -36,13 +38,115 @@ private:
                           const MultiplePixels& colors) noexcept -> void;
 };
 
+using CircleDrawer = BasicCircleDrawer<IGoomDraw>;
+
 } // namespace GOOM::DRAW::SHAPE_DRAWERS
 
 namespace GOOM::DRAW::SHAPE_DRAWERS
 {
 
-inline CircleDrawer::CircleDrawer(IGoomDraw& draw) noexcept : m_draw{&draw}
+template<class DrawT>
+inline BasicCircleDrawer<DrawT>::BasicCircleDrawer(DrawT& draw) noexcept : m_draw{&draw}
+{
+}
+
+template<class DrawT>
+inline auto BasicCircleDrawer<DrawT>::DrawCircle(const Point2dInt& centre,
+                                                 const int32_t radius,
+                                                 const MultiplePixels& colors) noexcept -> void
+{
+  if (ClipTester{m_draw->GetDimensions(), radius}.IsOutside(centre))
+  {
+    return;
+  }
+
+  const auto plot = [this, &colors](const Point2dInt& point1, const Point2dInt& point2)
+  {
+    m_draw->DrawPixels(point1, colors);
+    if (point1 == point2)
+    {
+      return;
+    }
+    m_draw->DrawPixels(point2, colors);
+  };
+
+  DrawBresenhamCircle(centre, radius, plot);
+}
+
+template<class DrawT>
+inline auto BasicCircleDrawer<DrawT>::DrawFilledCircle(const Point2dInt& centre,
+                                                       const int32_t radius,
+                                                       const MultiplePixels& colors) noexcept
+    -> void
+{
+  if (ClipTester{m_draw->GetDimensions(), radius}.IsOutside(centre))
+  {
+    return;
+  }
+
+  const auto plot = [this, &colors](const Point2dInt& point1, const Point2dInt& point2)
+  {
+    Expects(point1.y == point2.y);
+    DrawHorizontalLine(point1, point2.x, colors);
+  };
+
+  DrawBresenhamCircle(centre, radius, plot);
+}
+
+template<class DrawT>
+inline auto BasicCircleDrawer<DrawT>::DrawHorizontalLine(const Point2dInt& point1,
+                                                         const int32_t x2,
+                                                         const MultiplePixels& colors) noexcept
+    -> void
 {
+  if (x2 < point1.x)
+  {
+    return;
+  }
+
+  m_draw->DrawHorizontalSpan(point1, static_cast<uint32_t>(x2 - point1.x) + 1U, colors);
+}
+
+// Function for circle-generation using Bresenham's algorithm.
+template<class DrawT>
+template<typename PlotCirclePointsFunc>
+inline auto BasicCircleDrawer<DrawT>::DrawBresenhamCircle(const Point2dInt& centre,
+                                                          const int32_t radius,
+                                                          const PlotCirclePointsFunc& plot) noexcept
+    -> void
+{
+  const auto drawCircle8 =
+      [&plot](const int32_t xc, int32_t const yc, const int32_t x, const int32_t y)
+  {
+    plot({.x = xc - x, .y = yc + y}, {.x = xc + x, .y = yc + y});
+    plot({.x = xc - x, .y = yc - y}, {.x = xc + x, .y = yc - y});
+    plot({.x = xc - y, .y = yc + x}, {.x = xc + y, .y = yc + x});
+    plot({.x = xc - y, .y = yc - x}, {.x = xc + y, .y = yc - x});
+  };
+
+  int32_t x = 0;
+  int32_t y = radius;
+
+  drawCircle8(centre.x, centre.y, x, y);
+
+  int32_t d = 3 - (2 * radius); // NOLINT(readability-identifier-length)
+  while (y >= x)
+  {
+    ++x;
+
+    if (static constexpr auto FACTOR = 4; d > 0)
+    {
+      --y;
+      static constexpr auto D_POS_INC = 10;
+      d += (FACTOR * (x - y)) + D_POS_INC;
+    }
+    else
+    {
+      static constexpr auto D_NEG_INC = 6;
+      d += (FACTOR * x) + D_NEG_INC;
+    }
+    drawCircle8(centre.x, centre.y, x, y);
+  }
 }
 
 } // namespace GOOM::DRAW::SHAPE_DRAWERS
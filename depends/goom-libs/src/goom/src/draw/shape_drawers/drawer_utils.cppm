@@ -14,10 +14,11 @@ export namespace GOOM::DRAW::SHAPE_DRAWERS
 
 auto BrightenColors(float brightness, MultiplePixels& colors) -> void;
 
-class PixelDrawerNoClipping
+template<class DrawT>
+class BasicPixelDrawerNoClipping
 {
 public:
-  explicit PixelDrawerNoClipping(IGoomDraw& draw) noexcept : m_draw{&draw} {}
+  explicit BasicPixelDrawerNoClipping(DrawT& draw) noexcept : m_draw{&draw} {}
 
   auto DrawPixels(const Point2dInt& point, const float brightness, MultiplePixels colors) noexcept
       -> void
@@ -27,13 +28,14 @@ public:
   }
 
 private:
-  IGoomDraw* m_draw;
+  DrawT* m_draw;
 };
 
-class PixelDrawerWithClipping
+template<class DrawT>
+class BasicPixelDrawerWithClipping
 {
 public:
-  explicit PixelDrawerWithClipping(IGoomDraw& draw) noexcept : m_draw{&draw} {}
+  explicit BasicPixelDrawerWithClipping(DrawT& draw) noexcept : m_draw{&draw} {}
 
   auto DrawPixels(const Point2dInt& point,
                   [[maybe_unused]] const float brightness,
@@ -44,9 +46,12 @@ public:
   }
 
 private:
-  IGoomDraw* m_draw;
+  DrawT* m_draw;
 };
 
+using PixelDrawerNoClipping   = BasicPixelDrawerNoClipping<IGoomDraw>;
+using PixelDrawerWithClipping = BasicPixelDrawerWithClipping<IGoomDraw>;
+
 class ClipTester
 {
 public:
@@ -45,10 +45,12 @@ private:
                      const MultiplePixels& colors) noexcept -> void;
 };
 
-class LineDrawerNoClippedEndPoints
+// 'DrawT' is IGoomDraw, or a GoomDrawTo for a fully inlined draw.
+template<class DrawT>
+class BasicLineDrawerNoClippedEndPoints
 {
 public:
-  explicit LineDrawerNoClippedEndPoints(IGoomDraw& draw) noexcept;
+  explicit BasicLineDrawerNoClippedEndPoints(DrawT& draw) noexcept;
 
   auto SetLineThickness(uint8_t thickness) noexcept -> void;
 
@@ -57,13 +59,14 @@ public:
                 const MultiplePixels& colors) noexcept -> void;
 
 private:
-  LineDrawer<PixelDrawerWithClipping> m_lineDrawer;
+  LineDrawer<BasicPixelDrawerWithClipping<DrawT>> m_lineDrawer;
 };
 
-class LineDrawerClippedEndPoints
+template<class DrawT>
+class BasicLineDrawerClippedEndPoints
 {
 public:
-  explicit LineDrawerClippedEndPoints(IGoomDraw& draw) noexcept;
+  explicit BasicLineDrawerClippedEndPoints(DrawT& draw) noexcept;
 
   auto SetLineThickness(uint8_t thickness) noexcept -> void;
 
@@ -73,39 +76,51 @@ public:
 
 private:
   Dimensions m_dimensions;
-  LineDrawer<PixelDrawerNoClipping> m_lineDrawer;
+  LineDrawer<BasicPixelDrawerNoClipping<DrawT>> m_lineDrawer;
   ClipTester m_clipTester{m_dimensions, GetClipMargin()};
   [[nodiscard]] auto GetClipMargin() const noexcept -> int32_t;
 };
 
+using LineDrawerNoClippedEndPoints = BasicLineDrawerNoClippedEndPoints<IGoomDraw>;
+using LineDrawerClippedEndPoints   = BasicLineDrawerClippedEndPoints<IGoomDraw>;
+
 } // namespace GOOM::DRAW::SHAPE_DRAWERS
 
 namespace GOOM::DRAW::SHAPE_DRAWERS
 {
 
-inline LineDrawerNoClippedEndPoints::LineDrawerNoClippedEndPoints(IGoomDraw& draw) noexcept
-  : m_lineDrawer{PixelDrawerWithClipping{draw}}
+template<class DrawT>
+inline BasicLineDrawerNoClippedEndPoints<DrawT>::BasicLineDrawerNoClippedEndPoints(
+    DrawT& draw) noexcept
+  : m_lineDrawer{BasicPixelDrawerWithClipping<DrawT>{draw}}
 {
 }
 
-inline auto LineDrawerNoClippedEndPoints::SetLineThickness(const uint8_t thickness) noexcept -> void
+template<class DrawT>
+inline auto BasicLineDrawerNoClippedEndPoints<DrawT>::SetLineThickness(
+    const uint8_t thickness) noexcept -> void
 {
   m_lineDrawer.SetLineThickness(thickness);
 }
 
-inline auto LineDrawerNoClippedEndPoints::DrawLine(const Point2dInt& point1,
-                                                   const Point2dInt& point2,
-                                                   const MultiplePixels& colors) noexcept -> void
+template<class DrawT>
+inline auto BasicLineDrawerNoClippedEndPoints<DrawT>::DrawLine(
+    const Point2dInt& point1, const Point2dInt& point2, const MultiplePixels& colors) noexcept
+    -> void
 {
   m_lineDrawer.DrawLine(point1, point2, colors);
 }
 
-inline LineDrawerClippedEndPoints::LineDrawerClippedEndPoints(IGoomDraw& draw) noexcept
-  : m_dimensions{draw.GetDimensions()}, m_lineDrawer{PixelDrawerNoClipping{draw}}
+template<class DrawT>
+inline BasicLineDrawerClippedEndPoints<DrawT>::BasicLineDrawerClippedEndPoints(
+    DrawT& draw) noexcept
+  : m_dimensions{draw.GetDimensions()}, m_lineDrawer{BasicPixelDrawerNoClipping<DrawT>{draw}}
 {
 }
 
-inline auto LineDrawerClippedEndPoints::SetLineThickness(const uint8_t thickness) noexcept -> void
+template<class DrawT>
+inline auto BasicLineDrawerClippedEndPoints<DrawT>::SetLineThickness(
+    const uint8_t thickness) noexcept -> void
 {
   if (thickness == m_lineDrawer.GetLineThickness())
   {
@@ -116,7 +131,8 @@ inline auto LineDrawerClippedEndPoints::SetLineThickness(const uint8_t thickness
   m_clipTester.SetClipMargin(GetClipMargin());
 }
 
-inline auto LineDrawerClippedEndPoints::GetClipMargin() const noexcept -> int32_t
+template<class DrawT>
+inline auto BasicLineDrawerClippedEndPoints<DrawT>::GetClipMargin() const noexcept -> int32_t
 {
   static constexpr auto CLIP_MARGIN_FOR_THIN_LINE = 2;
 
@@ -124,9 +140,10 @@ inline auto LineDrawerClippedEndPoints::GetClipMargin() const noexcept -> int32_
                                                : m_lineDrawer.GetLineThickness();
 }
 
-inline auto LineDrawerClippedEndPoints::DrawLine(const Point2dInt& point1,
-                                                 const Point2dInt& point2,
-                                                 const MultiplePixels& colors) noexcept -> void
+template<class DrawT>
+inline auto BasicLineDrawerClippedEndPoints<DrawT>::DrawLine(
+    const Point2dInt& point1, const Point2dInt& point2, const MultiplePixels& colors) noexcept
+    -> void
 {
   if (m_clipTester.IsOutside(point1) or m_clipTester.IsOutside(point2))
   {
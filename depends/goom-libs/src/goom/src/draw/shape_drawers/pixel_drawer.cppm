@@ -9,36 +9,44 @@ import Goom.Lib.Point2d;
 export namespace GOOM::DRAW::SHAPE_DRAWERS
 {
 
-class PixelDrawer
+// 'DrawT' is IGoomDraw, or a GoomDrawTo for a fully inlined draw.
+template<class DrawT>
+class BasicPixelDrawer
 {
 public:
-  explicit PixelDrawer(IGoomDraw& draw) noexcept;
+  explicit BasicPixelDrawer(DrawT& draw) noexcept;
 
   auto DrawPixels(const Point2dInt& point, const MultiplePixels& colors) noexcept -> void;
   auto DrawPixelsClipped(const Point2dInt& point, const MultiplePixels& colors) noexcept -> void;
 
 private:
-  IGoomDraw* m_draw;
+  DrawT* m_draw;
   ClipTester m_clipTester{m_draw->GetDimensions(), 0};
 };
 
+using PixelDrawer = BasicPixelDrawer<IGoomDraw>;
+
 } // namespace GOOM::DRAW::SHAPE_DRAWERS
 
 namespace GOOM::DRAW::SHAPE_DRAWERS
 {
 
-inline PixelDrawer::PixelDrawer(IGoomDraw& draw) noexcept : m_draw{&draw}
+template<class DrawT>
+inline BasicPixelDrawer<DrawT>::BasicPixelDrawer(DrawT& draw) noexcept : m_draw{&draw}
 {
 }
 
-inline auto PixelDrawer::DrawPixels(const Point2dInt& point, const MultiplePixels& colors) noexcept
-    -> void
+template<class DrawT>
+inline auto BasicPixelDrawer<DrawT>::DrawPixels(const Point2dInt& point,
+                                                const MultiplePixels& colors) noexcept -> void
 {
   m_draw->DrawPixels(point, colors);
 }
 
-inline auto PixelDrawer::DrawPixelsClipped(const Point2dInt& point,
-                                           const MultiplePixels& colors) noexcept -> void
+template<class DrawT>
+inline auto BasicPixelDrawer<DrawT>::DrawPixelsClipped(const Point2dInt& point,
+                                                       const MultiplePixels& colors) noexcept
+    -> void
 {
   if (m_clipTester.IsOutside(point))
   {
@@ -26,10 +26,12 @@ import Goom.Utils.Math.Misc;
 #else
 #include <cmath>
 #include <codecvt>
+#include <compare>
 #include <format>
 #include <fstream>
 #include <ft2build.h>
 #include <locale>
+#include <map>
 #include FT_FREETYPE_H
 #include FT_STROKER_H
 #endif
@@ -76,9 +78,11 @@ public:
   [[nodiscard]] auto GetFontSize() const noexcept -> int32_t;
   auto SetFontSize(int32_t val) noexcept -> void;
   [[nodiscard]] auto GetLineSpacing() const noexcept -> int32_t;
+  [[nodiscard]] auto GetOutlineWidth() const noexcept -> float;
   auto SetOutlineWidth(float val) noexcept -> void;
   [[nodiscard]] auto GetCharSpacing() const noexcept -> float;
   auto SetCharSpacing(float val) noexcept -> void;
+  [[nodiscard]] auto GetCharSpacingAdvance() const noexcept -> int32_t;
 
   auto SetFontColorFunc(const FontColorFunc& func) noexcept -> void;
   auto SetOutlineFontColorFunc(const FontColorFunc& func) noexcept -> void;
@@ -91,6 +95,7 @@ public:
   [[nodiscard]] auto GetPreparedTextBoundingRect() const noexcept -> Rect;
   [[nodiscard]] auto GetBearingX() const noexcept -> int;
   [[nodiscard]] auto GetBearingY() const noexcept -> int;
+  auto GetPreparedText(PreparedText& preparedText) const noexcept -> void;
 
   auto Draw(const Point2dInt& pen) noexcept -> void;
   auto Draw(const Point2dInt& pen, Point2dInt& nextPen) noexcept -> void;
@@ -140,6 +145,11 @@ auto TextDrawer::TextDrawerImpl::GetLineSpacing() const noexcept -> int32_t
   return 0;
 }
 
+auto TextDrawer::TextDrawerImpl::GetOutlineWidth() const noexcept -> float
+{
+  return 0.0F;
+}
+
 auto TextDrawer::TextDrawerImpl::SetOutlineWidth(const float) noexcept -> void
 {
 }
@@ -149,6 +159,11 @@ inline auto TextDrawer::TextDrawerImpl::GetCharSpacing() const noexcept -> float
   return 0.0F;
 }
 
+inline auto TextDrawer::TextDrawerImpl::GetCharSpacingAdvance() const noexcept -> int32_t
+{
+  return 0;
+}
+
 auto TextDrawer::TextDrawerImpl::SetCharSpacing(const float) noexcept -> void
 {
 }
@@ -196,6 +211,14 @@ inline auto TextDrawer::TextDrawerImpl::GetBearingY() const noexcept -> int32_t
 {
   return 1;
 }
+
+auto TextDrawer::TextDrawerImpl::GetPreparedText(PreparedText& preparedText) const noexcept
+    -> void
+{
+  preparedText.spans.clear();
+  preparedText.numChars = 0U;
+  preparedText.width    = 0;
+}
 #endif
 
 #ifndef NO_FREETYPE_INSTALLED
@@ -218,9 +241,11 @@ public:
   [[nodiscard]] auto GetFontSize() const noexcept -> int32_t;
   auto SetFontSize(int32_t val) -> void;
   [[nodiscard]] auto GetLineSpacing() const noexcept -> int32_t;
+  [[nodiscard]] auto GetOutlineWidth() const noexcept -> float;
   auto SetOutlineWidth(float val) noexcept -> void;
   [[nodiscard]] auto GetCharSpacing() const noexcept -> float;
   auto SetCharSpacing(float val) noexcept -> void;
+  [[nodiscard]] auto GetCharSpacingAdvance() const noexcept -> int32_t;
 
   auto SetFontColorFunc(const FontColorFunc& func) noexcept -> void;
   auto SetOutlineFontColorFunc(const FontColorFunc& func) noexcept -> void;
@@ -233,13 +258,14 @@ public:
   [[nodiscard]] auto GetPreparedTextBoundingRect() const noexcept -> Rect;
   [[nodiscard]] auto GetBearingX() const noexcept -> int;
   [[nodiscard]] auto GetBearingY() const noexcept -> int;
+  auto GetPreparedText(PreparedText& preparedText) const -> void;
 
   auto Draw(const Point2dInt& pen) -> void;
   auto Draw(const Point2dInt& pen, Point2dInt& nextPen) -> void;
 
 private:
   IGoomDraw* m_draw;
-  UTILS::Parallel m_parallel{UTILS::GetNumAvailablePoolThreads()};
+  UTILS::Parallel m_parallel{UTILS::TaskPriority::FRAME_CRITICAL};
   FT_Library m_library{};
   static constexpr auto DEFAULT_FONT_SIZE      = 100;
   int32_t m_fontSize                           = DEFAULT_FONT_SIZE;
@@ -256,6 +282,7 @@ private:
   std::string m_theText{};
   TextAlignment m_textAlignment{TextAlignment::LEFT};
   FT_Face m_face{};
+  uint32_t m_faceId = 0U;
   auto SetFaceFontSize() -> void;
 
   FontColorFunc m_getFontColor{};
@@ -297,28 +324,57 @@ private:
     auto Include(const Vec2& span) noexcept -> void;
   };
 
-  struct Spans
+  // The rasterized spans of a glyph only depend on the face, the font size, the outline
+  // width and the char, so they're cached and the same text can be prepared every frame
+  // without going back to FreeType.
+  struct GlyphKey
+  {
+    uint32_t faceId;
+    int32_t fontSize;
+    int32_t outlineWidth; // in FreeType units
+    char32_t utf32Char;
+    auto operator<=>(const GlyphKey&) const noexcept = default;
+  };
+  struct GlyphSpans
   {
     SpanArray stdSpans{};
     SpanArray outlineSpans{};
-    size_t textIndexOfChar{};
     RectImpl rect{};
-    int32_t advance{};
+    int32_t advance{}; // without the char spacing
     int32_t bearingX{};
     int32_t bearingY{};
   };
+  // Changing font sizes can fill the cache with glyphs that won't be used again, so it's
+  // emptied when it gets bigger than 'MAX_CACHED_GLYPHS'.
+  std::map<GlyphKey, GlyphSpans> m_glyphCache{};
+  [[nodiscard]] auto GetCachedGlyphSpans(char32_t utf32Char) -> const GlyphSpans&;
+  auto LoadGlyph(char32_t utf32Char) const -> void;
+
+  struct Spans
+  {
+    const GlyphSpans* glyphSpans{};
+    size_t textIndexOfChar{};
+    int32_t advance{};
+  };
 
   std::vector<Spans> m_textSpans{};
   Rect m_textBoundingRect{};
   [[nodiscard]] static auto GetBoundingRect(const SpanArray& stdSpans,
                                             const SpanArray& outlineSpans) noexcept -> RectImpl;
-  [[nodiscard]] auto GetSpans(size_t textIndexOfChar) const -> Spans;
+  [[nodiscard]] auto GetGlyphSpans() const -> GlyphSpans;
   [[nodiscard]] auto GetStdSpans() const noexcept -> SpanArray;
   [[nodiscard]] auto GetOutlineSpans() const -> SpanArray;
   auto RenderSpans(FT_Outline* outline, SpanArray* spans) const noexcept -> void;
   static auto RasterCallback(int32_t y, int32_t count, const FT_Span* spans, void* user) noexcept
       -> void;
 
+  static auto AddTextSpans(const SpanArray& spanArray,
+                           const RectImpl& rect,
+                           int32_t xPen,
+                           size_t textIndexOfChar,
+                           bool isOutline,
+                           std::vector<TextSpan>& textSpans) -> void;
+
   [[nodiscard]] auto GetStartXPen(int32_t xPen) const -> int;
   [[nodiscard]] static auto GetStartYPen(int32_t yPen) noexcept -> int;
   auto WriteGlyph(const Spans& spans, int32_t xPen, int32_t yPen) noexcept -> void;
@@ -377,6 +433,11 @@ auto TextDrawer::GetLineSpacing() const noexcept -> int32_t
   return m_pimpl->GetLineSpacing();
 }
 
+auto TextDrawer::GetOutlineWidth() const noexcept -> float
+{
+  return m_pimpl->GetOutlineWidth();
+}
+
 auto TextDrawer::SetOutlineWidth(const float val) noexcept -> void
 {
   m_pimpl->SetOutlineWidth(val);
@@ -392,6 +453,11 @@ auto TextDrawer::SetCharSpacing(const float val) noexcept -> void
   m_pimpl->SetCharSpacing(val);
 }
 
+auto TextDrawer::GetCharSpacingAdvance() const noexcept -> int32_t
+{
+  return m_pimpl->GetCharSpacingAdvance();
+}
+
 auto TextDrawer::SetParallelRender(const bool val) noexcept -> void
 {
   m_pimpl->SetParallelRender(val);
@@ -447,6 +513,11 @@ auto TextDrawer::GetBearingY() const noexcept -> int32_t
   return m_pimpl->GetBearingY();
 }
 
+auto TextDrawer::GetPreparedText(PreparedText& preparedText) const -> void
+{
+  m_pimpl->GetPreparedText(preparedText);
+}
+
 auto TextDrawer::Draw(const Point2dInt& pen) -> void
 {
   m_pimpl->Draw(pen);
@@ -504,6 +575,7 @@ auto TextDrawer::TextDrawerImpl::SetFontFile(const std::string& filename) -> voi
   // until we are done using that font as FreeType will reference it directly.
   ::FT_New_Memory_Face(
       m_library, m_fontBuffer.data(), static_cast<FT_Long>(m_fontBuffer.size()), 0, &m_face);
+  ++m_faceId;
 
   SetFaceFontSize();
 }
@@ -542,6 +614,11 @@ inline auto TextDrawer::TextDrawerImpl::GetLineSpacing() const noexcept -> int32
   return m_face->height / static_cast<FT_Short>(FREE_TYPE_UNITS_PER_PIXEL);
 }
 
+inline auto TextDrawer::TextDrawerImpl::GetOutlineWidth() const noexcept -> float
+{
+  return m_outlineWidth;
+}
+
 inline auto TextDrawer::TextDrawerImpl::SetOutlineWidth(const float val) noexcept -> void
 {
   Expects(val > 0.0F);
@@ -561,6 +638,11 @@ inline auto TextDrawer::TextDrawerImpl::SetCharSpacing(const float val) noexcept
   m_charSpacing = val;
 }
 
+inline auto TextDrawer::TextDrawerImpl::GetCharSpacingAdvance() const noexcept -> int32_t
+{
+  return static_cast<int32_t>(m_charSpacing * static_cast<float>(m_fontSize));
+}
+
 inline auto TextDrawer::TextDrawerImpl::SetParallelRender(const bool val) noexcept -> void
 {
   m_useParallelRender = val;
@@ -590,6 +672,10 @@ auto TextDrawer::TextDrawerImpl::Prepare() -> void
   Expects(m_face != nullptr);
 
   m_textSpans.resize(0);
+  if (m_glyphCache.size() > MAX_CACHED_GLYPHS)
+  {
+    m_glyphCache.clear();
+  }
 
   auto xMax = 0;
   auto yMin = std::numeric_limits<int32_t>::max();
@@ -607,29 +693,18 @@ auto TextDrawer::TextDrawerImpl::Prepare() -> void
     utf32Text = conv.from_bytes(" ");
   }
 
+  const auto charSpacingAdvance = GetCharSpacingAdvance();
+
   for (auto i = 0U; i < utf32Text.size(); ++i)
   {
-    // Load the glyph we are looking for.
-    if (const auto gIndex = ::FT_Get_Char_Index(m_face, static_cast<FT_ULong>(utf32Text[i]));
-        ::FT_Load_Glyph(m_face, gIndex, FT_LOAD_NO_BITMAP) != 0)
-    {
-      throw std::runtime_error(
-          std::format("Could not load font char '{}' and glyph index {}.", m_theText[i], gIndex));
-    }
-
-    // Need an outline for this to work.
-    if (m_face->glyph->format != FT_GLYPH_FORMAT_OUTLINE)
-    {
-      throw std::logic_error(std::format("Not a correct font format: {}.",
-                                         static_cast<int32_t>(m_face->glyph->format)));
-    }
-
-    const auto spans = GetSpans(i);
-    m_textSpans.emplace_back(spans);
-
-    xMax += spans.advance;
-    yMin = std::min(yMin, spans.rect.yMin);
-    yMax = std::max(yMax, spans.rect.yMax);
+    const auto& glyphSpans = GetCachedGlyphSpans(utf32Text[i]);
+    const auto advance     = glyphSpans.advance + charSpacingAdvance;
+    m_textSpans.emplace_back(
+        Spans{.glyphSpans = &glyphSpans, .textIndexOfChar = i, .advance = advance});
+
+    xMax += advance;
+    yMin = std::min(yMin, glyphSpans.rect.yMin);
+    yMax = std::max(yMax, glyphSpans.rect.yMax);
   }
 
   m_textBoundingRect.xMin = 0;
@@ -646,6 +721,44 @@ auto TextDrawer::TextDrawerImpl::Prepare() -> void
           m_textSpans.size()); // NOLINT
 }
 
+auto TextDrawer::TextDrawerImpl::GetCachedGlyphSpans(const char32_t utf32Char)
+    -> const GlyphSpans&
+{
+  const auto glyphKey = GlyphKey{
+      .faceId       = m_faceId,
+      .fontSize     = m_fontSize,
+      .outlineWidth = ToFreeTypeCoord(m_outlineWidth),
+      .utf32Char    = utf32Char,
+  };
+
+  if (const auto cachedGlyph = m_glyphCache.find(glyphKey); cachedGlyph != m_glyphCache.cend())
+  {
+    return cachedGlyph->second;
+  }
+
+  LoadGlyph(utf32Char);
+  return m_glyphCache.emplace(glyphKey, GetGlyphSpans()).first->second;
+}
+
+auto TextDrawer::TextDrawerImpl::LoadGlyph(const char32_t utf32Char) const -> void
+{
+  // Load the glyph we are looking for.
+  if (const auto gIndex = ::FT_Get_Char_Index(m_face, static_cast<FT_ULong>(utf32Char));
+      ::FT_Load_Glyph(m_face, gIndex, FT_LOAD_NO_BITMAP) != 0)
+  {
+    throw std::runtime_error(std::format("Could not load font char {:#x} and glyph index {}.",
+                                         static_cast<uint32_t>(utf32Char),
+                                         gIndex));
+  }
+
+  // Need an outline for this to work.
+  if (m_face->glyph->format != FT_GLYPH_FORMAT_OUTLINE)
+  {
+    throw std::logic_error(std::format("Not a correct font format: {}.",
+                                       static_cast<int32_t>(m_face->glyph->format)));
+  }
+}
+
 auto TextDrawer::TextDrawerImpl::GetStartXPen(const int32_t xPen) const -> int
 {
   switch (m_textAlignment)
@@ -717,12 +830,19 @@ inline auto TextDrawer::TextDrawerImpl::WriteGlyph(const Spans& spans,
                                                    const int32_t xPen,
                                                    const int32_t yPen) noexcept -> void
 {
+  const auto& glyphSpans = *spans.glyphSpans;
+
   // Loop over the outline spans and just draw them into the image.
-  WriteSpansToImage(
-      spans.outlineSpans, spans.rect, xPen, yPen, spans.textIndexOfChar, m_getOutlineFontColor);
+  WriteSpansToImage(glyphSpans.outlineSpans,
+                    glyphSpans.rect,
+                    xPen,
+                    yPen,
+                    spans.textIndexOfChar,
+                    m_getOutlineFontColor);
 
   // Then loop over the regular glyph spans and blend them into the image.
-  WriteSpansToImage(spans.stdSpans, spans.rect, xPen, yPen, spans.textIndexOfChar, m_getFontColor);
+  WriteSpansToImage(
+      glyphSpans.stdSpans, glyphSpans.rect, xPen, yPen, spans.textIndexOfChar, m_getFontColor);
 }
 
 auto TextDrawer::TextDrawerImpl::WriteSpansToImage(const SpanArray& spanArray,
@@ -835,34 +955,31 @@ auto TextDrawer::TextDrawerImpl::RenderSpans(FT_Outline* const outline,
   ::FT_Outline_Render(m_library, outline, &params);
 }
 
-auto TextDrawer::TextDrawerImpl::GetSpans(const size_t textIndexOfChar) const -> Spans
+auto TextDrawer::TextDrawerImpl::GetGlyphSpans() const -> GlyphSpans
 {
   const auto stdSpans = GetStdSpans();
-  const auto advance  = ToStdPixelCoord(static_cast<int32_t>(m_face->glyph->advance.x)) +
-                       static_cast<int>(m_charSpacing * static_cast<float>(m_fontSize));
-  const auto metrics = m_face->glyph->metrics;
+  const auto advance  = ToStdPixelCoord(static_cast<int32_t>(m_face->glyph->advance.x));
+  const auto metrics  = m_face->glyph->metrics;
   if (stdSpans.empty())
   {
-    return Spans{
-        .stdSpans        = stdSpans,
-        .outlineSpans    = SpanArray{},
-        .textIndexOfChar = textIndexOfChar,
-        .rect            = RectImpl{},
-        .advance         = advance,
-        .bearingX        = ToStdPixelCoord(static_cast<int32_t>(metrics.horiBearingX)),
-        .bearingY        = ToStdPixelCoord(static_cast<int32_t>(metrics.horiBearingY)),
+    return GlyphSpans{
+        .stdSpans     = stdSpans,
+        .outlineSpans = SpanArray{},
+        .rect         = RectImpl{},
+        .advance      = advance,
+        .bearingX     = ToStdPixelCoord(static_cast<int32_t>(metrics.horiBearingX)),
+        .bearingY     = ToStdPixelCoord(static_cast<int32_t>(metrics.horiBearingY)),
     };
   }
 
   const auto outlineSpans = GetOutlineSpans();
-  return Spans{
-      .stdSpans        = stdSpans,
-      .outlineSpans    = outlineSpans,
-      .textIndexOfChar = textIndexOfChar,
-      .rect            = GetBoundingRect(stdSpans, outlineSpans),
-      .advance         = advance,
-      .bearingX        = ToStdPixelCoord(static_cast<int32_t>(metrics.horiBearingX)),
-      .bearingY        = ToStdPixelCoord(static_cast<int32_t>(metrics.horiBearingY)),
+  return GlyphSpans{
+      .stdSpans     = stdSpans,
+      .outlineSpans = outlineSpans,
+      .rect         = GetBoundingRect(stdSpans, outlineSpans),
+      .advance      = advance,
+      .bearingX     = ToStdPixelCoord(static_cast<int32_t>(metrics.horiBearingX)),
+      .bearingY     = ToStdPixelCoord(static_cast<int32_t>(metrics.horiBearingY)),
   };
 }
 
@@ -925,12 +1042,61 @@ inline auto TextDrawer::TextDrawerImpl::GetPreparedTextBoundingRect() const noex
 
 inline auto TextDrawer::TextDrawerImpl::GetBearingX() const noexcept -> int32_t
 {
-  return m_textSpans.front().bearingX;
+  return m_textSpans.front().glyphSpans->bearingX;
 }
 
 inline auto TextDrawer::TextDrawerImpl::GetBearingY() const noexcept -> int32_t
 {
-  return m_textSpans.front().bearingY;
+  return m_textSpans.front().glyphSpans->bearingY;
+}
+
+auto TextDrawer::TextDrawerImpl::GetPreparedText(PreparedText& preparedText) const -> void
+{
+  preparedText.spans.clear();
+  preparedText.numChars = static_cast<uint32_t>(m_textSpans.size());
+  preparedText.width    = 0;
+
+  for (const auto& spans : m_textSpans)
+  {
+    // Same order as 'WriteGlyph'.
+    const auto& glyphSpans = *spans.glyphSpans;
+    AddTextSpans(glyphSpans.outlineSpans,
+                 glyphSpans.rect,
+                 preparedText.width,
+                 spans.textIndexOfChar,
+                 true,
+                 preparedText.spans);
+    AddTextSpans(glyphSpans.stdSpans,
+                 glyphSpans.rect,
+                 preparedText.width,
+                 spans.textIndexOfChar,
+                 false,
+                 preparedText.spans);
+    preparedText.width += glyphSpans.advance;
+  }
+}
+
+auto TextDrawer::TextDrawerImpl::AddTextSpans(const SpanArray& spanArray,
+                                              const RectImpl& rect,
+                                              const int32_t xPen,
+                                              const size_t textIndexOfChar,
+                                              const bool isOutline,
+                                              std::vector<TextSpan>& textSpans) -> void
+{
+  // Same positions and char points as 'WriteXSpan'.
+  for (const auto& span : spanArray)
+  {
+    const auto xf0 = span.x - rect.xMin;
+    textSpans.emplace_back(TextSpan{
+        .start           = {.x = xPen + xf0, .y = -span.y},
+        .width           = span.width,
+        .coverage        = ToPixelAlpha(static_cast<uint8_t>(span.coverage)),
+        .isOutline       = isOutline,
+        .textIndexOfChar = textIndexOfChar,
+        .charPoint       = {.x = xf0, .y = IntHeight(rect) - (span.y - rect.yMin)},
+        .charDimensions  = {Width(rect), Height(rect)},
+    });
+  }
 }
 
 auto TextDrawer::TextDrawerImpl::GetBoundingRect(const SpanArray& stdSpans,
@@ -4,6 +4,7 @@ module;
 #include <cstdint>
 #include <functional>
 #include <string>
+#include <vector>
 
 export module Goom.Draw.ShaperDrawers.TextDrawer;
 
@@ -33,9 +34,12 @@ public:
   [[nodiscard]] auto GetFontSize() const noexcept -> int32_t;
   auto SetFontSize(int32_t val) -> void;
   [[nodiscard]] auto GetLineSpacing() const noexcept -> int32_t;
+  [[nodiscard]] auto GetOutlineWidth() const noexcept -> float;
   auto SetOutlineWidth(float val) noexcept -> void;
   [[nodiscard]] auto GetCharSpacing() const noexcept -> float;
   auto SetCharSpacing(float val) noexcept -> void;
+  // The char spacing in pixels, at the current font size.
+  [[nodiscard]] auto GetCharSpacingAdvance() const noexcept -> int32_t;
   [[nodiscard]] auto GetFontFile() const noexcept -> const std::string&;
   auto SetFontFile(const std::string& filename) -> void;
 
@@ -47,6 +51,9 @@ public:
   auto SetParallelRender(bool val) noexcept -> void;
 
   auto SetText(const std::string& str) noexcept -> void;
+  // The glyphs are cached once rasterized. The cache is emptied, at the next prepare, once it
+  // holds more than this many glyphs.
+  static constexpr auto MAX_CACHED_GLYPHS = 1000U;
   auto Prepare() -> void;
 
   struct Rect
@@ -63,6 +70,30 @@ public:
   [[nodiscard]] auto GetBearingX() const noexcept -> int;
   [[nodiscard]] auto GetBearingY() const noexcept -> int;
 
+  // The prepared text as spans, so it can be drawn again without being prepared again.
+  struct TextSpan
+  {
+    // Relative to the pen of the text, left aligned and with no char spacing.
+    Point2dInt start;
+    int32_t width;
+    PixelChannelType coverage;
+    bool isOutline;
+    size_t textIndexOfChar;
+    // Where 'start' is in its char, and the char size, as given to the font color funcs.
+    Point2dInt charPoint;
+    Dimensions charDimensions;
+  };
+  struct PreparedText
+  {
+    // In the order they are drawn.
+    std::vector<TextSpan> spans;
+    uint32_t numChars;
+    // Without any char spacing.
+    int32_t width;
+  };
+  // Replaces the contents of 'preparedText', so a reused span vector keeps its capacity.
+  auto GetPreparedText(PreparedText& preparedText) const -> void;
+
   auto Draw(const Point2dInt& pen) -> void;
   auto Draw(const Point2dInt& pen, Point2dInt& nextPen) -> void;
 
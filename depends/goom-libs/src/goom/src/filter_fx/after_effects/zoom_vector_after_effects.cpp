@@ -1,6 +1,8 @@
 module;
 
+#include <algorithm>
 #include <cstdint>
+#include <span>
 #include <utility>
 
 module Goom.FilterFx.AfterEffects.ZoomVectorAfterEffects;
@@ -18,6 +20,7 @@ import Goom.FilterFx.AfterEffects.AfterEffectsStates;
 import Goom.FilterFx.AfterEffects.AfterEffectsTypes;
 import Goom.FilterFx.NormalizedCoords;
 import Goom.Utils.NameValuePairs;
+import Goom.Lib.AssertUtils;
 import Goom.Lib.Point2d;
 
 namespace GOOM::FILTER_FX::AFTER_EFFECTS
@@ -112,6 +115,98 @@ auto ZoomVectorAfterEffects::GetAfterEffectsVelocity(
   return newVelocity - zoomVelocity;
 }
 
+auto ZoomVectorAfterEffects::GetAfterEffectsVelocities(
+    const std::span<const NormalizedCoords> coords,
+    const std::span<const NormalizedCoords> zoomVelocities,
+    const std::span<NormalizedCoords> afterEffectsVelocities) const noexcept -> void
+{
+  Expects(zoomVelocities.size() == coords.size());
+  Expects(afterEffectsVelocities.size() == coords.size());
+
+  const auto numCoords = coords.size();
+  auto& newVelocities  = afterEffectsVelocities;
+
+  std::ranges::copy(zoomVelocities, newVelocities.begin());
+
+  if (m_afterEffectsSettings.isActive[AfterEffectsTypes::IMAGE_VELOCITY])
+  {
+    const auto& imageVelocity = m_afterEffects.GetImageVelocity();
+    for (auto i = 0U; i < numCoords; ++i)
+    {
+      newVelocities[i] =
+          imageVelocity.GetVelocity({.coords = coords[i], .velocity = newVelocities[i]});
+    }
+  }
+
+  if (m_afterEffectsSettings.isActive[AfterEffectsTypes::XY_LERP_EFFECT])
+  {
+    const auto& xyLerpEffect = m_afterEffects.GetXYLerpEffect();
+    for (auto i = 0U; i < numCoords; ++i)
+    {
+      newVelocities[i] = xyLerpEffect.GetVelocity(SqDistanceFromZero(coords[i]), newVelocities[i]);
+    }
+  }
+
+  if (m_afterEffectsSettings.isActive[AfterEffectsTypes::ROTATION])
+  {
+    const auto& rotation = m_afterEffects.GetRotation();
+    for (auto i = 0U; i < numCoords; ++i)
+    {
+      newVelocities[i] = rotation.GetVelocity(newVelocities[i]);
+    }
+  }
+
+  if (m_afterEffectsSettings.isActive[AfterEffectsTypes::TAN_EFFECT])
+  {
+    const auto& tanEffect = m_afterEffects.GetTanEffect();
+    for (auto i = 0U; i < numCoords; ++i)
+    {
+      newVelocities[i] = tanEffect.GetVelocity(SqDistanceFromZero(coords[i]), newVelocities[i]);
+    }
+  }
+
+  if (m_afterEffectsSettings.isActive[AfterEffectsTypes::NOISE])
+  {
+    const auto& noise = m_afterEffects.GetNoise();
+    for (auto i = 0U; i < numCoords; ++i)
+    {
+      newVelocities[i] = noise.GetVelocity(newVelocities[i]);
+    }
+  }
+
+  if (m_afterEffectsSettings.hypercosOverlayMode != HypercosOverlayMode::NONE)
+  {
+    const auto& hypercos = m_afterEffects.GetHypercos();
+    for (auto i = 0U; i < numCoords; ++i)
+    {
+      newVelocities[i] = hypercos.GetVelocity(coords[i], newVelocities[i]);
+    }
+  }
+
+  if (const auto& planes = m_afterEffects.GetPlanes(); planes.IsHorizontalPlaneVelocityActive())
+  {
+    for (auto i = 0U; i < numCoords; ++i)
+    {
+      newVelocities[i].SetX(
+          planes.GetHorizontalPlaneVelocity({.coords = coords[i], .velocity = newVelocities[i]}));
+    }
+  }
+
+  if (const auto& planes = m_afterEffects.GetPlanes(); planes.IsVerticalPlaneVelocityActive())
+  {
+    for (auto i = 0U; i < numCoords; ++i)
+    {
+      newVelocities[i].SetY(
+          planes.GetVerticalPlaneVelocity({.coords = coords[i], .velocity = newVelocities[i]}));
+    }
+  }
+
+  for (auto i = 0U; i < numCoords; ++i)
+  {
+    newVelocities[i] -= zoomVelocities[i];
+  }
+}
+
 auto ZoomVectorAfterEffects::SetRandomHypercosOverlayEffects() noexcept -> void
 {
   switch (m_afterEffectsSettings.hypercosOverlayMode)
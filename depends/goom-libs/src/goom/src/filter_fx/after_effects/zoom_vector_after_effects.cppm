@@ -1,6 +1,7 @@
 module;
 
 #include <cstdint>
+#include <span>
 
 export module Goom.FilterFx.AfterEffects.ZoomVectorAfterEffects;
 
@@ -26,6 +27,12 @@ public:
                                              float sqDistFromZero,
                                              const NormalizedCoords& zoomVelocity) const noexcept
       -> NormalizedCoords;
+  // Batched version of 'GetAfterEffectsVelocity' - each active after effect is
+  // applied to the whole batch before moving on to the next one.
+  auto GetAfterEffectsVelocities(std::span<const NormalizedCoords> coords,
+                                 std::span<const NormalizedCoords> zoomVelocities,
+                                 std::span<NormalizedCoords> afterEffectsVelocities) const noexcept
+      -> void;
 
   static constexpr auto* PARAM_GROUP = "After Effects";
   [[nodiscard]] auto GetAfterEffectsNameValueParams() const noexcept -> UTILS::NameValuePairs;
@@ -1,8 +1,13 @@
 module;
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <mutex>
+#include <span>
 
 module Goom.FilterFx.FilterBuffers;
 
@@ -15,10 +20,10 @@ namespace GOOM::FILTER_FX
 
 ZoomFilterBuffers::ZoomFilterBuffers(const PluginInfo& goomInfo,
                                      const NormalizedCoordsConverter& normalizedCoordsConverter,
-                                     const ZoomPointFunc& getZoomPointFunc) noexcept
+                                     const ZoomPointsFunc& getZoomPointsFunc) noexcept
   : m_dimensions{goomInfo.GetDimensions()},
     m_normalizedCoordsConverter{&normalizedCoordsConverter},
-    m_getZoomPoint{getZoomPointFunc},
+    m_getZoomPoints{getZoomPointsFunc},
     m_transformBuffer(m_dimensions.GetSize())
 {
 }
@@ -51,17 +56,45 @@ auto ZoomFilterBuffers::ResetTransformBufferToStart() noexcept -> void
   m_updateStatus = UpdateStatus::AT_START;
 }
 
+auto ZoomFilterBuffers::SetTransformBufferDest(const std::span<Point2dFlt> destBuff) noexcept
+    -> void
+{
+  Expects(UpdateStatus::IN_PROGRESS != m_updateStatus);
+
+  if (destBuff.empty())
+  {
+    m_transformBufferDest = m_transformBuffer;
+    return;
+  }
+
+  Expects(destBuff.size() == m_dimensions.GetSize());
+  m_transformBufferDest = destBuff;
+}
+
 auto ZoomFilterBuffers::StartTransformBufferUpdates() noexcept -> void
 {
   const auto lock = std::scoped_lock<std::mutex>{m_mutex};
 
   Expects(UpdateStatus::AT_START == m_updateStatus);
 
+  m_numRowsDone  = 0U;
   m_updateStatus = UpdateStatus::IN_PROGRESS;
 
   m_bufferProducer_cv.notify_all();
 }
 
+auto ZoomFilterBuffers::RequestTransformBufferRestart() noexcept -> void
+{
+  const auto lock = std::scoped_lock<std::mutex>{m_mutex};
+
+  if (UpdateStatus::IN_PROGRESS != m_updateStatus)
+  {
+    return;
+  }
+
+  m_restartRequested = true;
+}
+
 auto ZoomFilterBuffers::TransformBufferThread() noexcept -> void
 {
   while (not m_shutdown)
@@ -94,10 +127,22 @@ auto ZoomFilterBuffers::UpdateTransformBuffer() noexcept -> void
 
   lock.unlock();
 
-  DoNextTransformBuffer();
+  const auto startTime       = std::chrono::steady_clock::now();
+  const auto bufferCompleted = DoNextTransformBuffer();
+  const auto timeTaken       = std::chrono::steady_clock::now() - startTime;
 
   lock.lock();
 
+  // Even a completed buffer is stale if a restart was asked for after the last row was done.
+  if ((not bufferCompleted) or m_restartRequested)
+  {
+    m_restartRequested = false;
+    m_updateStatus     = UpdateStatus::AT_START;
+    return;
+  }
+
+  m_lastTransformBufferTimeInNs = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(timeTaken).count());
   m_updateStatus = UpdateStatus::AT_END;
 }
 
@@ -108,7 +153,7 @@ auto ZoomFilterBuffers::UpdateTransformBuffer() noexcept -> void
  * Translation (-data->middleX, -data->middleY)
  * Homothetie (Center : 0,0   Coeff : 2/data->screenWidth)
  */
-auto ZoomFilterBuffers::DoNextTransformBuffer() noexcept -> void
+auto ZoomFilterBuffers::DoNextTransformBuffer() noexcept -> bool
 {
   const auto screenWidth          = m_dimensions.GetWidth();
   const auto screenSpan           = static_cast<float>(screenWidth - 1);
@@ -116,6 +161,13 @@ auto ZoomFilterBuffers::DoNextTransformBuffer() noexcept -> void
 
   const auto doTransformBufferRow = [this, &screenWidth, &sourceCoordsStepSize](const size_t y)
   {
+    // Rows are the unit of preemption - once a restart is asked for, the remaining
+    // rows are skipped and the pool gets through them quickly.
+    if (m_restartRequested)
+    {
+      return;
+    }
+
     // Y-position of the first stripe pixel to compute in screen coordinates.
     const auto yScreenCoord = static_cast<uint32_t>(y);
     auto tranBufferPos      = yScreenCoord * screenWidth;
@@ -124,19 +176,37 @@ auto ZoomFilterBuffers::DoNextTransformBuffer() noexcept -> void
         m_normalizedCoordsConverter->OtherToNormalizedCoords(GetPoint2dInt(0U, yScreenCoord)) -
         m_normalizedMidpoint;
 
-    for (auto x = 0U; x < screenWidth; ++x)
-    {
-      const auto zoomPoint           = m_getZoomPoint(centredSourceCoords);
-      const auto uncenteredZoomPoint = m_normalizedMidpoint + zoomPoint;
-
-      m_transformBuffer[tranBufferPos] = uncenteredZoomPoint.GetFltCoords();
+    auto sourceCoords = std::array<NormalizedCoords, ZOOM_POINTS_BATCH_SIZE>{};
+    auto zoomPoints   = std::array<NormalizedCoords, ZOOM_POINTS_BATCH_SIZE>{};
 
-      centredSourceCoords.IncX(sourceCoordsStepSize);
-      ++tranBufferPos;
+    for (auto x = 0U; x < screenWidth; x += ZOOM_POINTS_BATCH_SIZE)
+    {
+      const auto batchSize         = std::min(ZOOM_POINTS_BATCH_SIZE, screenWidth - x);
+      const auto batchSourceCoords = std::span{sourceCoords}.first(batchSize);
+      const auto batchZoomPoints   = std::span{zoomPoints}.first(batchSize);
+
+      for (auto& sourceCoord : batchSourceCoords)
+      {
+        sourceCoord = centredSourceCoords;
+        centredSourceCoords.IncX(sourceCoordsStepSize);
+      }
+
+      m_getZoomPoints(batchSourceCoords, batchZoomPoints);
+
+      for (const auto& zoomPoint : batchZoomPoints)
+      {
+        const auto uncenteredZoomPoint       = m_normalizedMidpoint + zoomPoint;
+        m_transformBufferDest[tranBufferPos] = uncenteredZoomPoint.GetFltCoords();
+        ++tranBufferPos;
+      }
     }
+
+    m_numRowsDone.fetch_add(1U, std::memory_order_relaxed);
   };
 
   m_parallel.ForLoop(m_dimensions.GetHeight(), doTransformBufferRow);
+
+  return m_numRowsDone == m_dimensions.GetHeight();
 }
 
 } // namespace GOOM::FILTER_FX
@@ -1,7 +1,9 @@
 module;
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <mutex>
 #include <span>
@@ -30,11 +32,12 @@ public:
     HAS_BEEN_COPIED,
   };
 
-  using ZoomPointFunc = std::function<NormalizedCoords(const NormalizedCoords& normalizedCoords)>;
+  using ZoomPointsFunc = std::function<void(std::span<const NormalizedCoords> normalizedCoords,
+                                            std::span<NormalizedCoords> zoomPoints)>;
 
   ZoomFilterBuffers(const PluginInfo& goomInfo,
                     const NormalizedCoordsConverter& normalizedCoordsConverter,
-                    const ZoomPointFunc& getZoomPointFunc) noexcept;
+                    const ZoomPointsFunc& getZoomPointsFunc) noexcept;
 
   auto SetTransformBufferMidpoint(const Point2dInt& midpoint) noexcept -> void;
 
@@ -47,6 +50,22 @@ public:
   auto ResetTransformBufferToStart() noexcept -> void;
   auto StartTransformBufferUpdates() noexcept -> void;
 
+  // Asks the producer to abandon the buffer it's working on. This has no effect unless the
+  // buffer is in progress. Once the producer has stopped, the status goes back to AT_START.
+  auto RequestTransformBufferRestart() noexcept -> void;
+  [[nodiscard]] auto IsTransformBufferRestartRequested() const noexcept -> bool;
+  // The fraction, in [0, 1], of the current transform buffer that has been done.
+  [[nodiscard]] auto GetTransformBufferProgress() const noexcept -> float;
+  // Wall time the producer took over the last completed transform buffer.
+  [[nodiscard]] auto GetLastTransformBufferTimeInNs() const noexcept -> uint64_t;
+
+  // The buffer the producer writes into. By default this is an internal buffer, but giving
+  // the producer the final destination means the hand over doesn't need a copy.
+  auto SetTransformBufferDest(std::span<Point2dFlt> destBuff) noexcept -> void;
+  [[nodiscard]] auto GetTransformBufferDest() const noexcept -> std::span<const Point2dFlt>;
+  [[nodiscard]] auto UsesOwnTransformBuffer() const noexcept -> bool;
+
+  // Does not copy anything if 'destBuff' is the transform buffer destination.
   auto CopyTransformBuffer(std::span<Point2dFlt> destBuff) noexcept -> void;
 
 protected:
@@ -57,20 +76,27 @@ protected:
 private:
   Dimensions m_dimensions;
   const NormalizedCoordsConverter* m_normalizedCoordsConverter;
-  UpdateStatus m_updateStatus = UpdateStatus::AT_START;
+  std::atomic<UpdateStatus> m_updateStatus            = UpdateStatus::AT_START;
+  std::atomic<bool> m_restartRequested                = false;
+  std::atomic<uint32_t> m_numRowsDone                 = 0U;
+  std::atomic<uint64_t> m_lastTransformBufferTimeInNs = 0U;
 
   bool m_shutdown = false;
   std::mutex m_mutex;
   std::condition_variable m_bufferProducer_cv;
 
-  UTILS::Parallel m_parallel{UTILS::GetNumAvailablePoolThreads()};
-  ZoomPointFunc m_getZoomPoint;
+  UTILS::Parallel m_parallel{UTILS::TaskPriority::BACKGROUND};
+  ZoomPointsFunc m_getZoomPoints;
   Point2dInt m_midpoint                 = {.x = 0, .y = 0};
   NormalizedCoords m_normalizedMidpoint = {0.0F, 0.0F};
 
   std::vector<Point2dFlt> m_transformBuffer;
+  std::span<Point2dFlt> m_transformBufferDest{m_transformBuffer};
 
-  auto DoNextTransformBuffer() noexcept -> void;
+  // Zoom points are fetched a batch at a time to keep the per-point dispatch cost down.
+  static constexpr auto ZOOM_POINTS_BATCH_SIZE = 256U;
+  // Returns false if the buffer was abandoned before all the rows were done.
+  [[nodiscard]] auto DoNextTransformBuffer() noexcept -> bool;
 };
 
 } // namespace GOOM::FILTER_FX
@@ -83,6 +109,21 @@ inline auto ZoomFilterBuffers::GetUpdateStatus() const noexcept -> UpdateStatus
   return m_updateStatus;
 }
 
+inline auto ZoomFilterBuffers::IsTransformBufferRestartRequested() const noexcept -> bool
+{
+  return m_restartRequested;
+}
+
+inline auto ZoomFilterBuffers::GetTransformBufferProgress() const noexcept -> float
+{
+  return static_cast<float>(m_numRowsDone) / static_cast<float>(m_dimensions.GetHeight());
+}
+
+inline auto ZoomFilterBuffers::GetLastTransformBufferTimeInNs() const noexcept -> uint64_t
+{
+  return m_lastTransformBufferTimeInNs;
+}
+
 inline auto ZoomFilterBuffers::GetTransformBufferMidpoint() const noexcept -> Point2dInt
 {
   return m_midpoint;
@@ -97,11 +138,25 @@ inline auto ZoomFilterBuffers::SetTransformBufferMidpoint(const Point2dInt& midp
   m_normalizedMidpoint = m_normalizedCoordsConverter->OtherToNormalizedCoords(m_midpoint);
 }
 
+inline auto ZoomFilterBuffers::GetTransformBufferDest() const noexcept
+    -> std::span<const Point2dFlt>
+{
+  return m_transformBufferDest;
+}
+
+inline auto ZoomFilterBuffers::UsesOwnTransformBuffer() const noexcept -> bool
+{
+  return m_transformBufferDest.data() == m_transformBuffer.data();
+}
+
 inline auto ZoomFilterBuffers::CopyTransformBuffer(std::span<Point2dFlt> destBuff) noexcept -> void
 {
   Expects(UpdateStatus::AT_END == m_updateStatus);
 
-  std::ranges::copy(m_transformBuffer, destBuff.begin());
+  if (destBuff.data() != m_transformBufferDest.data())
+  {
+    std::ranges::copy(m_transformBufferDest, destBuff.begin());
+  }
   m_updateStatus = UpdateStatus::HAS_BEEN_COPIED;
 }
 
@@ -6,6 +6,7 @@ module;
 #include <cstdint>
 #include <format>
 #include <memory>
+#include <span>
 #include <string>
 #include <thread>
 #include <utility>
@@ -35,8 +36,9 @@ FilterBuffersService::FilterBuffersService(
     m_zoomVector{std::move(zoomVector)},
     m_filterBuffers{goomInfo,
                     normalizedCoordsConverter,
-                    [this](const NormalizedCoords& normalizedCoords)
-                    { return m_zoomVector->GetZoomPoint(normalizedCoords); }}
+                    [this](const std::span<const NormalizedCoords> normalizedCoords,
+                           const std::span<NormalizedCoords> zoomPoints)
+                    { m_zoomVector->GetZoomPoints(normalizedCoords, zoomPoints); }}
 {
 }
 
@@ -59,7 +61,10 @@ auto FilterBuffersService::Start() noexcept -> void
   m_totalGoomTimeBetweenBufferResets = 0U;
   m_numTransformBuffersCompleted     = 0U;
   m_numTransformBufferResets         = 0U;
+  m_numTransformBuffersAbandoned     = 0U;
+  m_numConsecutiveBuffersAbandoned   = 0U;
 
+  SetTransformBufferDest();
   m_filterBuffers.Start();
 
   StartTransformBufferThread();
@@ -84,20 +89,58 @@ auto FilterBuffersService::UpdateAllPendingSettings() noexcept -> void
   m_pendingFilterEffectsSettings = false;
 }
 
+auto FilterBuffersService::SetTransformBufferDest() noexcept -> void
+{
+  m_filterBuffers.SetTransformBufferDest(m_nextTransformBufferDest);
+  m_transformBufferDestMapGeneration = m_nextTransformBufferDestMapGeneration;
+}
+
 auto FilterBuffersService::UpdateTransformBuffer() noexcept -> void
 {
-  if (ZoomFilterBuffers::UpdateStatus::HAS_BEEN_COPIED == m_filterBuffers.GetUpdateStatus())
+  const auto updateStatus = m_filterBuffers.GetUpdateStatus();
+
+  if (ZoomFilterBuffers::UpdateStatus::HAS_BEEN_COPIED == updateStatus)
   {
     UpdateCompletedTransformBufferStats();
   }
 
-  if (m_pendingFilterEffectsSettings and
-      (ZoomFilterBuffers::UpdateStatus::HAS_BEEN_COPIED == m_filterBuffers.GetUpdateStatus()))
+  if (not m_pendingFilterEffectsSettings)
+  {
+    return;
+  }
+
+  switch (updateStatus)
   {
-    CompletePendingSettings();
+    case ZoomFilterBuffers::UpdateStatus::HAS_BEEN_COPIED:
+    // AT_START here means the producer has stopped working on an abandoned buffer.
+    case ZoomFilterBuffers::UpdateStatus::AT_START:
+      CompletePendingSettings();
+      break;
+    case ZoomFilterBuffers::UpdateStatus::IN_PROGRESS:
+      AbandonStaleTransformBufferMaybe();
+      break;
+    // A finished buffer still gets copied - it keeps things moving until the new one is done.
+    case ZoomFilterBuffers::UpdateStatus::AT_END:
+      break;
   }
 }
 
+auto FilterBuffersService::AbandonStaleTransformBufferMaybe() noexcept -> void
+{
+  if ((not m_transformBufferRestartAllowed) or
+      m_filterBuffers.IsTransformBufferRestartRequested() or
+      (m_numConsecutiveBuffersAbandoned >= MAX_CONSECUTIVE_ABANDONED_BUFFERS))
+  {
+    return;
+  }
+
+  // The zoom vector can't take the new settings until the producer is finished with it,
+  // so just ask the producer to stop. The settings are applied when it gets back to AT_START.
+  m_filterBuffers.RequestTransformBufferRestart();
+  ++m_numTransformBuffersAbandoned;
+  ++m_numConsecutiveBuffersAbandoned;
+}
+
 auto FilterBuffersService::CompletePendingSettings() noexcept -> void
 {
   m_filterBuffers.ResetTransformBufferToStart();
@@ -109,6 +152,7 @@ auto FilterBuffersService::CompletePendingSettings() noexcept -> void
   Ensures(not m_pendingFilterEffectsSettings);
   ++m_numPendingFilterEffectsChanges;
 
+  SetTransformBufferDest();
   m_filterBuffers.StartTransformBufferUpdates();
   m_goomTimeAtTransformBufferStart = m_goomTime->GetCurrentTime();
   m_goomTimeAtTransformBufferReset = m_goomTime->GetCurrentTime();
@@ -124,6 +168,8 @@ auto FilterBuffersService::UpdateCompletedTransformBufferStats() noexcept -> voi
   m_totalGoomTimeOfBufferProcessing +=
       m_goomTime->GetElapsedTimeSince(m_goomTimeAtTransformBufferStart);
   ++m_numTransformBuffersCompleted;
+  m_numConsecutiveBuffersAbandoned = 0U;
+  m_transformBufferTimings.AddTime(0, m_filterBuffers.GetLastTransformBufferTimeInNs());
 
   m_goomTimeAtTransformBufferStart = 0U;
 }
@@ -134,11 +180,13 @@ auto FilterBuffersService::GetNameValueParams() const noexcept -> NameValuePairs
 
   return {GetPair(PARAM_GROUP,
                   "params",
-                  std::format("{}, {}, {}, {}",
+                  std::format("{}, {}, {}, {}, {}, {:.2f}",
                               m_numPendingFilterEffectsChanges,
                               m_numTransformBuffersCompleted,
+                              m_numTransformBuffersAbandoned,
                               GetAverageGoomTimeOfBufferProcessing(),
-                              GetAverageGoomTimeBetweenBufferResets()))};
+                              GetAverageGoomTimeBetweenBufferResets(),
+                              GetTransformBufferProgress()))};
 }
 
 auto FilterBuffersService::GetZoomVectorNameValueParams() const noexcept -> NameValuePairs
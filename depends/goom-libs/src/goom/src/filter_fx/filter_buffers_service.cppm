@@ -14,6 +14,7 @@ import Goom.FilterFx.NormalizedCoords;
 import Goom.FilterFx.ZoomVector;
 import Goom.Utils.GoomTime;
 import Goom.Utils.NameValuePairs;
+import Goom.Utils.StageTimings;
 import Goom.Lib.Point2d;
 import Goom.PluginInfo;
 
@@ -33,10 +34,23 @@ public:
   auto Start() noexcept -> void;
   auto Finish() noexcept -> void;
 
-  [[nodiscard]] auto IsTransformBufferReadyToCopy() const noexcept -> bool;
+  // The next transform buffer gets produced straight into 'destBuff'. It can then only be
+  // handed over, without a copy, to the frame that owns 'destBuff'. 'destBuff' must stay
+  // mapped for as long as 'mapGeneration' stays the same. If 'mapGeneration' is zero, the
+  // buffer is produced into an internal buffer and copied into the frame at hand over.
+  auto SetNextTransformBufferDest(std::span<Point2dFlt> destBuff, uint32_t mapGeneration) noexcept
+      -> void;
+  [[nodiscard]] auto IsTransformBufferReadyToCopy(
+      std::span<const Point2dFlt> destBuff) const noexcept -> bool;
   auto CopyTransformBuffer(std::span<Point2dFlt> destBuff) noexcept -> void;
 
   auto UpdateTransformBuffer() noexcept -> void;
+  // The fraction, in [0, 1], of the transform buffer in progress that has been done.
+  [[nodiscard]] auto GetTransformBufferProgress() const noexcept -> float;
+  // If not allowed, new settings wait for the buffer in progress instead of abandoning it.
+  auto SetTransformBufferRestartAllowed(bool value) noexcept -> void;
+  // The wall times the producer took over each completed transform buffer.
+  [[nodiscard]] auto GetTransformBufferTimings() const noexcept -> const UTILS::StageTimings&;
 
   [[nodiscard]] auto GetNameValueParams() const noexcept -> UTILS::NameValuePairs;
   [[nodiscard]] auto GetZoomVectorNameValueParams() const noexcept -> UTILS::NameValuePairs;
@@ -46,15 +60,21 @@ private:
   const UTILS::GoomTime* m_goomTime;
   std::unique_ptr<IZoomVector> m_zoomVector;
   ZoomFilterBuffers m_filterBuffers;
+  std::span<Point2dFlt> m_nextTransformBufferDest;
+  uint32_t m_nextTransformBufferDestMapGeneration = 0U;
+  uint32_t m_transformBufferDestMapGeneration     = 0U;
+  auto SetTransformBufferDest() noexcept -> void;
 
   FilterEffectsSettings m_nextFilterEffectsSettings{};
   bool m_pendingFilterEffectsSettings       = false;
   uint64_t m_numPendingFilterEffectsChanges = 0U;
+  bool m_transformBufferRestartAllowed      = true;
 
   std::thread m_bufferProducerThread;
   auto StartTransformBufferThread() noexcept -> void;
   auto UpdateCompletedTransformBufferStats() noexcept -> void;
   auto CompletePendingSettings() noexcept -> void;
+  auto AbandonStaleTransformBufferMaybe() noexcept -> void;
   auto UpdateAllPendingSettings() noexcept -> void;
 
   uint64_t m_goomTimeAtTransformBufferStart   = 0U;
@@ -63,6 +83,11 @@ private:
   uint64_t m_totalGoomTimeBetweenBufferResets = 0U;
   uint32_t m_numTransformBuffersCompleted     = 0U;
   uint32_t m_numTransformBufferResets         = 0U;
+  uint32_t m_numTransformBuffersAbandoned     = 0U;
+  uint32_t m_numConsecutiveBuffersAbandoned   = 0U;
+  UTILS::StageTimings m_transformBufferTimings{{"TRANSFORM_BUFFER_PRODUCTION"}};
+  // Stop a stream of settings changes from starving the screen of new buffers.
+  static constexpr auto MAX_CONSECUTIVE_ABANDONED_BUFFERS = 3U;
   [[nodiscard]] auto GetAverageGoomTimeOfBufferProcessing() const noexcept -> uint32_t;
   [[nodiscard]] auto GetAverageGoomTimeBetweenBufferResets() const noexcept -> uint32_t;
 };
@@ -72,9 +97,33 @@ private:
 namespace GOOM::FILTER_FX
 {
 
-inline auto FilterBuffersService::IsTransformBufferReadyToCopy() const noexcept -> bool
+inline auto FilterBuffersService::SetNextTransformBufferDest(
+    const std::span<Point2dFlt> destBuff, const uint32_t mapGeneration) noexcept -> void
+{
+  // While a buffer is being produced into a frame's dest, or is waiting to be handed over,
+  // that dest must not have been unmapped.
+  const auto updateStatus = m_filterBuffers.GetUpdateStatus();
+  Expects(m_filterBuffers.UsesOwnTransformBuffer() or
+              (mapGeneration == m_transformBufferDestMapGeneration) or
+              ((ZoomFilterBuffers::UpdateStatus::IN_PROGRESS != updateStatus) and
+               (ZoomFilterBuffers::UpdateStatus::AT_END != updateStatus)),
+          "The transform buffer dest was remapped while in use.");
+
+  m_nextTransformBufferDest = (0U == mapGeneration) ? std::span<Point2dFlt>{} : destBuff;
+  m_nextTransformBufferDestMapGeneration = mapGeneration;
+}
+
+inline auto FilterBuffersService::IsTransformBufferReadyToCopy(
+    const std::span<const Point2dFlt> destBuff) const noexcept -> bool
 {
-  return ZoomFilterBuffers::UpdateStatus::AT_END == m_filterBuffers.GetUpdateStatus();
+  if (ZoomFilterBuffers::UpdateStatus::AT_END != m_filterBuffers.GetUpdateStatus())
+  {
+    return false;
+  }
+
+  return m_filterBuffers.UsesOwnTransformBuffer() or
+         ((destBuff.data() == m_filterBuffers.GetTransformBufferDest().data()) and
+          (m_nextTransformBufferDestMapGeneration == m_transformBufferDestMapGeneration));
 }
 
 inline auto FilterBuffersService::CopyTransformBuffer(std::span<Point2dFlt> destBuff) noexcept
@@ -83,4 +132,21 @@ inline auto FilterBuffersService::CopyTransformBuffer(std::span<Point2dFlt> dest
   m_filterBuffers.CopyTransformBuffer(destBuff);
 }
 
+inline auto FilterBuffersService::GetTransformBufferProgress() const noexcept -> float
+{
+  return m_filterBuffers.GetTransformBufferProgress();
+}
+
+inline auto FilterBuffersService::SetTransformBufferRestartAllowed(const bool value) noexcept
+    -> void
+{
+  m_transformBufferRestartAllowed = value;
+}
+
+inline auto FilterBuffersService::GetTransformBufferTimings() const noexcept
+    -> const UTILS::StageTimings&
+{
+  return m_transformBufferTimings;
+}
+
 } // namespace GOOM::FILTER_FX
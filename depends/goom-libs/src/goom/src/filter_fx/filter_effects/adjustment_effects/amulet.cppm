@@ -1,5 +1,10 @@
+module;
+
+#include <span>
+
 export module Goom.FilterFx.FilterEffects.AdjustmentEffects.Amulet;
 
+import Goom.FilterFx.FilterEffects.AdjustmentEffects.ZoomAdjustmentKernels;
 import Goom.FilterFx.FilterEffects.ZoomAdjustmentEffect;
 import Goom.FilterFx.FilterUtils.Utils;
 import Goom.FilterFx.CommonTypes;
@@ -23,6 +28,8 @@ public:
 
   [[nodiscard]] auto GetZoomAdjustment(const NormalizedCoords& coords) const noexcept
       -> Vec2dFlt override;
+  auto GetZoomAdjustments(std::span<const NormalizedCoords> coords,
+                          std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void override;
 
   [[nodiscard]] auto GetZoomAdjustmentEffectNameValueParams() const noexcept
       -> NameValuePairs override;
@@ -83,4 +90,17 @@ inline auto Amulet::GetVelocity(const NormalizedCoords& coords) const noexcept -
   //?      speedCoeffs.y = 5.0F * std::cos(5.0F * speedCoeffs.x) * std::sin(5.0F * speedCoeffs.y);
 }
 
+inline auto Amulet::GetZoomAdjustments(const std::span<const NormalizedCoords> coords,
+                                       const std::span<Vec2dFlt> zoomAdjustments) const noexcept
+    -> void
+{
+  GetRadialVelocityZoomAdjustments({.viewportOffset = m_params.viewport.GetOffset(),
+                                    .viewportScale  = m_params.viewport.GetScale(),
+                                    .baseVelocity   = GetBaseZoomAdjustment(),
+                                    .amplitude      = {.x = m_params.amplitude.x,
+                                                       .y = m_params.amplitude.y}},
+                                   coords,
+                                   zoomAdjustments);
+}
+
 } // namespace GOOM::FILTER_FX::FILTER_EFFECTS
@@ -2,6 +2,7 @@ module;
 
 #include <complex>
 #include <cstdint>
+#include <span>
 #include <vector>
 
 export module Goom.FilterFx.FilterEffects.AdjustmentEffects.ComplexRational;
@@ -30,6 +31,8 @@ public:
 
   [[nodiscard]] auto GetZoomAdjustment(const NormalizedCoords& coords) const noexcept
       -> Vec2dFlt override;
+  auto GetZoomAdjustments(std::span<const NormalizedCoords> coords,
+                          std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void override;
 
   [[nodiscard]] auto GetZoomAdjustmentEffectNameValueParams() const noexcept
       -> NameValuePairs override;
@@ -92,4 +95,11 @@ inline auto ComplexRational::SetRandomParams() noexcept -> void
   m_params = GetRandomParams();
 }
 
+inline auto ComplexRational::GetZoomAdjustments(
+    const std::span<const NormalizedCoords> coords,
+    const std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void
+{
+  GetZoomAdjustmentsNonVirtual(*this, coords, zoomAdjustments);
+}
+
 } // namespace GOOM::FILTER_FX::FILTER_EFFECTS
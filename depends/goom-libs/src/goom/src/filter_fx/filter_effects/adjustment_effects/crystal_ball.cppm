@@ -1,5 +1,10 @@
+module;
+
+#include <span>
+
 export module Goom.FilterFx.FilterEffects.AdjustmentEffects.CrystalBall;
 
+import Goom.FilterFx.FilterEffects.AdjustmentEffects.ZoomAdjustmentKernels;
 import Goom.FilterFx.FilterEffects.ZoomAdjustmentEffect;
 import Goom.FilterFx.CommonTypes;
 import Goom.FilterFx.NormalizedCoords;
@@ -28,6 +33,8 @@ public:
 
   [[nodiscard]] auto GetZoomAdjustment(const NormalizedCoords& coords) const noexcept
       -> Vec2dFlt override;
+  auto GetZoomAdjustments(std::span<const NormalizedCoords> coords,
+                          std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void override;
 
   [[nodiscard]] auto GetZoomAdjustmentEffectNameValueParams() const noexcept
       -> NameValuePairs override;
@@ -121,4 +128,18 @@ inline auto CrystalBall::GetZoomAdjustment(const float baseZoomAdjustment,
   return baseZoomAdjustment - (amplitude * ((sqDistMult * sqDistFromZero) - sqDistOffset));
 }
 
+inline auto CrystalBall::GetZoomAdjustments(
+    const std::span<const NormalizedCoords> coords,
+    const std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void
+{
+  // base - (amp * x) is exactly base + (-amp * x), so this matches 'GetZoomAdjustment'.
+  GetRadialVelocityZoomAdjustments(
+      {.baseVelocity = GetBaseZoomAdjustment(),
+       .amplitude    = {.x = -m_params.amplitude.x, .y = -m_params.amplitude.y},
+       .sqDistMult   = {.x = m_params.sqDistMult.x, .y = m_params.sqDistMult.y},
+       .sqDistOffset = {.x = m_params.sqDistOffset.x, .y = m_params.sqDistOffset.y}},
+      coords,
+      zoomAdjustments);
+}
+
 } // namespace GOOM::FILTER_FX::FILTER_EFFECTS
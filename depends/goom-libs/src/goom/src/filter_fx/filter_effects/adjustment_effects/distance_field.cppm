@@ -1,6 +1,7 @@
 module;
 
 #include <cstdint>
+#include <span>
 #include <vector>
 
 export module Goom.FilterFx.FilterEffects.AdjustmentEffects.DistanceField;
@@ -37,6 +38,8 @@ public:
 
   [[nodiscard]] auto GetZoomAdjustment(const NormalizedCoords& coords) const noexcept
       -> Vec2dFlt override;
+  auto GetZoomAdjustments(std::span<const NormalizedCoords> coords,
+                          std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void override;
 
   [[nodiscard]] auto GetZoomAdjustmentEffectNameValueParams() const noexcept
       -> NameValuePairs override;
@@ -183,4 +186,11 @@ inline auto DistanceField::GetVelocity(const NormalizedCoords& coords) const noe
           .y = m_params.amplitude.y * sqDistFromClosestPoint};
 }
 
+inline auto DistanceField::GetZoomAdjustments(
+    const std::span<const NormalizedCoords> coords,
+    const std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void
+{
+  GetZoomAdjustmentsNonVirtual(*this, coords, zoomAdjustments);
+}
+
 } // namespace GOOM::FILTER_FX::FILTER_EFFECTS
@@ -1,6 +1,7 @@
 module;
 
 #include <complex>
+#include <span>
 
 export module Goom.FilterFx.FilterEffects.AdjustmentEffects.ExpReciprocal;
 
@@ -27,6 +28,8 @@ public:
 
   [[nodiscard]] auto GetZoomAdjustment(const NormalizedCoords& coords) const noexcept
       -> Vec2dFlt override;
+  auto GetZoomAdjustments(std::span<const NormalizedCoords> coords,
+                          std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void override;
 
   [[nodiscard]] auto GetZoomAdjustmentEffectNameValueParams() const noexcept
       -> NameValuePairs override;
@@ -77,4 +80,11 @@ inline auto ExpReciprocal::SetRandomParams() noexcept -> void
   m_params = GetRandomParams();
 }
 
+inline auto ExpReciprocal::GetZoomAdjustments(
+    const std::span<const NormalizedCoords> coords,
+    const std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void
+{
+  GetZoomAdjustmentsNonVirtual(*this, coords, zoomAdjustments);
+}
+
 } // namespace GOOM::FILTER_FX::FILTER_EFFECTS
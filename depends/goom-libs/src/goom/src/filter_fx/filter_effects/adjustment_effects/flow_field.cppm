@@ -1,3 +1,7 @@
+module;
+
+#include <span>
+
 export module Goom.FilterFx.FilterEffects.AdjustmentEffects.FlowField;
 
 import Goom.FilterFx.FilterEffects.AdjustmentEffects.DipoleFlowField;
@@ -27,6 +31,8 @@ public:
 
   [[nodiscard]] auto GetZoomAdjustment(const NormalizedCoords& coords) const noexcept
       -> Vec2dFlt override;
+  auto GetZoomAdjustments(std::span<const NormalizedCoords> coords,
+                          std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void override;
 
   [[nodiscard]] auto GetZoomAdjustmentEffectNameValueParams() const noexcept
       -> NameValuePairs override;
@@ -49,3 +55,15 @@ private:
 };
 
 } // namespace GOOM::FILTER_FX::FILTER_EFFECTS
+
+namespace GOOM::FILTER_FX::FILTER_EFFECTS
+{
+
+inline auto FlowField::GetZoomAdjustments(const std::span<const NormalizedCoords> coords,
+                                          const std::span<Vec2dFlt> zoomAdjustments) const noexcept
+    -> void
+{
+  GetZoomAdjustmentsNonVirtual(*this, coords, zoomAdjustments);
+}
+
+} // namespace GOOM::FILTER_FX::FILTER_EFFECTS
@@ -1,6 +1,10 @@
 module;
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <format>
+#include <span>
 #include <string>
 #include <utility>
 
@@ -10,6 +14,7 @@ import Goom.FilterFx.FilterEffects.ZoomAdjustmentEffect;
 import Goom.FilterFx.NormalizedCoords;
 import Goom.Utils.NameValuePairs;
 import Goom.Utils.Math.GoomRand;
+import Goom.Lib.AssertUtils;
 import Goom.Lib.Point2d;
 
 namespace GOOM::FILTER_FX::FILTER_EFFECTS
@@ -61,6 +66,51 @@ auto FunctionOfFunction::GetZoomAdjustment(const NormalizedCoords& coords) const
   return lerp(funcCoords, funcOfFuncCoords, m_funcToFuncOfLerpValue);
 }
 
+auto FunctionOfFunction::GetZoomAdjustments(
+    const std::span<const NormalizedCoords> coords,
+    const std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void
+{
+  Expects(zoomAdjustments.size() == coords.size());
+
+  for (auto i = 0U; i < coords.size(); i += MAX_BATCH_SIZE)
+  {
+    const auto batchSize = std::min<size_t>(MAX_BATCH_SIZE, coords.size() - i);
+    GetBatchOfZoomAdjustments(coords.subspan(i, batchSize), zoomAdjustments.subspan(i, batchSize));
+  }
+}
+
+auto FunctionOfFunction::GetBatchOfZoomAdjustments(
+    const std::span<const NormalizedCoords> coords,
+    const std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void
+{
+  auto funcCoords       = std::array<Vec2dFlt, MAX_BATCH_SIZE>{};
+  auto lerpedCoords     = std::array<NormalizedCoords, MAX_BATCH_SIZE>{};
+  auto funcOfFuncCoords = std::array<Vec2dFlt, MAX_BATCH_SIZE>{};
+
+  const auto batchSize             = coords.size();
+  const auto batchFuncCoords       = std::span{funcCoords}.first(batchSize);
+  const auto batchLerpedCoords     = std::span{lerpedCoords}.first(batchSize);
+  const auto batchFuncOfFuncCoords = std::span{funcOfFuncCoords}.first(batchSize);
+
+  m_func->GetZoomAdjustments(coords, batchFuncCoords);
+
+  const auto coordsToFuncCoordsLerpValue = m_useFullFuncOf ? 1.0F : m_coordsToFuncCoordsLerpValue;
+  for (auto i = 0U; i < batchSize; ++i)
+  {
+    const auto coordsToFuncCoordsLerp =
+        lerp(ToVec2dFlt(coords[i].GetFltCoords()), batchFuncCoords[i], coordsToFuncCoordsLerpValue);
+    batchLerpedCoords[i] = NormalizedCoords{coordsToFuncCoordsLerp.x, coordsToFuncCoordsLerp.y};
+  }
+
+  m_funcOf->GetZoomAdjustments(batchLerpedCoords, batchFuncOfFuncCoords);
+
+  for (auto i = 0U; i < batchSize; ++i)
+  {
+    zoomAdjustments[i] =
+        lerp(batchFuncCoords[i], batchFuncOfFuncCoords[i], m_funcToFuncOfLerpValue);
+  }
+}
+
 auto FunctionOfFunction::GetZoomAdjustmentEffectNameValueParams() const noexcept -> NameValuePairs
 {
   auto nameValueParams = NameValuePairs{GetPair(PARAM_GROUP,
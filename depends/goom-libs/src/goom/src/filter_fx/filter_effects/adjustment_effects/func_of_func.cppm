@@ -1,6 +1,7 @@
 module;
 
 #include <memory>
+#include <span>
 #include <string>
 
 export module Goom.FilterFx.FilterEffects.AdjustmentEffects.FunctionOfFunction;
@@ -32,6 +33,8 @@ public:
 
   [[nodiscard]] auto GetZoomAdjustment(const NormalizedCoords& coords) const noexcept
       -> Vec2dFlt override;
+  auto GetZoomAdjustments(std::span<const NormalizedCoords> coords,
+                          std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void override;
 
   [[nodiscard]] auto GetZoomAdjustmentEffectNameValueParams() const noexcept
       -> UTILS::NameValuePairs override;
@@ -50,6 +53,10 @@ private:
 
   static constexpr auto PROB_USE_FULL_FUNC_OF = 0.1F;
   bool m_useFullFuncOf                        = false;
+
+  static constexpr auto MAX_BATCH_SIZE = 64U;
+  auto GetBatchOfZoomAdjustments(std::span<const NormalizedCoords> coords,
+                                 std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void;
 };
 
 } // namespace GOOM::FILTER_FX::FILTER_EFFECTS
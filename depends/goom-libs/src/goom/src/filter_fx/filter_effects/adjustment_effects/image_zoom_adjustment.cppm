@@ -1,5 +1,6 @@
 module;
 
+#include <span>
 #include <string>
 
 export module Goom.FilterFx.FilterEffects.AdjustmentEffects.ImageZoomAdjustment;
@@ -26,6 +27,8 @@ public:
 
   [[nodiscard]] auto GetZoomAdjustment(const NormalizedCoords& coords) const noexcept
       -> Vec2dFlt override;
+  auto GetZoomAdjustments(std::span<const NormalizedCoords> coords,
+                          std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void override;
 
   [[nodiscard]] auto GetZoomAdjustmentEffectNameValueParams() const noexcept
       -> NameValuePairs override;
@@ -56,4 +59,11 @@ inline auto ImageZoomAdjustment::GetVelocity(const NormalizedCoords& coords) con
   return m_imageDisplacementList.GetCurrentImageDisplacement().GetDisplacementVector(coords);
 }
 
+inline auto ImageZoomAdjustment::GetZoomAdjustments(
+    const std::span<const NormalizedCoords> coords,
+    const std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void
+{
+  GetZoomAdjustmentsNonVirtual(*this, coords, zoomAdjustments);
+}
+
 } // namespace GOOM::FILTER_FX::FILTER_EFFECTS
@@ -3,6 +3,7 @@ module;
 #include <complex>
 #include <cstdint>
 #include <functional>
+#include <span>
 
 export module Goom.FilterFx.FilterEffects.AdjustmentEffects.Julia;
 
@@ -33,6 +34,8 @@ public:
 
   [[nodiscard]] auto GetZoomAdjustment(const NormalizedCoords& coords) const noexcept
       -> Vec2dFlt override;
+  auto GetZoomAdjustments(std::span<const NormalizedCoords> coords,
+                          std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void override;
 
   [[nodiscard]] auto GetZoomAdjustmentEffectNameValueParams() const noexcept
       -> UTILS::NameValuePairs override;
@@ -111,4 +114,11 @@ inline auto Julia::SetRandomParams() noexcept -> void
   m_params = GetRandomParams();
 }
 
+inline auto Julia::GetZoomAdjustments(const std::span<const NormalizedCoords> coords,
+                                      const std::span<Vec2dFlt> zoomAdjustments) const noexcept
+    -> void
+{
+  GetZoomAdjustmentsNonVirtual(*this, coords, zoomAdjustments);
+}
+
 } // namespace GOOM::FILTER_FX::FILTER_EFFECTS
@@ -1,3 +1,7 @@
+module;
+
+#include <span>
+
 export module Goom.FilterFx.FilterEffects.AdjustmentEffects.Mobius;
 
 import Goom.FilterFx.FilterEffects.ZoomAdjustmentEffect;
@@ -23,6 +27,8 @@ public:
 
   [[nodiscard]] auto GetZoomAdjustment(const NormalizedCoords& coords) const noexcept
       -> Vec2dFlt override;
+  auto GetZoomAdjustments(std::span<const NormalizedCoords> coords,
+                          std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void override;
 
   [[nodiscard]] auto GetZoomAdjustmentEffectNameValueParams() const noexcept
       -> NameValuePairs override;
@@ -74,4 +80,11 @@ inline auto Mobius::SetRandomParams() noexcept -> void
   m_params = GetRandomParams();
 }
 
+inline auto Mobius::GetZoomAdjustments(const std::span<const NormalizedCoords> coords,
+                                       const std::span<Vec2dFlt> zoomAdjustments) const noexcept
+    -> void
+{
+  GetZoomAdjustmentsNonVirtual(*this, coords, zoomAdjustments);
+}
+
 } // namespace GOOM::FILTER_FX::FILTER_EFFECTS
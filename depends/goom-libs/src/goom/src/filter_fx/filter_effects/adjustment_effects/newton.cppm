@@ -3,6 +3,7 @@ module;
 #include <complex>
 #include <cstdint>
 #include <functional>
+#include <span>
 
 export module Goom.FilterFx.FilterEffects.AdjustmentEffects.Newton;
 
@@ -31,6 +32,8 @@ public:
 
   [[nodiscard]] auto GetZoomAdjustment(const NormalizedCoords& coords) const noexcept
       -> Vec2dFlt override;
+  auto GetZoomAdjustments(std::span<const NormalizedCoords> coords,
+                          std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void override;
 
   [[nodiscard]] auto GetZoomAdjustmentEffectNameValueParams() const noexcept
       -> NameValuePairs override;
@@ -98,4 +101,11 @@ inline auto Newton::SetRandomParams() noexcept -> void
   m_params = GetRandomParams();
 }
 
+inline auto Newton::GetZoomAdjustments(const std::span<const NormalizedCoords> coords,
+                                       const std::span<Vec2dFlt> zoomAdjustments) const noexcept
+    -> void
+{
+  GetZoomAdjustmentsNonVirtual(*this, coords, zoomAdjustments);
+}
+
 } // namespace GOOM::FILTER_FX::FILTER_EFFECTS
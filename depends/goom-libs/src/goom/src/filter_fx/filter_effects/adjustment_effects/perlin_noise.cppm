@@ -2,6 +2,7 @@ module;
 
 #include <PerlinNoise.hpp>
 #include <cstdint>
+#include <span>
 
 export module Goom.FilterFx.FilterEffects.AdjustmentEffects.PerlinNoise;
 
@@ -29,6 +30,8 @@ public:
 
   [[nodiscard]] auto GetZoomAdjustment(const NormalizedCoords& coords) const noexcept
       -> Vec2dFlt override;
+  auto GetZoomAdjustments(std::span<const NormalizedCoords> coords,
+                          std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void override;
 
   [[nodiscard]] auto GetZoomAdjustmentEffectNameValueParams() const noexcept
       -> NameValuePairs override;
@@ -81,4 +84,11 @@ inline auto PerlinNoise::SetRandomParams() noexcept -> void
   m_params = GetRandomParams();
 }
 
+inline auto PerlinNoise::GetZoomAdjustments(
+    const std::span<const NormalizedCoords> coords,
+    const std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void
+{
+  GetZoomAdjustmentsNonVirtual(*this, coords, zoomAdjustments);
+}
+
 } // namespace GOOM::FILTER_FX::FILTER_EFFECTS
@@ -1,5 +1,10 @@
+module;
+
+#include <span>
+
 export module Goom.FilterFx.FilterEffects.AdjustmentEffects.Scrunch;
 
+import Goom.FilterFx.FilterEffects.AdjustmentEffects.ZoomAdjustmentKernels;
 import Goom.FilterFx.FilterEffects.ZoomAdjustmentEffect;
 import Goom.FilterFx.CommonTypes;
 import Goom.FilterFx.NormalizedCoords;
@@ -22,6 +27,8 @@ public:
 
   [[nodiscard]] auto GetZoomAdjustment(const NormalizedCoords& coords) const noexcept
       -> Vec2dFlt override;
+  auto GetZoomAdjustments(std::span<const NormalizedCoords> coords,
+                          std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void override;
 
   [[nodiscard]] auto GetZoomAdjustmentEffectNameValueParams() const noexcept
       -> NameValuePairs override;
@@ -78,4 +85,16 @@ inline auto Scrunch::GetVelocity(const NormalizedCoords& coords) const noexcept
   return {.x = xZoomAdjustment, .y = yZoomAdjustment};
 }
 
+inline auto Scrunch::GetZoomAdjustments(const std::span<const NormalizedCoords> coords,
+                                        const std::span<Vec2dFlt> zoomAdjustments) const noexcept
+    -> void
+{
+  GetRadialVelocityZoomAdjustments({.baseVelocity    = GetBaseZoomAdjustment(),
+                                    .amplitude       = {.x = m_params.amplitude.x, .y = 0.0F},
+                                    .yVelocityFromX  = true,
+                                    .yVelocityFactor = m_params.amplitude.y},
+                                   coords,
+                                   zoomAdjustments);
+}
+
 } // namespace GOOM::FILTER_FX::FILTER_EFFECTS
@@ -1,6 +1,7 @@
 module;
 
 #include <cmath>
+#include <span>
 
 export module Goom.FilterFx.FilterEffects.AdjustmentEffects.Speedway;
 
@@ -35,6 +36,8 @@ public:
 
   [[nodiscard]] auto GetZoomAdjustment(const NormalizedCoords& coords) const noexcept
       -> Vec2dFlt override;
+  auto GetZoomAdjustments(std::span<const NormalizedCoords> coords,
+                          std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void override;
 
   [[nodiscard]] auto GetZoomAdjustmentEffectNameValueParams() const noexcept
       -> NameValuePairs override;
@@ -192,4 +195,11 @@ inline auto Speedway::GetMode2ZoomAdjustment(const NormalizedCoords& coords,
   return {.x = xZoomAdjustment, .y = yZoomAdjustment};
 }
 
+inline auto Speedway::GetZoomAdjustments(const std::span<const NormalizedCoords> coords,
+                                         const std::span<Vec2dFlt> zoomAdjustments) const noexcept
+    -> void
+{
+  GetZoomAdjustmentsNonVirtual(*this, coords, zoomAdjustments);
+}
+
 } // namespace GOOM::FILTER_FX::FILTER_EFFECTS
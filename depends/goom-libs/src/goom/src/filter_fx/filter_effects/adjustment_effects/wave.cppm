@@ -1,6 +1,7 @@
 module;
 
 #include <cmath>
+#include <span>
 
 export module Goom.FilterFx.FilterEffects.AdjustmentEffects.Wave;
 
@@ -36,6 +37,8 @@ public:
 
   [[nodiscard]] auto GetZoomAdjustment(const NormalizedCoords& coords) const noexcept
       -> Vec2dFlt override;
+  auto GetZoomAdjustments(std::span<const NormalizedCoords> coords,
+                          std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void override;
 
   [[nodiscard]] auto GetZoomAdjustmentEffectNameValueParams() const noexcept
       -> NameValuePairs override;
@@ -177,4 +180,11 @@ inline auto Wave::GetZoomAdjustmentAdd(const WaveEffect waveEffect,
          GetPeriodicPart(waveEffect, m_params.freqFactor * angle, m_params.periodicFactor);
 }
 
+inline auto Wave::GetZoomAdjustments(const std::span<const NormalizedCoords> coords,
+                                     const std::span<Vec2dFlt> zoomAdjustments) const noexcept
+    -> void
+{
+  GetZoomAdjustmentsNonVirtual(*this, coords, zoomAdjustments);
+}
+
 } // namespace GOOM::FILTER_FX::FILTER_EFFECTS
@@ -1,3 +1,7 @@
+module;
+
+#include <span>
+
 export module Goom.FilterFx.FilterEffects.AdjustmentEffects.YOnly;
 
 import Goom.FilterFx.FilterEffects.ZoomAdjustmentEffect;
@@ -23,6 +27,8 @@ public:
 
   [[nodiscard]] auto GetZoomAdjustment(const NormalizedCoords& coords) const noexcept
       -> Vec2dFlt override;
+  auto GetZoomAdjustments(std::span<const NormalizedCoords> coords,
+                          std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void override;
 
   [[nodiscard]] auto GetZoomAdjustmentEffectNameValueParams() const noexcept
       -> NameValuePairs override;
@@ -102,4 +108,11 @@ inline auto YOnly::GetVelocity(const NormalizedCoords& coords) const noexcept ->
                GetYOnlyZoomAdjustmentMultiplier(m_params.xyEffect.yEffect, coords)};
 }
 
+inline auto YOnly::GetZoomAdjustments(const std::span<const NormalizedCoords> coords,
+                                      const std::span<Vec2dFlt> zoomAdjustments) const noexcept
+    -> void
+{
+  GetZoomAdjustmentsNonVirtual(*this, coords, zoomAdjustments);
+}
+
 } // namespace GOOM::FILTER_FX::FILTER_EFFECTS
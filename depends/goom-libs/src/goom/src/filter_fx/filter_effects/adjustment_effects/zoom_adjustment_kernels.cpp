@@ -0,0 +1,232 @@
+module;
+
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#define GOOM_HAS_X86_SIMD
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define GOOM_SIMD_TARGET(isa) __attribute__((target(isa)))
+#else
+#define GOOM_SIMD_TARGET(isa)
+#endif
+
+module Goom.FilterFx.FilterEffects.AdjustmentEffects.ZoomAdjustmentKernels;
+
+import Goom.FilterFx.NormalizedCoords;
+import Goom.Utils.CpuFeatures;
+import Goom.Lib.AssertUtils;
+import Goom.Lib.Point2d;
+
+namespace GOOM::FILTER_FX::FILTER_EFFECTS
+{
+
+using UTILS::GetSimdLevel;
+using UTILS::IsSimdLevelSupported;
+using UTILS::SimdLevel;
+
+namespace
+{
+
+// The kernels load and store the points as flat (x0, y0, x1, y1, ...) float arrays.
+static_assert(sizeof(NormalizedCoords) == (2 * sizeof(float)));
+static_assert(std::is_standard_layout_v<NormalizedCoords>);
+static_assert(sizeof(Vec2dFlt) == (2 * sizeof(float)));
+static_assert(std::is_standard_layout_v<Vec2dFlt>);
+
+[[nodiscard]] constexpr auto GetVelocity(const float baseVelocity,
+                                         const float amplitude,
+                                         const float sqDistMult,
+                                         const float sqDistOffset,
+                                         const float sqDist) noexcept -> float
+{
+  return baseVelocity + (amplitude * ((sqDistMult * sqDist) - sqDistOffset));
+}
+
+auto GetScalarZoomAdjustments(const RadialVelocityParams& params,
+                              const std::span<const NormalizedCoords> coords,
+                              const std::span<Vec2dFlt> zoomAdjustments,
+                              const size_t startIndex) noexcept -> void
+{
+  for (auto i = startIndex; i < coords.size(); ++i)
+  {
+    const auto x      = coords[i].GetX();
+    const auto y      = coords[i].GetY();
+    const auto xView  = params.viewportOffset.x + (params.viewportScale.x * x);
+    const auto yView  = params.viewportOffset.y + (params.viewportScale.y * y);
+    const auto sqDist = (xView * xView) + (yView * yView);
+
+    const auto xVelocity = GetVelocity(params.baseVelocity.x,
+                                       params.amplitude.x,
+                                       params.sqDistMult.x,
+                                       params.sqDistOffset.x,
+                                       sqDist);
+    const auto yVelocity = params.yVelocityFromX ? (params.yVelocityFactor * xVelocity)
+                                                 : GetVelocity(params.baseVelocity.y,
+                                                               params.amplitude.y,
+                                                               params.sqDistMult.y,
+                                                               params.sqDistOffset.y,
+                                                               sqDist);
+
+    zoomAdjustments[i] = {.x = x * xVelocity, .y = y * yVelocity};
+  }
+}
+
+#ifdef GOOM_HAS_X86_SIMD
+
+// Each vector lane pair is one point. The squared distance is the lane pair sum, got by
+// adding a pair-swapped copy - (y * y) + (x * x) is exactly (x * x) + (y * y).
+
+// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast): SIMD loads and stores.
+[[nodiscard]] auto GetFlatCoords(const std::span<const NormalizedCoords> coords) noexcept
+    -> const float*
+{
+  return reinterpret_cast<const float*>(coords.data());
+}
+
+[[nodiscard]] auto GetFlatZoomAdjustments(const std::span<Vec2dFlt> zoomAdjustments) noexcept
+    -> float*
+{
+  return reinterpret_cast<float*>(zoomAdjustments.data());
+}
+// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+GOOM_SIMD_TARGET("sse4.1")
+[[nodiscard]] auto GetSse41Pairs(const Vec2dFlt& vec) noexcept -> __m128
+{
+  return _mm_setr_ps(vec.x, vec.y, vec.x, vec.y);
+}
+
+GOOM_SIMD_TARGET("sse4.1")
+auto GetSse41ZoomAdjustments(const RadialVelocityParams& params,
+                             const std::span<const NormalizedCoords> coords,
+                             const std::span<Vec2dFlt> zoomAdjustments) noexcept -> size_t
+{
+  static constexpr auto NUM_POINTS = 2U;
+
+  const auto offset          = GetSse41Pairs(params.viewportOffset);
+  const auto scale           = GetSse41Pairs(params.viewportScale);
+  const auto baseVelocity    = GetSse41Pairs(params.baseVelocity);
+  const auto amplitude       = GetSse41Pairs(params.amplitude);
+  const auto sqDistMult      = GetSse41Pairs(params.sqDistMult);
+  const auto sqDistOffset    = GetSse41Pairs(params.sqDistOffset);
+  const auto yVelocityFactor = GetSse41Pairs({.x = 1.0F, .y = params.yVelocityFactor});
+
+  const auto* const flatCoords = GetFlatCoords(coords);
+  auto* const flatAdjustments  = GetFlatZoomAdjustments(zoomAdjustments);
+
+  auto i = 0U;
+  for (; (i + NUM_POINTS) <= coords.size(); i += NUM_POINTS)
+  {
+    const auto xy = _mm_loadu_ps(flatCoords + (2 * i));
+
+    const auto viewXy   = _mm_add_ps(offset, _mm_mul_ps(scale, xy));
+    const auto sqViewXy = _mm_mul_ps(viewXy, viewXy);
+    const auto sqDist =
+        _mm_add_ps(sqViewXy, _mm_shuffle_ps(sqViewXy, sqViewXy, _MM_SHUFFLE(2, 3, 0, 1)));
+    auto velocity = _mm_add_ps(
+        baseVelocity,
+        _mm_mul_ps(amplitude, _mm_sub_ps(_mm_mul_ps(sqDistMult, sqDist), sqDistOffset)));
+    if (params.yVelocityFromX)
+    {
+      // 1 * x is exactly x, so the x lanes are unchanged.
+      velocity = _mm_mul_ps(yVelocityFactor, _mm_moveldup_ps(velocity));
+    }
+
+    _mm_storeu_ps(flatAdjustments + (2 * i), _mm_mul_ps(xy, velocity));
+  }
+
+  return i;
+}
+
+GOOM_SIMD_TARGET("avx2")
+[[nodiscard]] auto GetAvx2Pairs(const Vec2dFlt& vec) noexcept -> __m256
+{
+  return _mm256_setr_ps(vec.x, vec.y, vec.x, vec.y, vec.x, vec.y, vec.x, vec.y);
+}
+
+GOOM_SIMD_TARGET("avx2")
+auto GetAvx2ZoomAdjustments(const RadialVelocityParams& params,
+                            const std::span<const NormalizedCoords> coords,
+                            const std::span<Vec2dFlt> zoomAdjustments) noexcept -> size_t
+{
+  static constexpr auto NUM_POINTS      = 4U;
+  static constexpr auto SWAP_LANE_PAIRS = 0xB1;
+
+  const auto offset          = GetAvx2Pairs(params.viewportOffset);
+  const auto scale           = GetAvx2Pairs(params.viewportScale);
+  const auto baseVelocity    = GetAvx2Pairs(params.baseVelocity);
+  const auto amplitude       = GetAvx2Pairs(params.amplitude);
+  const auto sqDistMult      = GetAvx2Pairs(params.sqDistMult);
+  const auto sqDistOffset    = GetAvx2Pairs(params.sqDistOffset);
+  const auto yVelocityFactor = GetAvx2Pairs({.x = 1.0F, .y = params.yVelocityFactor});
+
+  const auto* const flatCoords = GetFlatCoords(coords);
+  auto* const flatAdjustments  = GetFlatZoomAdjustments(zoomAdjustments);
+
+  auto i = 0U;
+  for (; (i + NUM_POINTS) <= coords.size(); i += NUM_POINTS)
+  {
+    const auto xy = _mm256_loadu_ps(flatCoords + (2 * i));
+
+    const auto viewXy   = _mm256_add_ps(offset, _mm256_mul_ps(scale, xy));
+    const auto sqViewXy = _mm256_mul_ps(viewXy, viewXy);
+    const auto sqDist   = _mm256_add_ps(sqViewXy, _mm256_permute_ps(sqViewXy, SWAP_LANE_PAIRS));
+    auto velocity       = _mm256_add_ps(
+        baseVelocity,
+        _mm256_mul_ps(amplitude,
+                      _mm256_sub_ps(_mm256_mul_ps(sqDistMult, sqDist), sqDistOffset)));
+    if (params.yVelocityFromX)
+    {
+      velocity = _mm256_mul_ps(yVelocityFactor, _mm256_moveldup_ps(velocity));
+    }
+
+    _mm256_storeu_ps(flatAdjustments + (2 * i), _mm256_mul_ps(xy, velocity));
+  }
+
+  return i;
+}
+
+#endif
+
+} // namespace
+
+auto GetRadialVelocityZoomAdjustments(const RadialVelocityParams& params,
+                                      const std::span<const NormalizedCoords> coords,
+                                      const std::span<Vec2dFlt> zoomAdjustments) noexcept -> void
+{
+  GetRadialVelocityZoomAdjustments(GetSimdLevel(), params, coords, zoomAdjustments);
+}
+
+auto GetRadialVelocityZoomAdjustments(const SimdLevel simdLevel,
+                                      const RadialVelocityParams& params,
+                                      const std::span<const NormalizedCoords> coords,
+                                      const std::span<Vec2dFlt> zoomAdjustments) noexcept -> void
+{
+  Expects(IsSimdLevelSupported(simdLevel));
+  Expects(zoomAdjustments.size() >= coords.size());
+
+  auto numDone = size_t{0U};
+
+#ifdef GOOM_HAS_X86_SIMD
+  switch (simdLevel)
+  {
+    case SimdLevel::AVX2:
+      numDone = GetAvx2ZoomAdjustments(params, coords, zoomAdjustments);
+      break;
+    case SimdLevel::SSE4_1:
+      numDone = GetSse41ZoomAdjustments(params, coords, zoomAdjustments);
+      break;
+    case SimdLevel::SCALAR:
+      break;
+  }
+#endif
+
+  GetScalarZoomAdjustments(params, coords, zoomAdjustments, numDone);
+}
+
+} // namespace GOOM::FILTER_FX::FILTER_EFFECTS
@@ -0,0 +1,52 @@
+module;
+
+#include <span>
+
+export module Goom.FilterFx.FilterEffects.AdjustmentEffects.ZoomAdjustmentKernels;
+
+import Goom.FilterFx.NormalizedCoords;
+import Goom.Utils.CpuFeatures;
+import Goom.Lib.Point2d;
+
+using GOOM::UTILS::SimdLevel;
+
+export namespace GOOM::FILTER_FX::FILTER_EFFECTS
+{
+
+// Row kernels for the 'radial velocity' family of adjustment effects, i.e. those
+// effects whose zoom adjustment reduces to
+//
+//     viewportCoords = viewportOffset + (viewportScale * coords)
+//     sqDist         = SqDistanceFromZero(viewportCoords)
+//     velocity       = baseVelocity + (amplitude * ((sqDistMult * sqDist) - sqDistOffset))
+//     velocity.y     = yVelocityFactor * velocity.x       (only if 'yVelocityFromX')
+//     adjustment     = coords * velocity
+//
+// Amulet, Scrunch and CrystalBall all fit this shape. Every SIMD level does the same
+// operations in the same order as the effects' own scalar 'GetZoomAdjustment', so the
+// results are bit-identical to it. That relies on there being no floating point
+// contraction (FMA), which the default x86-64 build doesn't do.
+struct RadialVelocityParams
+{
+  Vec2dFlt viewportOffset{.x = 0.0F, .y = 0.0F};
+  Vec2dFlt viewportScale{.x = 1.0F, .y = 1.0F};
+  Vec2dFlt baseVelocity{};
+  Vec2dFlt amplitude{};
+  Vec2dFlt sqDistMult{.x = 1.0F, .y = 1.0F};
+  Vec2dFlt sqDistOffset{.x = 0.0F, .y = 0.0F};
+  bool yVelocityFromX   = false;
+  float yVelocityFactor = 1.0F;
+};
+
+// Uses the best SIMD level available on this cpu.
+auto GetRadialVelocityZoomAdjustments(const RadialVelocityParams& params,
+                                      std::span<const NormalizedCoords> coords,
+                                      std::span<Vec2dFlt> zoomAdjustments) noexcept -> void;
+
+// Mainly for testing - 'simdLevel' must be supported by this cpu.
+auto GetRadialVelocityZoomAdjustments(SimdLevel simdLevel,
+                                      const RadialVelocityParams& params,
+                                      std::span<const NormalizedCoords> coords,
+                                      std::span<Vec2dFlt> zoomAdjustments) noexcept -> void;
+
+} // namespace GOOM::FILTER_FX::FILTER_EFFECTS
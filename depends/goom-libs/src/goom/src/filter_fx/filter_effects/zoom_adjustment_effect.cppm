@@ -1,7 +1,12 @@
+module;
+
+#include <span>
+
 export module Goom.FilterFx.FilterEffects.ZoomAdjustmentEffect;
 
 import Goom.FilterFx.NormalizedCoords;
 import Goom.Utils.NameValuePairs;
+import Goom.Lib.AssertUtils;
 import Goom.Lib.Point2d;
 
 export namespace GOOM::FILTER_FX::FILTER_EFFECTS
@@ -23,6 +28,10 @@ public:
 
   [[nodiscard]] virtual auto GetZoomAdjustment(const NormalizedCoords& coords) const noexcept
       -> Vec2dFlt = 0;
+  // Batched version of 'GetZoomAdjustment'. The default loops over the virtual
+  // 'GetZoomAdjustment' - effects should override this with a devirtualized loop.
+  virtual auto GetZoomAdjustments(std::span<const NormalizedCoords> coords,
+                                  std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void;
 
   [[nodiscard]] virtual auto GetZoomAdjustmentEffectNameValueParams() const noexcept
       -> GOOM::UTILS::NameValuePairs = 0;
@@ -31,6 +40,11 @@ protected:
   static constexpr auto* PARAM_GROUP = "Filter Effect";
   [[nodiscard]] auto GetBaseZoomAdjustment() const noexcept -> const Vec2dFlt&;
 
+  template<typename ZoomAdjustmentEffect>
+  static auto GetZoomAdjustmentsNonVirtual(const ZoomAdjustmentEffect& effect,
+                                           std::span<const NormalizedCoords> coords,
+                                           std::span<Vec2dFlt> zoomAdjustments) noexcept -> void;
+
 private:
   Vec2dFlt m_baseZoomAdjustment{};
 };
@@ -51,4 +65,31 @@ inline auto IZoomAdjustmentEffect::SetBaseZoomAdjustment(
   m_baseZoomAdjustment = baseZoomAdjustment;
 }
 
+inline auto IZoomAdjustmentEffect::GetZoomAdjustments(
+    const std::span<const NormalizedCoords> coords,
+    const std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void
+{
+  Expects(zoomAdjustments.size() == coords.size());
+
+  for (auto i = 0U; i < coords.size(); ++i)
+  {
+    zoomAdjustments[i] = GetZoomAdjustment(coords[i]);
+  }
+}
+
+template<typename ZoomAdjustmentEffect>
+auto IZoomAdjustmentEffect::GetZoomAdjustmentsNonVirtual(
+    const ZoomAdjustmentEffect& effect,
+    const std::span<const NormalizedCoords> coords,
+    const std::span<Vec2dFlt> zoomAdjustments) noexcept -> void
+{
+  Expects(zoomAdjustments.size() == coords.size());
+
+  // The qualified call bypasses the vtable so the whole loop can be inlined.
+  for (auto i = 0U; i < coords.size(); ++i)
+  {
+    zoomAdjustments[i] = effect.ZoomAdjustmentEffect::GetZoomAdjustment(coords[i]);
+  }
+}
+
 } // namespace GOOM::FILTER_FX::FILTER_EFFECTS
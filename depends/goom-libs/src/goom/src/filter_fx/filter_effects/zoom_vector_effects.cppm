@@ -2,6 +2,7 @@ module;
 
 #include <cstdint>
 #include <functional>
+#include <span>
 #include <string>
 
 export module Goom.FilterFx.FilterEffects.ZoomVectorEffects;
@@ -43,6 +44,10 @@ public:
   auto SetFilterSettings(const FilterEffectsSettings& filterEffectsSettings) noexcept -> void;
 
   [[nodiscard]] auto GetZoomAdjustment(const NormalizedCoords& coords) const noexcept -> Vec2dFlt;
+  auto GetZoomAdjustments(std::span<const NormalizedCoords> coords,
+                          std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void;
+
+  [[nodiscard]] auto IsMultiplierEffectActive() const noexcept -> bool;
 
   [[nodiscard]] auto GetMultiplierEffect(const NormalizedCoords& coords,
                                          const Vec2dFlt& zoomAdjustment) const noexcept
@@ -52,6 +57,10 @@ public:
                                              float sqDistFromZero,
                                              const NormalizedCoords& zoomVelocity) const noexcept
       -> NormalizedCoords;
+  auto GetAfterEffectsVelocities(std::span<const NormalizedCoords> coords,
+                                 std::span<const NormalizedCoords> zoomVelocities,
+                                 std::span<NormalizedCoords> afterEffectsVelocities) const noexcept
+      -> void;
   [[nodiscard]] auto GetAfterEffectsVelocityMultiplier() const noexcept -> float;
 
   [[nodiscard]] auto GetZoomEffectsNameValueParams() const noexcept -> UTILS::NameValuePairs;
@@ -151,6 +160,23 @@ inline auto ZoomVectorEffects::GetZoomAdjustment(const NormalizedCoords& coords)
       m_filterEffectsSettings->zoomAdjustmentEffect->GetZoomAdjustment(coords));
 }
 
+inline auto ZoomVectorEffects::GetZoomAdjustments(
+    const std::span<const NormalizedCoords> coords,
+    const std::span<Vec2dFlt> zoomAdjustments) const noexcept -> void
+{
+  m_filterEffectsSettings->zoomAdjustmentEffect->GetZoomAdjustments(coords, zoomAdjustments);
+
+  for (auto& zoomAdjustment : zoomAdjustments)
+  {
+    zoomAdjustment = GetClampedZoomAdjustment(zoomAdjustment);
+  }
+}
+
+inline auto ZoomVectorEffects::IsMultiplierEffectActive() const noexcept -> bool
+{
+  return m_filterEffectsSettings->filterMultiplierEffectsSettings.isActive;
+}
+
 inline auto ZoomVectorEffects::GetClampedZoomAdjustment(const Vec2dFlt& zoomCoeffs) const noexcept
     -> Vec2dFlt
 {
@@ -179,6 +205,15 @@ inline auto ZoomVectorEffects::GetAfterEffectsVelocity(
   return m_zoomVectorAfterEffects.GetAfterEffectsVelocity(coords, sqDistFromZero, zoomVelocity);
 }
 
+inline auto ZoomVectorEffects::GetAfterEffectsVelocities(
+    const std::span<const NormalizedCoords> coords,
+    const std::span<const NormalizedCoords> zoomVelocities,
+    const std::span<NormalizedCoords> afterEffectsVelocities) const noexcept -> void
+{
+  m_zoomVectorAfterEffects.GetAfterEffectsVelocities(
+      coords, zoomVelocities, afterEffectsVelocities);
+}
+
 inline auto ZoomVectorEffects::GetAfterEffectsVelocityMultiplier() const noexcept -> float
 {
   return m_filterEffectsSettings->afterEffectsVelocityMultiplier;
@@ -2,7 +2,11 @@ module;
 
 //#undef NO_LOGGING
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <span>
 #include <string>
 
 module Goom.FilterFx.FilterZoomVector;
@@ -10,6 +14,7 @@ module Goom.FilterFx.FilterZoomVector;
 import Goom.FilterFx.FilterEffects.ZoomVectorEffects;
 import Goom.FilterFx.FilterSettings;
 import Goom.FilterFx.NormalizedCoords;
+import Goom.Lib.AssertUtils;
 import Goom.Lib.Point2d;
 
 namespace GOOM::FILTER_FX
@@ -43,6 +48,75 @@ auto FilterZoomVector::GetZoomPoint(const NormalizedCoords& coords) const noexce
   return filterEffectsZoomPoint - afterEffectsVelocity;
 }
 
+auto FilterZoomVector::GetZoomPoints(const std::span<const NormalizedCoords> coords,
+                                     const std::span<NormalizedCoords> zoomPoints) const noexcept
+    -> void
+{
+  Expects(zoomPoints.size() == coords.size());
+
+  for (auto i = 0U; i < coords.size(); i += MAX_BATCH_SIZE)
+  {
+    const auto batchSize = std::min<size_t>(MAX_BATCH_SIZE, coords.size() - i);
+    GetBatchOfZoomPoints(coords.subspan(i, batchSize), zoomPoints.subspan(i, batchSize));
+  }
+}
+
+// Same as 'GetZoomPoint' but each stage is done for the whole batch, so the virtual
+// zoom adjustment effect and the after effects checks are only hit once per batch.
+auto FilterZoomVector::GetBatchOfZoomPoints(
+    const std::span<const NormalizedCoords> coords,
+    const std::span<NormalizedCoords> zoomPoints) const noexcept -> void
+{
+  auto zoomAdjustments        = std::array<Vec2dFlt, MAX_BATCH_SIZE>{};
+  auto zoomVelocities         = std::array<NormalizedCoords, MAX_BATCH_SIZE>{};
+  auto afterEffectsVelocities = std::array<NormalizedCoords, MAX_BATCH_SIZE>{};
+
+  const auto batchSize                   = coords.size();
+  const auto batchZoomAdjustments        = std::span{zoomAdjustments}.first(batchSize);
+  const auto batchZoomVelocities         = std::span{zoomVelocities}.first(batchSize);
+  const auto batchAfterEffectsVelocities = std::span{afterEffectsVelocities}.first(batchSize);
+
+  m_zoomVectorEffects.GetZoomAdjustments(coords, batchZoomAdjustments);
+  GetFilterEffectsZoomPoints(coords, batchZoomAdjustments, zoomPoints);
+
+  for (auto i = 0U; i < batchSize; ++i)
+  {
+    batchZoomVelocities[i] = coords[i] - zoomPoints[i];
+  }
+  m_zoomVectorEffects.GetAfterEffectsVelocities(
+      coords, batchZoomVelocities, batchAfterEffectsVelocities);
+
+  const auto afterEffectsVelocityMultiplier =
+      m_zoomVectorEffects.GetAfterEffectsVelocityMultiplier();
+  for (auto i = 0U; i < batchSize; ++i)
+  {
+    zoomPoints[i] -= afterEffectsVelocityMultiplier * batchAfterEffectsVelocities[i];
+  }
+}
+
+auto FilterZoomVector::GetFilterEffectsZoomPoints(
+    const std::span<const NormalizedCoords> coords,
+    const std::span<const Vec2dFlt> zoomAdjustments,
+    const std::span<NormalizedCoords> zoomPoints) const noexcept -> void
+{
+  if (not m_zoomVectorEffects.IsMultiplierEffectActive())
+  {
+    for (auto i = 0U; i < coords.size(); ++i)
+    {
+      zoomPoints[i] = coords[i] + NormalizedCoords{-zoomAdjustments[i].x, -zoomAdjustments[i].y};
+    }
+    return;
+  }
+
+  for (auto i = 0U; i < coords.size(); ++i)
+  {
+    const auto& multiplierEffect =
+        m_zoomVectorEffects.GetMultiplierEffect(coords[i], zoomAdjustments[i]);
+    zoomPoints[i] = coords[i] + NormalizedCoords{-multiplierEffect.x * zoomAdjustments[i].x,
+                                                 -multiplierEffect.y * zoomAdjustments[i].y};
+  }
+}
+
 inline auto FilterZoomVector::GetFilterEffectsZoomPoint(
     const NormalizedCoords& coords) const noexcept -> NormalizedCoords
 {
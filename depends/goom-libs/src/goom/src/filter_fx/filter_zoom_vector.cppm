@@ -1,6 +1,7 @@
 module;
 
 #include <cstdint>
+#include <span>
 #include <string>
 
 export module Goom.FilterFx.FilterZoomVector;
@@ -11,6 +12,7 @@ import Goom.FilterFx.NormalizedCoords;
 import Goom.FilterFx.ZoomVector;
 import Goom.Utils.NameValuePairs;
 import Goom.Utils.Math.GoomRand;
+import Goom.Lib.Point2d;
 
 export namespace GOOM::FILTER_FX
 {
@@ -29,6 +31,8 @@ public:
 
   [[nodiscard]] auto GetZoomPoint(const NormalizedCoords& coords) const noexcept
       -> NormalizedCoords override;
+  auto GetZoomPoints(std::span<const NormalizedCoords> coords,
+                     std::span<NormalizedCoords> zoomPoints) const noexcept -> void override;
 
   [[nodiscard]] auto GetNameValueParams() const noexcept -> UTILS::NameValuePairs override;
   [[nodiscard]] auto GetAfterEffectsNameValueParams() const noexcept
@@ -41,6 +45,13 @@ private:
   [[nodiscard]] auto GetAfterEffectsVelocity(const NormalizedCoords& coords,
                                              const NormalizedCoords& zoomPoint) const noexcept
       -> NormalizedCoords;
+
+  static constexpr auto MAX_BATCH_SIZE = 64U;
+  auto GetBatchOfZoomPoints(std::span<const NormalizedCoords> coords,
+                            std::span<NormalizedCoords> zoomPoints) const noexcept -> void;
+  auto GetFilterEffectsZoomPoints(std::span<const NormalizedCoords> coords,
+                                  std::span<const Vec2dFlt> zoomAdjustments,
+                                  std::span<NormalizedCoords> zoomPoints) const noexcept -> void;
 };
 
 } // namespace GOOM::FILTER_FX
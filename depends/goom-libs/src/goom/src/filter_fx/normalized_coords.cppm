@@ -25,6 +25,7 @@ public:
   static constexpr auto MAX_COORD   = MAX_NORMALIZED_COORD;
   static constexpr auto COORD_WIDTH = NORMALIZED_COORD_WIDTH;
 
+  constexpr NormalizedCoords() noexcept = default;
   constexpr explicit NormalizedCoords(const Point2dFlt& alreadyNormalized) noexcept;
   constexpr NormalizedCoords(float xAlreadyNormalized, float yAlreadyNormalized) noexcept;
 
@@ -45,7 +46,7 @@ public:
 
 private:
   friend class NormalizedCoordsConverter;
-  Point2dFlt m_fltCoords;
+  Point2dFlt m_fltCoords{};
 };
 
 struct CoordsAndVelocity
@@ -106,6 +107,8 @@ public:
       -> NormalizedCoords;
 
   [[nodiscard]] constexpr auto GetViewportWidth() const noexcept -> float;
+  [[nodiscard]] constexpr auto GetOffset() const noexcept -> Vec2dFlt;
+  [[nodiscard]] constexpr auto GetScale() const noexcept -> Vec2dFlt;
 
 private:
   static constexpr auto WORLD_WIDTH  = NormalizedCoords::COORD_WIDTH;
@@ -316,6 +319,16 @@ constexpr auto Viewport::GetViewportWidth() const noexcept -> float
   return m_viewportWidth;
 }
 
+constexpr auto Viewport::GetOffset() const noexcept -> Vec2dFlt
+{
+  return {.x = m_xOffset, .y = m_yOffset};
+}
+
+constexpr auto Viewport::GetScale() const noexcept -> Vec2dFlt
+{
+  return {.x = m_xScale, .y = m_yScale};
+}
+
 [[nodiscard]] inline auto operator==(const Viewport& viewport1, const Viewport& viewport2) noexcept
     -> bool
 {
@@ -1,5 +1,6 @@
 module;
 
+#include <span>
 #include <string>
 
 export module Goom.FilterFx.ZoomVector;
@@ -7,6 +8,7 @@ export module Goom.FilterFx.ZoomVector;
 import Goom.FilterFx.FilterSettings;
 import Goom.FilterFx.NormalizedCoords;
 import Goom.Utils.NameValuePairs;
+import Goom.Lib.AssertUtils;
 
 export namespace GOOM::FILTER_FX
 {
@@ -26,6 +28,9 @@ public:
 
   [[nodiscard]] virtual auto GetZoomPoint(const NormalizedCoords& coords) const noexcept
       -> NormalizedCoords = 0;
+  // Batched version of 'GetZoomPoint'. The default loops over the virtual 'GetZoomPoint'.
+  virtual auto GetZoomPoints(std::span<const NormalizedCoords> coords,
+                             std::span<NormalizedCoords> zoomPoints) const noexcept -> void;
 
   [[nodiscard]] virtual auto GetNameValueParams() const noexcept -> UTILS::NameValuePairs = 0;
   [[nodiscard]] virtual auto GetAfterEffectsNameValueParams() const noexcept
@@ -33,3 +38,20 @@ public:
 };
 
 } // namespace GOOM::FILTER_FX
+
+namespace GOOM::FILTER_FX
+{
+
+inline auto IZoomVector::GetZoomPoints(const std::span<const NormalizedCoords> coords,
+                                       const std::span<NormalizedCoords> zoomPoints) const noexcept
+    -> void
+{
+  Expects(zoomPoints.size() == coords.size());
+
+  for (auto i = 0U; i < coords.size(); ++i)
+  {
+    zoomPoints[i] = GetZoomPoint(coords[i]);
+  }
+}
+
+} // namespace GOOM::FILTER_FX
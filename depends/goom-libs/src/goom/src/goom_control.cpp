@@ -18,6 +18,7 @@ module;
 
 #include "goom/goom_logger.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
@@ -25,6 +26,7 @@ module;
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 module Goom.Lib.GoomControl;
 
@@ -40,6 +42,7 @@ import Goom.Control.GoomStateHandler;
 import Goom.Control.GoomStateMonitor;
 import Goom.Control.GoomTitleDisplayer;
 import Goom.Control.StateAndFilterConsts;
+import Goom.Draw.DirtyTiles;
 import Goom.Draw.GoomDrawToBuffer;
 import Goom.FilterFx.FilterEffects.ZoomAdjustmentEffectFactory;
 import Goom.FilterFx.FilterEffects.ZoomVectorEffects;
@@ -48,8 +51,11 @@ import Goom.FilterFx.FilterSettingsService;
 import Goom.FilterFx.FilterZoomVector;
 import Goom.FilterFx.NormalizedCoords;
 import Goom.Utils.DebuggingLogger;
+import Goom.Utils.EnumUtils;
+import Goom.Utils.FrameArena;
 import Goom.Utils.GoomTime;
 import Goom.Utils.Parallel;
+import Goom.Utils.StageTimings;
 import Goom.Utils.Stopwatch;
 import Goom.Utils.Timer;
 import Goom.Utils.Graphics.Blend2dToGoom;
@@ -79,6 +85,7 @@ using CONTROL::GoomStateDump;
 #endif
 
 using CONTROL::GoomAllVisualFx;
+using CONTROL::GoomDrawables;
 using CONTROL::GoomDrawablesState;
 using CONTROL::GoomFavouriteStatesHandler;
 using CONTROL::GoomForcedStateHandler;
@@ -92,6 +99,9 @@ using CONTROL::IGoomStateHandler;
 using CONTROL::MessageGroup;
 using CONTROL::MessageGroupColors;
 using CONTROL::USE_FORCED_GOOM_STATE;
+using DRAW::CopyTiles;
+using DRAW::DirtyTiles;
+using DRAW::FillTiles;
 using DRAW::GoomDrawToSingleBuffer;
 using DRAW::GoomDrawToTwoBuffers;
 using FILTER_FX::FilterBuffersService;
@@ -99,13 +109,19 @@ using FILTER_FX::FilterSettingsService;
 using FILTER_FX::FilterZoomVector;
 using FILTER_FX::NormalizedCoordsConverter;
 using FILTER_FX::FILTER_EFFECTS::CreateZoomAdjustmentEffect;
-using UTILS::GetNumAvailablePoolThreads;
+using UTILS::EnumToString;
+using UTILS::FrameArena;
 using UTILS::GoomTime;
+using UTILS::NUM;
 using UTILS::Parallel;
+using UTILS::ScopedStageTimer;
+using UTILS::SetSharedThreadPoolConfig;
+using UTILS::StageTimings;
 using UTILS::Stopwatch;
+using UTILS::TaskPriority;
 using UTILS::Timer;
 using UTILS::GRAPHICS::Blend2dDoubleGoomBuffers;
-using UTILS::GRAPHICS::GetColorAlphaNoAddBlend;
+using UTILS::GRAPHICS::PixelBlendRowType;
 using UTILS::GRAPHICS::SmallImageBitmaps;
 using UTILS::MATH::GoomRand;
 using UTILS::MATH::IsBetween;
@@ -214,6 +230,7 @@ public:
   auto SetSongInfo(const SongInfo& songInfo) -> void;
   auto SetNoZooms(bool value) -> void;
   auto SetShowGoomState(bool value) -> void;
+  auto SetDrawFxConcurrently(bool value) -> void;
   auto SetDumpDirectory(const std::string& dumpDirectory) -> void;
   [[nodiscard]] auto GetDumpDirectory() const noexcept -> const std::string&;
 
@@ -222,10 +239,13 @@ public:
 
   [[nodiscard]] auto GetFrameData() const noexcept -> const FrameData&;
   [[nodiscard]] auto GetNumPoolThreads() const noexcept -> size_t;
+  [[nodiscard]] auto GetStageTimings() const noexcept -> std::vector<StageTiming>;
+  [[nodiscard]] auto GetFxTimings() const noexcept -> std::vector<StageTiming>;
+  [[nodiscard]] auto GetFrameArenaUsages() const noexcept -> std::vector<FrameArenaUsage>;
 
 private:
   [[maybe_unused]] const GoomControl* m_parentGoomControl;
-  Parallel m_parallel{GetNumAvailablePoolThreads()};
+  Parallel m_parallel{TaskPriority::FRAME_CRITICAL};
   GoomTime m_goomTime;
   SoundInfo m_soundInfo;
   GoomSoundEvents m_goomSoundEvents{m_goomTime, m_soundInfo};
@@ -236,18 +256,31 @@ private:
   PixelBufferVector m_lowPixelBuffer;
   GoomDrawToTwoBuffers m_multiBufferDraw;
   Blend2dDoubleGoomBuffers m_blend2dDoubleGoomBuffers;
+  FrameArena m_sharedFrameArena;
   FxHelper m_fxHelper;
   std::string m_dumpDirectory;
   NormalizedCoordsConverter m_normalizedCoordsConverter{
       {m_goomInfo.GetDimensions().GetWidth(), m_goomInfo.GetDimensions().GetHeight()}
   };
 
-  auto Blend2dClearAll() -> void;
+  auto Blend2dClear() -> void;
   auto AddBlend2dImagesToGoomBuffers() -> void;
 
   FrameData* m_frameData = nullptr;
   auto UpdateFrameData() -> void;
   auto UpdateFrameDataPixelBuffers() noexcept -> void;
+  auto ClearDirtyPixelBufferTiles() noexcept -> void;
+  // A frame data pixel buffer still holds what was last copied to it. So only the tiles drawn
+  // this frame, and the tiles drawn the last time the frame data was used, need copying.
+  struct FrameDataTilesWritten
+  {
+    const Pixel* mainImagePixels;
+    DirtyTiles::TileMask tilesWritten;
+  };
+  static constexpr auto MAX_NUM_FRAME_DATAS = 8U;
+  std::vector<FrameDataTilesWritten> m_frameDataTilesWritten;
+  DirtyTiles::TileMask m_tilesToUpdate;
+  [[nodiscard]] auto GetFrameDataTilesWritten() noexcept -> DirtyTiles::TileMask&;
   auto UpdateFrameDataFilterPosArrays() noexcept -> void;
 
   static constexpr auto TIME_BETWEEN_POS1_POS2_MIX_FREQ_CHANGES_RANGE = NumberRange{100U, 1000U};
@@ -320,6 +353,26 @@ private:
   bool m_showGoomState = false;
   auto DisplayGoomState() -> void;
   [[nodiscard]] auto GetGoomTimeInfo() const -> MessageGroup;
+
+  enum class UpdateStage : UnderlyingEnumType
+  {
+    NEW_CYCLE,
+    PROCESS_AUDIO,
+    MUSIC_SETTINGS_REACTOR,
+    FILTER_SETTINGS,
+    TRANSFORM_BUFFER_UPDATE,
+    BLEND2D_CLEAR,
+    VISUAL_FX,
+    TEXT_DISPLAY,
+    BLEND2D_MERGE,
+    FRAME_DATA_UPDATE,
+  };
+  StageTimings m_stageTimings{GetUpdateStageNames()};
+  [[nodiscard]] static auto GetUpdateStageNames() noexcept -> std::vector<std::string>;
+  static auto AddStageTimings(const StageTimings& timings, std::vector<StageTiming>& stageTimings)
+      -> void;
+  template<typename StageFunc>
+  auto DoStage(UpdateStage stage, const StageFunc& stageFunc) -> void;
 };
 
 GoomControl::GoomControl(const Dimensions& dimensions,
@@ -340,6 +393,11 @@ auto GoomControl::SetShowGoomState(const bool value) -> void
   m_pimpl->SetShowGoomState(value);
 }
 
+auto GoomControl::SetDrawFxConcurrently(const bool value) -> void
+{
+  m_pimpl->SetDrawFxConcurrently(value);
+}
+
 auto GoomControl::SetDumpDirectory(const std::string& dumpDirectory) -> void
 {
   m_pimpl->SetDumpDirectory(dumpDirectory);
@@ -390,6 +448,21 @@ auto GoomControl::GetNumPoolThreads() const noexcept -> size_t
   return m_pimpl->GetNumPoolThreads();
 }
 
+auto GoomControl::GetStageTimings() const noexcept -> std::vector<StageTiming>
+{
+  return m_pimpl->GetStageTimings();
+}
+
+auto GoomControl::GetFxTimings() const noexcept -> std::vector<StageTiming>
+{
+  return m_pimpl->GetFxTimings();
+}
+
+auto GoomControl::GetFrameArenaUsages() const noexcept -> std::vector<FrameArenaUsage>
+{
+  return m_pimpl->GetFrameArenaUsages();
+}
+
 auto GoomControlLogger::StartGoomControl(
     const GoomControl::GoomControlImpl* const goomControl) noexcept -> void
 {
@@ -413,6 +486,12 @@ auto GoomControl::MakeGoomLogger() noexcept -> std::unique_ptr<GoomLogger>
   return std::make_unique<GoomControlLogger>();
 }
 
+auto GoomControl::SetPoolThreadOptions(const PoolThreadOptions& options) noexcept -> void
+{
+  SetSharedThreadPoolConfig(
+      {.maxNumThreads = options.maxNumPoolThreads, .cpuAffinity = options.cpuAffinity});
+}
+
 GoomControl::GoomControlImpl::GoomControlImpl(const GoomControl& parentGoomControl,
                                               const Dimensions& dimensions,
                                               const std::string& resourcesDirectory,
@@ -423,12 +502,14 @@ GoomControl::GoomControlImpl::GoomControlImpl(const GoomControl& parentGoomContr
     m_mainPixelBuffer{dimensions},
     m_lowPixelBuffer{dimensions},
     m_multiBufferDraw{dimensions, goomLogger, m_mainPixelBuffer, m_lowPixelBuffer},
-    m_blend2dDoubleGoomBuffers{m_multiBufferDraw, dimensions, GetColorAlphaNoAddBlend},
+    m_blend2dDoubleGoomBuffers{
+        m_parallel, m_multiBufferDraw, dimensions, PixelBlendRowType::COLOR_ALPHA},
     m_fxHelper{m_multiBufferDraw,
                m_goomInfo,
                *m_goomRand,
                *m_goomLogger,
-               m_blend2dDoubleGoomBuffers.GetBlend2dContexts()},
+               m_blend2dDoubleGoomBuffers.GetBlend2dContexts(),
+               m_sharedFrameArena},
     m_filterSettingsService{
         m_goomInfo, *m_goomRand, resourcesDirectory, CreateZoomAdjustmentEffect},
     m_filterBuffersService{m_goomInfo,
@@ -437,17 +518,25 @@ GoomControl::GoomControlImpl::GoomControlImpl(const GoomControl& parentGoomContr
                                                               resourcesDirectory,
                                                               *m_goomRand)},
     m_smallBitmaps{resourcesDirectory},
-    m_visualFx{m_parallel, m_fxHelper, m_smallBitmaps, resourcesDirectory, m_stateHandler},
+    m_visualFx{m_parallel,
+               m_fxHelper,
+               m_multiBufferDraw,
+               m_smallBitmaps,
+               resourcesDirectory,
+               m_stateHandler},
     m_goomTextOutput{dimensions, goomLogger, m_mainPixelBuffer},
     m_goomTitleDisplayer{m_goomTextOutput, *m_goomRand, GetFontDirectory(resourcesDirectory)},
     m_messageDisplayer{m_goomTextOutput, GetMessagesFontFile(resourcesDirectory)}
 {
   UTILS::SetGoomLogger(*m_goomLogger);
+
+  m_goomTextOutput.SetDirtyTiles(m_multiBufferDraw.GetDirtyTiles());
+  m_tilesToUpdate.resize(m_multiBufferDraw.GetDirtyTiles().GetNumTiles());
 }
 
-inline auto GoomControl::GoomControlImpl::Blend2dClearAll() -> void
+inline auto GoomControl::GoomControlImpl::Blend2dClear() -> void
 {
-  m_blend2dDoubleGoomBuffers.Blend2dClearAll();
+  m_blend2dDoubleGoomBuffers.Blend2dClear();
 }
 
 inline auto GoomControl::GoomControlImpl::AddBlend2dImagesToGoomBuffers() -> void
@@ -471,9 +560,24 @@ inline auto GoomControl::GoomControlImpl::SetFrameData(FrameData& frameData) ->
   m_frameData = &frameData;
 
   m_visualFx.SetFrameMiscData(m_frameData->miscData);
+  m_filterBuffersService.SetNextTransformBufferDest(
+      m_frameData->filterPosArrays.filterDestPos,
+      m_frameData->filterPosArrays.filterDestPosMapGeneration);
 
-  m_mainPixelBuffer.Fill(ZERO_PIXEL);
-  m_lowPixelBuffer.Fill(ZERO_PIXEL);
+  ClearDirtyPixelBufferTiles();
+}
+
+auto GoomControl::GoomControlImpl::ClearDirtyPixelBufferTiles() noexcept -> void
+{
+  // Everything outside the dirty tiles is still clear from last time.
+  auto& dirtyTiles = m_multiBufferDraw.GetDirtyTiles();
+
+  std::ranges::fill(m_tilesToUpdate, 0U);
+  dirtyTiles.AddToTileMask(m_tilesToUpdate);
+  FillTiles(m_mainPixelBuffer, m_tilesToUpdate, ZERO_PIXEL);
+  FillTiles(m_lowPixelBuffer, m_tilesToUpdate, ZERO_PIXEL);
+
+  dirtyTiles.Clear();
 }
 
 auto GoomControl::GoomControlImpl::UpdateFrameData() -> void
@@ -491,15 +595,45 @@ auto GoomControl::GoomControlImpl::UpdateFrameDataPixelBuffers() noexcept -> voi
   //   class, then copied to frame data when needed. Just using the frame data pixel
   //   buffers directly caused a 10 times slow down with pixel blending when I moved
   //   to an AMD cpu and integrated gpu.
-  const auto& srceMain    = m_mainPixelBuffer.GetPixelBuffer();
-  auto& destMainFrameData = m_frameData->imageArrays.mainImagePixelBuffer.GetPixelBuffer();
-  std::ranges::copy(srceMain.cbegin(), srceMain.cend(), destMainFrameData.begin());
+  const auto& dirtyTiles = m_multiBufferDraw.GetDirtyTiles();
+  auto& tilesWritten     = GetFrameDataTilesWritten();
+
+  m_tilesToUpdate = tilesWritten;
+  dirtyTiles.AddToTileMask(m_tilesToUpdate);
+
+  CopyTiles(m_mainPixelBuffer, m_frameData->imageArrays.mainImagePixelBuffer, m_tilesToUpdate);
   m_frameData->imageArrays.mainImagePixelBufferNeedsUpdating = true;
 
-  const auto& srceLow    = m_lowPixelBuffer.GetPixelBuffer();
-  auto& destLowFrameData = m_frameData->imageArrays.lowImagePixelBuffer.GetPixelBuffer();
-  std::ranges::copy(srceLow.cbegin(), srceLow.cend(), destLowFrameData.begin());
+  CopyTiles(m_lowPixelBuffer, m_frameData->imageArrays.lowImagePixelBuffer, m_tilesToUpdate);
   m_frameData->imageArrays.lowImagePixelBufferNeedsUpdating = true;
+
+  std::ranges::fill(tilesWritten, 0U);
+  dirtyTiles.AddToTileMask(tilesWritten);
+}
+
+auto GoomControl::GoomControlImpl::GetFrameDataTilesWritten() noexcept -> DirtyTiles::TileMask&
+{
+  const auto* const mainImagePixels =
+      m_frameData->imageArrays.mainImagePixelBuffer.GetPixelBuffer().data();
+
+  const auto frameDataTiles = std::ranges::find(
+      m_frameDataTilesWritten, mainImagePixels, &FrameDataTilesWritten::mainImagePixels);
+  if (frameDataTiles != m_frameDataTilesWritten.end())
+  {
+    return frameDataTiles->tilesWritten;
+  }
+
+  // Frame data buffers shouldn't change, but if they do, don't keep stale ones forever.
+  if (m_frameDataTilesWritten.size() >= MAX_NUM_FRAME_DATAS)
+  {
+    m_frameDataTilesWritten.clear();
+  }
+
+  // Nothing is known about a new buffer, so all of it has to be written the first time.
+  m_frameDataTilesWritten.emplace_back(
+      mainImagePixels, DirtyTiles::TileMask(m_multiBufferDraw.GetDirtyTiles().GetNumTiles(), 1U));
+
+  return m_frameDataTilesWritten.back().tilesWritten;
 }
 
 auto GoomControl::GoomControlImpl::UpdateFrameDataFilterPosArrays() noexcept -> void
@@ -509,15 +643,25 @@ auto GoomControl::GoomControlImpl::UpdateFrameDataFilterPosArrays() noexcept ->
                               .transformBufferLerpData.GetLerpFactor();
   m_frameData->filterPosArrays.filterPosBuffersLerpFactor = lerpFactor;
 
-  if (not m_filterBuffersService.IsTransformBufferReadyToCopy())
+  // A buffer produced into another frame's dest positions waits for that frame to come round
+  // again, so the hand over is just a flag change and no copy is needed.
+  if (not m_filterBuffersService.IsTransformBufferReadyToCopy(
+          m_frameData->filterPosArrays.filterDestPos))
   {
     m_frameData->filterPosArrays.filterDestPosNeedsUpdating = false;
+
+    // Restarting throws away the work done so far. A nearly finished buffer will get to
+    // the screen sooner than a restarted one, so let any new settings wait for it.
+    static constexpr auto MAX_PROGRESS_FOR_RESTART = 0.75F;
+    m_filterBuffersService.SetTransformBufferRestartAllowed(
+        m_filterBuffersService.GetTransformBufferProgress() < MAX_PROGRESS_FOR_RESTART);
   }
   else
   {
     m_filterBuffersService.CopyTransformBuffer(m_frameData->filterPosArrays.filterDestPos);
     m_frameData->filterPosArrays.filterDestPosNeedsUpdating = true;
     m_filterSettingsService.ResetTransformBufferLerpData();
+    m_filterBuffersService.SetTransformBufferRestartAllowed(true);
   }
 }
 
@@ -550,6 +694,11 @@ inline auto GoomControl::GoomControlImpl::SetShowGoomState(const bool value) ->
   m_showGoomState = value;
 }
 
+inline auto GoomControl::GoomControlImpl::SetDrawFxConcurrently(const bool value) -> void
+{
+  m_visualFx.SetDrawFxConcurrently(value);
+}
+
 inline auto GoomControl::GoomControlImpl::SetDumpDirectory(const std::string& dumpDirectory) -> void
 {
   m_dumpDirectory = dumpDirectory;
@@ -572,8 +721,101 @@ inline auto GoomControl::GoomControlImpl::GetNumPoolThreads() const noexcept ->
   return m_parallel.GetNumThreadsUsed();
 }
 
+auto GoomControl::GoomControlImpl::GetStageTimings() const noexcept -> std::vector<StageTiming>
+{
+  auto stageTimings = std::vector<StageTiming>{};
+
+  AddStageTimings(m_stageTimings, stageTimings);
+  AddStageTimings(m_filterBuffersService.GetTransformBufferTimings(), stageTimings);
+
+  return stageTimings;
+}
+
+auto GoomControl::GoomControlImpl::GetFxTimings() const noexcept -> std::vector<StageTiming>
+{
+  auto fxTimings = std::vector<StageTiming>{};
+
+  AddStageTimings(m_visualFx.GetFxTimings(), fxTimings);
+
+  return fxTimings;
+}
+
+auto GoomControl::GoomControlImpl::GetFrameArenaUsages() const noexcept
+    -> std::vector<FrameArenaUsage>
+{
+  auto frameArenaUsages = std::vector<FrameArenaUsage>{};
+
+  const auto addUsage = [&frameArenaUsages](const std::string& fxName,
+                                            const FrameArena& frameArena)
+  {
+    frameArenaUsages.emplace_back(FrameArenaUsage{
+        .fxName                 = fxName,
+        .numFrames              = frameArena.GetNumFrames(),
+        .totalNumAllocations    = frameArena.GetTotalUsage().numAllocations,
+        .totalNumBytes          = frameArena.GetTotalUsage().numBytes,
+        .maxFrameNumAllocations = frameArena.GetMaxFrameUsage().numAllocations,
+        .maxFrameNumBytes       = frameArena.GetMaxFrameUsage().numBytes,
+        .blockSize              = frameArena.GetBlockSize(),
+    });
+  };
+
+  for (auto i = 0U; i < NUM<GoomDrawables>; ++i)
+  {
+    const auto drawable = static_cast<GoomDrawables>(i);
+    addUsage(m_visualFx.GetFxName(drawable), m_visualFx.GetFxFrameArena(drawable));
+  }
+  addUsage("shared", m_sharedFrameArena);
+
+  return frameArenaUsages;
+}
+
+auto GoomControl::GoomControlImpl::AddStageTimings(const StageTimings& timings,
+                                                   std::vector<StageTiming>& stageTimings)
+    -> void
+{
+  static constexpr auto MEDIAN_PERCENTILE = 50.0F;
+  static constexpr auto P95_PERCENTILE    = 95.0F;
+  static constexpr auto P99_PERCENTILE    = 99.0F;
+
+  for (auto stage = 0U; stage < timings.GetNumStages(); ++stage)
+  {
+    stageTimings.emplace_back(StageTiming{
+        .stageName      = timings.GetStageName(stage),
+        .numTimes       = timings.GetNumTimes(stage),
+        .totalTimeInNs  = timings.GetTotalTimeInNs(stage),
+        .lastTimeInNs   = timings.GetLastTimeInNs(stage),
+        .medianTimeInNs = timings.GetRecentPercentileTimeInNs(stage, MEDIAN_PERCENTILE),
+        .p95TimeInNs    = timings.GetRecentPercentileTimeInNs(stage, P95_PERCENTILE),
+        .p99TimeInNs    = timings.GetRecentPercentileTimeInNs(stage, P99_PERCENTILE),
+        .maxTimeInNs    = timings.GetMaxTimeInNs(stage),
+    });
+  }
+}
+
+auto GoomControl::GoomControlImpl::GetUpdateStageNames() noexcept -> std::vector<std::string>
+{
+  auto stageNames = std::vector<std::string>{};
+
+  for (auto stage = 0U; stage < NUM<UpdateStage>; ++stage)
+  {
+    stageNames.emplace_back(EnumToString(static_cast<UpdateStage>(stage)));
+  }
+
+  return stageNames;
+}
+
+template<typename StageFunc>
+inline auto GoomControl::GoomControlImpl::DoStage(const UpdateStage stage,
+                                                  const StageFunc& stageFunc) -> void
+{
+  const auto stageTimer = ScopedStageTimer{m_stageTimings, static_cast<uint32_t>(stage)};
+  stageFunc();
+}
+
 inline auto GoomControl::GoomControlImpl::Start() -> void
 {
+  m_stageTimings.Reset();
+
   m_goomLogger->StartGoomControl(this);
 
   StartFilterServices();
@@ -686,36 +928,48 @@ inline auto GoomControl::GoomControlImpl::GetMessagesFontFile(const std::string&
 
 inline auto GoomControl::GoomControlImpl::UpdateGoomBuffers(const AudioSamples& soundData) -> void
 {
-  NewCycle();
+  DoStage(UpdateStage::NEW_CYCLE, [this] { NewCycle(); });
 
-  ProcessAudio(soundData);
+  DoStage(UpdateStage::PROCESS_AUDIO, [this, &soundData] { ProcessAudio(soundData); });
 
-  UseMusicToChangeSettings();
-  UpdateFilterSettings();
+  DoStage(UpdateStage::MUSIC_SETTINGS_REACTOR, [this] { UseMusicToChangeSettings(); });
+  DoStage(UpdateStage::FILTER_SETTINGS, [this] { UpdateFilterSettings(); });
 
-  UpdateTransformBuffer();
+  DoStage(UpdateStage::TRANSFORM_BUFFER_UPDATE, [this] { UpdateTransformBuffer(); });
 
-  Blend2dClearAll();
+  DoStage(UpdateStage::BLEND2D_CLEAR, [this] { Blend2dClear(); });
 
-  ApplyStateToImageBuffers(soundData);
-  ApplyEndEffectIfNearEnd();
+  DoStage(UpdateStage::VISUAL_FX,
+          [this, &soundData]
+          {
+            ApplyStateToImageBuffers(soundData);
+            ApplyEndEffectIfNearEnd();
+          });
 
-  DisplayTitle();
-  DisplayGoomState();
+  DoStage(UpdateStage::TEXT_DISPLAY,
+          [this]
+          {
+            DisplayTitle();
+            DisplayGoomState();
+          });
 
 #ifdef DO_GOOM_STATE_DUMP
   UpdateGoomStateDump();
 #endif
 
-  AddBlend2dImagesToGoomBuffers();
+  DoStage(UpdateStage::BLEND2D_MERGE, [this] { AddBlend2dImagesToGoomBuffers(); });
 
-  UpdateFrameData();
+  DoStage(UpdateStage::FRAME_DATA_UPDATE, [this] { UpdateFrameData(); });
 }
 
 inline auto GoomControl::GoomControlImpl::NewCycle() -> void
 {
   m_goomTime.UpdateTime();
 
+  // Nothing from the last update can still be using the frame arenas.
+  m_sharedFrameArena.Reset();
+  m_visualFx.ResetFxFrameArenas();
+
   m_visualFx.SetAllowMultiThreadedStates(m_goomTitleDisplayer.IsFinished());
   m_musicSettingsReactor.NewCycle();
   m_filterSettingsService.NewCycle();
@@ -0,0 +1,78 @@
+module;
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+module Goom.Utils.CpuFeatures;
+
+namespace GOOM::UTILS
+{
+
+namespace
+{
+
+#if defined(__x86_64__) || defined(__i386__)
+
+auto DetectSimdLevel() noexcept -> SimdLevel
+{
+  __builtin_cpu_init();
+
+  if (__builtin_cpu_supports("avx2"))
+  {
+    return SimdLevel::AVX2;
+  }
+  if (__builtin_cpu_supports("sse4.1"))
+  {
+    return SimdLevel::SSE4_1;
+  }
+  return SimdLevel::SCALAR;
+}
+
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+
+auto DetectSimdLevel() noexcept -> SimdLevel
+{
+  static constexpr auto SSE4_1_BIT          = 1 << 19;
+  static constexpr auto OS_XSAVE_BIT        = 1 << 27;
+  static constexpr auto AVX_BIT             = 1 << 28;
+  static constexpr auto AVX2_BIT            = 1 << 5;
+  static constexpr auto XMM_AND_YMM_ENABLED = 0x6U;
+
+  int cpuInfo[4]{}; // NOLINT: Required by __cpuid.
+  __cpuid(cpuInfo, 1);
+  const auto ecx1 = cpuInfo[2];
+  if ((ecx1 & SSE4_1_BIT) == 0)
+  {
+    return SimdLevel::SCALAR;
+  }
+  if (((ecx1 & OS_XSAVE_BIT) == 0) or ((ecx1 & AVX_BIT) == 0) or
+      ((_xgetbv(0) & XMM_AND_YMM_ENABLED) != XMM_AND_YMM_ENABLED))
+  {
+    return SimdLevel::SSE4_1;
+  }
+
+  __cpuidex(cpuInfo, 7, 0);
+  const auto ebx7 = cpuInfo[1];
+  return (ebx7 & AVX2_BIT) != 0 ? SimdLevel::AVX2 : SimdLevel::SSE4_1;
+}
+
+#else
+
+auto DetectSimdLevel() noexcept -> SimdLevel
+{
+  return SimdLevel::SCALAR;
+}
+
+#endif
+
+} // namespace
+
+auto GetSimdLevel() noexcept -> SimdLevel
+{
+  static const auto s_simdLevel = DetectSimdLevel();
+  return s_simdLevel;
+}
+
+} // namespace GOOM::UTILS
@@ -0,0 +1,35 @@
+module;
+
+#include <cstdint>
+
+export module Goom.Utils.CpuFeatures;
+
+import Goom.Lib.GoomTypes;
+
+export namespace GOOM::UTILS
+{
+
+// Ordered from least to most capable - a level implies all the levels below it.
+enum class SimdLevel : UnderlyingEnumType
+{
+  SCALAR,
+  SSE4_1,
+  AVX2,
+};
+
+// Detected once, on first use. Non-x86 builds always report SCALAR.
+[[nodiscard]] auto GetSimdLevel() noexcept -> SimdLevel;
+
+[[nodiscard]] auto IsSimdLevelSupported(SimdLevel simdLevel) noexcept -> bool;
+
+} // namespace GOOM::UTILS
+
+namespace GOOM::UTILS
+{
+
+inline auto IsSimdLevelSupported(const SimdLevel simdLevel) noexcept -> bool
+{
+  return static_cast<uint32_t>(simdLevel) <= static_cast<uint32_t>(GetSimdLevel());
+}
+
+} // namespace GOOM::UTILS
@@ -0,0 +1,172 @@
+module;
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <vector>
+
+export module Goom.Utils.FrameArena;
+
+export namespace GOOM::UTILS
+{
+
+// A monotonic arena for memory that only lives for one frame. Allocations just bump a
+// pointer into a block, deallocations do nothing, and 'Reset' frees everything at once.
+// If a frame needs more than the block, the extra comes from the heap, and the block is
+// grown at the next reset, so after a few frames there should be no heap allocations at
+// all. Use it with the 'std::pmr' containers. Not thread safe - each thread that allocates
+// in a frame needs its own arena.
+class FrameArena : public std::pmr::memory_resource
+{
+public:
+  static constexpr auto DEFAULT_BLOCK_SIZE = static_cast<size_t>(64U * 1024U);
+  static constexpr auto MAX_BLOCK_SIZE     = static_cast<size_t>(16U * 1024U * 1024U);
+
+  explicit FrameArena(size_t blockSize = DEFAULT_BLOCK_SIZE) noexcept;
+  FrameArena(const FrameArena&)     = delete;
+  FrameArena(FrameArena&&) noexcept = delete;
+  ~FrameArena() noexcept override   = default;
+
+  auto operator=(const FrameArena&) -> FrameArena&     = delete;
+  auto operator=(FrameArena&&) noexcept -> FrameArena& = delete;
+
+  // Everything allocated since the last reset must be finished with.
+  auto Reset() noexcept -> void;
+
+  struct Usage
+  {
+    uint64_t numAllocations = 0U;
+    uint64_t numBytes       = 0U;
+  };
+  [[nodiscard]] auto GetCurrentFrameUsage() const noexcept -> const Usage&;
+  [[nodiscard]] auto GetLastFrameUsage() const noexcept -> const Usage&;
+  // The most allocations and the most bytes in any one frame, not necessarily the same one.
+  [[nodiscard]] auto GetMaxFrameUsage() const noexcept -> const Usage&;
+  [[nodiscard]] auto GetTotalUsage() const noexcept -> const Usage&;
+  [[nodiscard]] auto GetNumFrames() const noexcept -> uint64_t;
+  [[nodiscard]] auto GetBlockSize() const noexcept -> size_t;
+
+private:
+  std::vector<std::byte> m_block;
+  std::optional<std::pmr::monotonic_buffer_resource> m_resource;
+  auto ResetResource() noexcept -> void;
+  [[nodiscard]] auto GetRequiredBlockSize(const Usage& frameUsage) const noexcept -> size_t;
+
+  Usage m_currentFrameUsage{};
+  Usage m_lastFrameUsage{};
+  Usage m_maxFrameUsage{};
+  Usage m_totalUsage{};
+  uint64_t m_numFrames = 0U;
+
+  auto do_allocate(size_t numBytes, size_t alignment) -> void* override;
+  auto do_deallocate(void* ptr, size_t numBytes, size_t alignment) -> void override;
+  [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& other) const noexcept
+      -> bool override;
+};
+
+} // namespace GOOM::UTILS
+
+namespace GOOM::UTILS
+{
+
+inline FrameArena::FrameArena(const size_t blockSize) noexcept : m_block(blockSize)
+{
+  ResetResource();
+}
+
+inline auto FrameArena::ResetResource() noexcept -> void
+{
+  m_resource.reset();
+  m_resource.emplace(m_block.data(), m_block.size(), std::pmr::new_delete_resource());
+}
+
+inline auto FrameArena::Reset() noexcept -> void
+{
+  m_lastFrameUsage = m_currentFrameUsage;
+  m_maxFrameUsage.numAllocations =
+      std::max(m_maxFrameUsage.numAllocations, m_currentFrameUsage.numAllocations);
+  m_maxFrameUsage.numBytes = std::max(m_maxFrameUsage.numBytes, m_currentFrameUsage.numBytes);
+  m_totalUsage.numAllocations += m_currentFrameUsage.numAllocations;
+  m_totalUsage.numBytes += m_currentFrameUsage.numBytes;
+  ++m_numFrames;
+
+  if (const auto requiredBlockSize = GetRequiredBlockSize(m_currentFrameUsage);
+      requiredBlockSize > m_block.size())
+  {
+    m_resource.reset();
+    m_block = std::vector<std::byte>(requiredBlockSize);
+    ResetResource();
+  }
+  else
+  {
+    m_resource->release();
+  }
+
+  m_currentFrameUsage = Usage{};
+}
+
+// Allow for the worst case alignment padding, so a frame like the last one fits.
+inline auto FrameArena::GetRequiredBlockSize(const Usage& frameUsage) const noexcept -> size_t
+{
+  const auto numBytes =
+      frameUsage.numBytes + (frameUsage.numAllocations * alignof(std::max_align_t));
+  if (numBytes <= m_block.size())
+  {
+    return m_block.size();
+  }
+  return std::min(std::bit_ceil(static_cast<size_t>(numBytes)), MAX_BLOCK_SIZE);
+}
+
+inline auto FrameArena::GetCurrentFrameUsage() const noexcept -> const Usage&
+{
+  return m_currentFrameUsage;
+}
+
+inline auto FrameArena::GetLastFrameUsage() const noexcept -> const Usage&
+{
+  return m_lastFrameUsage;
+}
+
+inline auto FrameArena::GetMaxFrameUsage() const noexcept -> const Usage&
+{
+  return m_maxFrameUsage;
+}
+
+inline auto FrameArena::GetTotalUsage() const noexcept -> const Usage&
+{
+  return m_totalUsage;
+}
+
+inline auto FrameArena::GetNumFrames() const noexcept -> uint64_t
+{
+  return m_numFrames;
+}
+
+inline auto FrameArena::GetBlockSize() const noexcept -> size_t
+{
+  return m_block.size();
+}
+
+inline auto FrameArena::do_allocate(const size_t numBytes, const size_t alignment) -> void*
+{
+  ++m_currentFrameUsage.numAllocations;
+  m_currentFrameUsage.numBytes += numBytes;
+
+  return m_resource->allocate(numBytes, alignment);
+}
+
+inline auto FrameArena::do_deallocate([[maybe_unused]] void* const ptr,
+                                      [[maybe_unused]] const size_t numBytes,
+                                      [[maybe_unused]] const size_t alignment) -> void
+{
+}
+
+inline auto FrameArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool
+{
+  return this == &other;
+}
+
+} // namespace GOOM::UTILS
@@ -1,19 +1,22 @@
 module;
 
-#include <algorithm>
+#include <array>
 #include <blend2d.h> // NOLINT(misc-include-cleaner): Blend2d insists on this.
 #include <blend2d/context.h>
 #include <blend2d/format.h>
+#include <blend2d/geometry.h>
 #include <blend2d/image.h>
 #include <cstddef>
 #include <cstdint>
-#include <execution>
 #include <span>
 
 module Goom.Utils.Graphics.Blend2dToGoom;
 
+import Goom.Draw.DirtyTiles;
 import Goom.Draw.GoomDrawBase;
 import Goom.Draw.GoomDrawToBuffer;
+import Goom.Utils.Graphics.PixelBlend;
+import Goom.Utils.Parallel;
 import Goom.Lib.AssertUtils;
 import Goom.Lib.GoomGraphic;
 import Goom.Lib.GoomTypes;
@@ -21,42 +24,93 @@ import Goom.Lib.GoomTypes;
 namespace GOOM::UTILS::GRAPHICS
 {
 
+using DRAW::DirtyTiles;
 using DRAW::GoomDrawToTwoBuffers;
 
-Blend2dDoubleGoomBuffers::Blend2dDoubleGoomBuffers(
-    GoomDrawToTwoBuffers& draw,
-    const Dimensions& dimensions,
-    const DRAW::IGoomDraw::PixelBlendFunc& func) noexcept
-  : m_draw{&draw},
-    m_mainBuffer{dimensions, func},
-    m_lowBuffer{dimensions, func},
-    m_blend2DContexts{.mainBlend2dContext     = m_mainBuffer.GetBlend2DBuffer().blend2dContext,
-                      .lowBlend2dContext      = m_lowBuffer.GetBlend2DBuffer().blend2dContext,
-                      .blend2dBuffersWereUsed = false}
+Blend2dDoubleGoomBuffers::Blend2dDoubleGoomBuffers(Parallel& parallel,
+                                                   GoomDrawToTwoBuffers& draw,
+                                                   const Dimensions& dimensions,
+                                                   const PixelBlendRowType blendType) noexcept
+  : m_parallel{&parallel},
+    m_draw{&draw},
+    m_mainBuffer{dimensions, blendType},
+    m_lowBuffer{dimensions, blendType},
+    m_blend2DContexts{.mainBlend2dContext = m_mainBuffer.GetBlend2DBuffer().blend2dContext,
+                      .lowBlend2dContext  = m_lowBuffer.GetBlend2DBuffer().blend2dContext,
+                      .drawnTiles         = DirtyTiles{dimensions}}
 {
+  // The blend2d tiles are used as is to mark the goom buffer tiles.
+  Expects(m_blend2DContexts.drawnTiles.GetNumTiles() == m_draw->GetDirtyTiles().GetNumTiles());
+
+  m_tilesToUpdate.reserve(m_blend2DContexts.drawnTiles.GetNumTiles());
 }
 
-auto Blend2dDoubleGoomBuffers::Blend2dClearAll() -> void
+auto Blend2dDoubleGoomBuffers::Blend2dClear() -> void
 {
-  m_mainBuffer.GetBlend2DBuffer().blend2dContext.clearAll();
-  m_lowBuffer.GetBlend2DBuffer().blend2dContext.clearAll();
-  m_blend2DContexts.blend2dBuffersWereUsed = false;
+  auto& drawnTiles = m_blend2DContexts.drawnTiles;
+
+  // The drawn tiles start off all dirty, so the first clear is a full one.
+  const auto numTilesX = drawnTiles.GetNumTilesX();
+  for (auto tileY = 0U; tileY < drawnTiles.GetNumTilesY(); ++tileY)
+  {
+    const auto rowTileIndex = tileY * numTilesX;
+
+    auto tileX = 0U;
+    while (tileX < numTilesX)
+    {
+      if (not drawnTiles.IsDirty(rowTileIndex + tileX))
+      {
+        ++tileX;
+        continue;
+      }
+      const auto runBegin = tileX;
+      while ((tileX < numTilesX) and drawnTiles.IsDirty(rowTileIndex + tileX))
+      {
+        ++tileX;
+      }
+
+      const auto firstBounds = drawnTiles.GetTileBounds(rowTileIndex + runBegin);
+      const auto lastBounds  = drawnTiles.GetTileBounds(rowTileIndex + (tileX - 1));
+      const auto clearRect   = BLRectI{static_cast<int>(firstBounds.xBegin),
+                                     static_cast<int>(firstBounds.yBegin),
+                                     static_cast<int>(lastBounds.xEnd - firstBounds.xBegin),
+                                     static_cast<int>(firstBounds.yEnd - firstBounds.yBegin)};
+      m_mainBuffer.GetBlend2DBuffer().blend2dContext.clearRect(clearRect);
+      m_lowBuffer.GetBlend2DBuffer().blend2dContext.clearRect(clearRect);
+    }
+  }
+
+  drawnTiles.Clear();
 }
 
 auto Blend2dDoubleGoomBuffers::UpdateGoomBuffers() noexcept -> void
 {
-  if (not m_blend2DContexts.blend2dBuffersWereUsed)
+  m_blend2DContexts.drawnTiles.GetDirtyTileIndexes(m_tilesToUpdate);
+  if (m_tilesToUpdate.empty())
   {
     return;
   }
 
-  m_mainBuffer.UpdateGoomBuffer(m_draw->GetBuffer1());
-  m_lowBuffer.UpdateGoomBuffer(m_draw->GetBuffer2());
+  // Each tile is only touched by one thread.
+  m_parallel->ForLoop(m_tilesToUpdate.size(),
+                      [this](const size_t i) { UpdateGoomBuffersTile(m_tilesToUpdate[i]); });
+}
+
+auto Blend2dDoubleGoomBuffers::UpdateGoomBuffersTile(const uint32_t tileIndex) noexcept -> void
+{
+  const auto tileBounds = m_blend2DContexts.drawnTiles.GetTileBounds(tileIndex);
+
+  const auto mainUpdated = m_mainBuffer.UpdateGoomBuffer(m_draw->GetBuffer1(), tileBounds);
+  const auto lowUpdated  = m_lowBuffer.UpdateGoomBuffer(m_draw->GetBuffer2(), tileBounds);
+  if (mainUpdated or lowUpdated)
+  {
+    m_draw->GetDirtyTiles().MarkTile(tileIndex);
+  }
 }
 
 Blend2dToGoom::Blend2dToGoom(const Dimensions& dimensions,
-                             const DRAW::IGoomDraw::PixelBlendFunc& func) noexcept
-  : m_pixelBlendFunc{func},
+                             const PixelBlendRowType blendType) noexcept
+  : m_blendType{blendType},
     m_blend2DBuffer{GetNewBlend2DBuffer(dimensions)},
     m_shiftsAndMasks{GetShiftsAndMasks(m_blend2DBuffer.blend2dImage)}
 {
@@ -148,42 +202,50 @@ auto Blend2dToGoom::GetNewBlend2DBuffer(const Dimensions& dimensions) noexcept -
   };
 }
 
-auto Blend2dToGoom::UpdateGoomBuffer(PixelBuffer& goomBuffer) noexcept -> void
+auto Blend2dToGoom::UpdateGoomBuffer(PixelBuffer& goomBuffer,
+                                     const DirtyTiles::TileBounds& tileBounds) const noexcept
+    -> bool
 {
-  Expects(static_cast<bool>(m_pixelBlendFunc));
-
-  const auto blendPixel = [this](const uint32_t color, const Pixel& pixel) -> Pixel
-  { return GetBlendedPixel(color, pixel); };
-
   const auto srceBuffer = GetPixelBuffer(m_blend2DBuffer.blend2dImage);
-
-#ifdef __APPLE__
-  std::transform(srceBuffer.begin(),
-                 srceBuffer.end(),
-                 goomBuffer.GetPixelBuffer().begin(),
-                 goomBuffer.GetPixelBuffer().begin(),
-                 blendPixel);
-#else
-  std::transform(std::execution::par_unseq,
-                 srceBuffer.begin(),
-                 srceBuffer.end(),
-                 goomBuffer.GetPixelBuffer().begin(),
-                 goomBuffer.GetPixelBuffer().begin(),
-                 blendPixel);
-#endif
-}
-
-[[nodiscard]] auto Blend2dToGoom::GetBlendedPixel(const uint32_t blend2dColor,
-                                                  const Pixel& pixel) const noexcept -> Pixel
-{
-  if (static constexpr auto BLACK_CUTOFF = 5U; blend2dColor < BLACK_CUTOFF)
+  const auto destBuffer = goomBuffer.GetPixelBuffer();
+  const auto isBlack    = [&srceBuffer](const size_t buffPos)
+  { return srceBuffer[buffPos] < BLACK_CUTOFF; };
+
+  // Most of a drawn tile is usually still black, so only the non-black runs are converted
+  // and blended.
+  auto runPixels = std::array<Pixel, DirtyTiles::TILE_SIZE>{};
+  auto updated   = false;
+  for (auto y = tileBounds.yBegin; y < tileBounds.yEnd; ++y)
   {
-    return pixel;
-  }
+    const auto rowStart = goomBuffer.GetBuffPos(size_t{0}, static_cast<size_t>(y));
+    const auto rowEnd   = rowStart + tileBounds.xEnd;
 
-  const auto blend2Pixel = GetGoomPixel(blend2dColor);
+    auto buffPos = rowStart + tileBounds.xBegin;
+    while (buffPos < rowEnd)
+    {
+      if (isBlack(buffPos))
+      {
+        ++buffPos;
+        continue;
+      }
+      const auto runStart = buffPos;
+      auto runLength      = 0U;
+      while ((buffPos < rowEnd) and (not isBlack(buffPos)))
+      {
+        runPixels.at(runLength) = GetGoomPixel(srceBuffer[buffPos]);
+        ++runLength;
+        ++buffPos;
+      }
+
+      BlendPixelRow(m_blendType,
+                    m_intBuffIntensity,
+                    std::span<const Pixel>{runPixels}.first(runLength),
+                    destBuffer.subspan(runStart, runLength));
+      updated = true;
+    }
+  }
 
-  return m_pixelBlendFunc(pixel, m_intBuffIntensity, blend2Pixel, m_newAlpha);
+  return updated;
 }
 
 [[nodiscard]] auto Blend2dToGoom::GetImageData(const BLImage& blImage) noexcept -> BLImageData
@@ -6,11 +6,15 @@ module;
 #include <blend2d/image.h>
 #include <cstdint>
 #include <span>
+#include <vector>
 
 export module Goom.Utils.Graphics.Blend2dToGoom;
 
+import Goom.Draw.DirtyTiles;
 import Goom.Draw.GoomDrawBase;
 import Goom.Draw.GoomDrawToBuffer;
+import Goom.Utils.Graphics.PixelBlend;
+import Goom.Utils.Parallel;
 import Goom.Lib.GoomGraphic;
 import Goom.Lib.GoomTypes;
 
@@ -26,8 +30,7 @@ public:
     BLContext blend2dContext;
   };
 
-  explicit Blend2dToGoom(const Dimensions& dimensions,
-                         const DRAW::IGoomDraw::PixelBlendFunc& func = nullptr) noexcept;
+  Blend2dToGoom(const Dimensions& dimensions, PixelBlendRowType blendType) noexcept;
 
   [[nodiscard]] auto GetBlend2DBuffer() const noexcept -> const Blend2DBuffer&;
   [[nodiscard]] auto GetBlend2DBuffer() noexcept -> Blend2DBuffer&;
@@ -35,17 +38,18 @@ public:
   [[nodiscard]] static auto GetBlend2dColor(const Pixel& pixel) -> uint32_t;
 
   auto SetIntBuffIntensity(float buffIntensity) noexcept -> void;
-  auto SetNewAlpha(PixelChannelType newAlpha) noexcept -> void;
-  auto SetPixelBlendFunc(const DRAW::IGoomDraw::PixelBlendFunc& func) noexcept -> void;
+  auto SetPixelBlendType(PixelBlendRowType blendType) noexcept -> void;
 
-  auto UpdateGoomBuffer(PixelBuffer& goomBuffer) noexcept -> void;
+  // Only blends the pixels inside 'tileBounds', so different tiles can be done at the same
+  // time. Returns false if there was nothing in the tile to blend.
+  auto UpdateGoomBuffer(PixelBuffer& goomBuffer,
+                        const DRAW::DirtyTiles::TileBounds& tileBounds) const noexcept -> bool;
 
 private:
-  DRAW::IGoomDraw::PixelBlendFunc m_pixelBlendFunc;
+  PixelBlendRowType m_blendType;
   // TODO(glk): Buff intensity is not really used?
   static constexpr float DEFAULT_BUFF_INTENSITY = 1.0F;
   uint32_t m_intBuffIntensity = DRAW::IGoomDraw::GetIntBuffIntensity(DEFAULT_BUFF_INTENSITY);
-  PixelChannelType m_newAlpha = MAX_ALPHA;
 
   Blend2DBuffer m_blend2DBuffer;
   static auto GetNewBlend2DBuffer(const Dimensions& dimensions) noexcept -> Blend2DBuffer;
@@ -71,35 +75,40 @@ private:
 
   static constexpr auto MAX_BLEND2D_CHANNEL = 256U;
   static constexpr auto CHANNEL_MULTIPLIER  = 50U;
+  static constexpr auto BLACK_CUTOFF        = 5U;
   [[nodiscard]] auto GetGoomPixel(uint32_t blend2dColor) const noexcept -> Pixel;
-  [[nodiscard]] auto GetBlendedPixel(uint32_t blend2dColor, const Pixel& pixel) const noexcept
-      -> Pixel;
 };
 
 struct Blend2dContexts
 {
   BLContext mainBlend2dContext;
   BLContext lowBlend2dContext;
-  bool blend2dBuffersWereUsed;
+  // Anything drawn into the contexts must mark the tiles it drew on - only these tiles
+  // get merged into the goom buffers, and cleared for the next frame.
+  DRAW::DirtyTiles drawnTiles;
 };
 
 class Blend2dDoubleGoomBuffers
 {
 public:
-  Blend2dDoubleGoomBuffers(DRAW::GoomDrawToTwoBuffers& draw,
+  Blend2dDoubleGoomBuffers(Parallel& parallel,
+                           DRAW::GoomDrawToTwoBuffers& draw,
                            const Dimensions& dimensions,
-                           const DRAW::IGoomDraw::PixelBlendFunc& func = nullptr) noexcept;
+                           PixelBlendRowType blendType) noexcept;
 
   [[nodiscard]] auto GetBlend2dContexts() noexcept -> Blend2dContexts&;
 
-  auto Blend2dClearAll() -> void;
+  auto Blend2dClear() -> void;
   auto UpdateGoomBuffers() noexcept -> void;
 
 private:
+  Parallel* m_parallel;
   DRAW::GoomDrawToTwoBuffers* m_draw;
   Blend2dToGoom m_mainBuffer;
   Blend2dToGoom m_lowBuffer;
   Blend2dContexts m_blend2DContexts;
+  std::vector<uint32_t> m_tilesToUpdate;
+  auto UpdateGoomBuffersTile(uint32_t tileIndex) noexcept -> void;
 };
 
 } // namespace GOOM::UTILS::GRAPHICS
@@ -122,10 +131,9 @@ inline auto Blend2dToGoom::GetBlend2DBuffer() noexcept -> Blend2DBuffer&
   return m_blend2DBuffer;
 }
 
-inline auto Blend2dToGoom::SetPixelBlendFunc(const DRAW::IGoomDraw::PixelBlendFunc& func) noexcept
-    -> void
+inline auto Blend2dToGoom::SetPixelBlendType(const PixelBlendRowType blendType) noexcept -> void
 {
-  m_pixelBlendFunc = func;
+  m_blendType = blendType;
 }
 
 inline auto Blend2dToGoom::SetIntBuffIntensity(const float buffIntensity) noexcept -> void
@@ -133,9 +141,4 @@ inline auto Blend2dToGoom::SetIntBuffIntensity(const float buffIntensity) noexce
   m_intBuffIntensity = DRAW::IGoomDraw::GetIntBuffIntensity(buffIntensity);
 }
 
-inline auto Blend2dToGoom::SetNewAlpha(const PixelChannelType newAlpha) noexcept -> void
-{
-  m_newAlpha = newAlpha;
-}
-
 } // namespace GOOM::UTILS::GRAPHICS
@@ -5,6 +5,8 @@ module;
 #include <blend2d/context.h>
 #include <blend2d/gradient.h>
 #include <blend2d/rgba.h>
+#include <cmath>
+#include <cstdint>
 
 module Goom.Utils.Graphics.Blend2dUtils;
 
@@ -70,6 +72,11 @@ auto FillCircleWithGradient(Blend2dContexts& blend2DContexts,
   radialGradient = GetRadialGradient(centre, radius, GetLowColor(colors), brightness);
   blend2DContexts.mainBlend2dContext.fillCircle(
       static_cast<double>(centre.x), static_cast<double>(centre.y), radius, radialGradient);
+
+  // Allow a pixel for the anti-aliased edge.
+  const auto extent = static_cast<int32_t>(std::ceil(radius)) + 1;
+  blend2DContexts.drawnTiles.MarkRectangle({.x = centre.x - extent, .y = centre.y - extent},
+                                           {.x = centre.x + extent, .y = centre.y + extent});
 }
 
 } // namespace GOOM::UTILS::GRAPHICS
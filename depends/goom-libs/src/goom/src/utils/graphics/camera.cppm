@@ -1,12 +1,15 @@
 module;
 
+#include <cstddef>
 #include <glm/ext/matrix_float4x4.hpp>
 #include <glm/ext/vector_float3.hpp>
 #include <glm/ext/vector_float4.hpp>
+#include <span>
 
 export module Goom.Utils.Graphics.Camera;
 
 import Goom.Utils.Math.Misc;
+import Goom.Lib.AssertUtils;
 import Goom.Lib.GoomTypes;
 import Goom.Lib.Point2d;
 
@@ -40,6 +43,9 @@ public:
 
   auto SetScreenPositionOffset(const Point2dInt& offset) noexcept -> void;
   [[nodiscard]] auto GetScreenPosition(const glm::vec4& worldPosition) const noexcept -> Point2dInt;
+  // Same as 'GetScreenPosition', but for a whole array of positions in one pass.
+  auto GetScreenPositions(std::span<const glm::vec4> worldPositions,
+                          std::span<Point2dInt> screenPositions) const noexcept -> void;
 
 private:
   Properties m_cameraProperties;
@@ -94,4 +100,27 @@ inline auto Camera::GetScreenPosition(const glm::vec4& worldPosition) const noex
   // NOLINTEND(cppcoreguidelines-pro-type-union-access)
 }
 
+inline auto Camera::GetScreenPositions(const std::span<const glm::vec4> worldPositions,
+                                       const std::span<Point2dInt> screenPositions) const noexcept
+    -> void
+{
+  Expects(screenPositions.size() >= worldPositions.size());
+
+  // Local copies, so the compiler knows they can't change inside the loop.
+  const auto modelViewProjection = m_modelViewProjection;
+  const auto halfScreenWidth     = m_halfScreenWidth;
+  const auto halfScreenHeight    = m_halfScreenHeight;
+  const auto offset              = m_screenPositionOffset;
+
+  for (auto i = size_t{0}; i < worldPositions.size(); ++i)
+  {
+    const auto mvpPos = modelViewProjection * worldPositions[i];
+
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access): union hard to fix here
+    screenPositions[i] = offset + ToVec2dInt(Vec2dFlt{.x = halfScreenWidth * (1.0F + mvpPos.x),
+                                                      .y = halfScreenHeight * (1.0F - mvpPos.y)});
+    // NOLINTEND(cppcoreguidelines-pro-type-union-access)
+  }
+}
+
 } // namespace GOOM::UTILS::GRAPHICS
@@ -4,9 +4,11 @@ module;
 #include <cstdint>
 #include <exception>
 #include <format>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #define STB_IMAGE_IMPLEMENTATION
 #ifdef _MSC_VER
@@ -72,6 +74,45 @@ auto ImageBitmap::Load(const std::string& imageFilename) -> void
   }
 
   ::stbi_image_free(rgbImage);
+
+  SetPixelRuns();
+}
+
+auto ImageBitmap::SetPixelRuns() noexcept -> void
+{
+  // Transparent and black pixels are never drawn.
+  const auto isDrawn = [](const RGB& pixel)
+  {
+    const auto isBlack = (0U == pixel.red) and (0U == pixel.green) and (0U == pixel.blue);
+    return (pixel.alpha != 0U) and (not isBlack);
+  };
+
+  m_pixelRuns.clear();
+  m_rowRunStarts.resize(static_cast<size_t>(m_height) + 1);
+
+  for (auto y = 0U; y < m_height; ++y)
+  {
+    m_rowRunStarts[y] = static_cast<uint32_t>(m_pixelRuns.size());
+
+    const auto row = GetBuffer().subspan(static_cast<size_t>(y) * m_width, m_width);
+    auto x         = 0U;
+    while (x < m_width)
+    {
+      if (not isDrawn(row[x]))
+      {
+        ++x;
+        continue;
+      }
+      const auto xBegin = x;
+      while ((x < m_width) and isDrawn(row[x]))
+      {
+        ++x;
+      }
+      m_pixelRuns.emplace_back(PixelRun{.xBegin = xBegin, .xEnd = x});
+    }
+  }
+
+  m_rowRunStarts[m_height] = static_cast<uint32_t>(m_pixelRuns.size());
 }
 
 auto ImageBitmap::GetRGBImage() const -> std::tuple<uint8_t*, int32_t, int32_t, int32_t>
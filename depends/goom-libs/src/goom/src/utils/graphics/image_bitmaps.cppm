@@ -31,6 +31,16 @@ public:
 
   auto operator()(size_t x, size_t y) const noexcept -> Pixel;
 
+  // A run of pixels along a row that are neither transparent nor black, so they're worth
+  // drawing. The runs are worked out when the image is loaded, so drawers can skip the
+  // rest of the image.
+  struct PixelRun
+  {
+    uint32_t xBegin;
+    uint32_t xEnd;
+  };
+  [[nodiscard]] auto GetRowRuns(size_t y) const noexcept -> std::span<const PixelRun>;
+
 protected:
   struct RGB
   {
@@ -46,6 +56,10 @@ private:
   uint32_t m_width{};
   uint32_t m_height{};
   std::vector<RGB> m_owningBuff;
+  std::vector<PixelRun> m_pixelRuns;
+  // Where each row's runs start in 'm_pixelRuns', plus one past the end.
+  std::vector<uint32_t> m_rowRunStarts;
+  auto SetPixelRuns() noexcept -> void;
   std::string m_filename;
   [[nodiscard]] auto GetRGBImage() const -> std::tuple<uint8_t*, int32_t, int32_t, int32_t>;
   auto SetPixel(size_t x, size_t y, const RGB& pixel) noexcept -> void;
@@ -93,6 +107,12 @@ inline auto ImageBitmap::operator()(const size_t x, const size_t y) const noexce
   };
 }
 
+inline auto ImageBitmap::GetRowRuns(const size_t y) const noexcept -> std::span<const PixelRun>
+{
+  return std::span<const PixelRun>{m_pixelRuns}.subspan(
+      m_rowRunStarts[y], m_rowRunStarts[y + 1] - m_rowRunStarts[y]);
+}
+
 inline auto ImageBitmap::GetBuffer() const noexcept -> std::span<const RGB>
 {
   return std::span<const RGB>{m_owningBuff};
@@ -0,0 +1,532 @@
+module;
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#define GOOM_HAS_X86_SIMD
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define GOOM_SIMD_TARGET(isa) __attribute__((target(isa)))
+#else
+#define GOOM_SIMD_TARGET(isa)
+#endif
+
+module Goom.Utils.Graphics.PixelBlend;
+
+import Goom.Utils.CpuFeatures;
+import Goom.Utils.Graphics.PixelUtils;
+import Goom.Utils.Math.Misc;
+import Goom.Lib.AssertUtils;
+import Goom.Lib.GoomGraphic;
+
+namespace GOOM::UTILS::GRAPHICS
+{
+
+namespace
+{
+
+// A fgnd stride of zero is used for a single fgnd color.
+struct RowBlendParams
+{
+  uint32_t fgndIntBuffIntensity;
+  const Pixel* fgndColors;
+  size_t fgndStride;
+  std::span<Pixel> bgndColors;
+};
+
+template<PixelBlendRowType BLEND_TYPE>
+[[nodiscard]] constexpr auto GetScalarBlendedPixel(const Pixel& bgndColor,
+                                                   const uint32_t fgndIntBuffIntensity,
+                                                   const Pixel& fgndColor) noexcept -> Pixel
+{
+  const auto newAlpha = fgndColor.A();
+
+  if constexpr (BLEND_TYPE == PixelBlendRowType::COLOR_ADD)
+  {
+    return GetColorAddPixelBlend(bgndColor, fgndIntBuffIntensity, fgndColor, newAlpha);
+  }
+  else if constexpr (BLEND_TYPE == PixelBlendRowType::DARKEN_ONLY)
+  {
+    return GetDarkenOnlyPixelBlend(bgndColor, fgndIntBuffIntensity, fgndColor, newAlpha);
+  }
+  else if constexpr (BLEND_TYPE == PixelBlendRowType::LIGHTEN_ONLY)
+  {
+    return GetLightenOnlyPixelBlend(bgndColor, fgndIntBuffIntensity, fgndColor, newAlpha);
+  }
+  else if constexpr (BLEND_TYPE == PixelBlendRowType::COLOR_MULTIPLY)
+  {
+    return GetColorMultiplyPixelBlend(bgndColor, fgndIntBuffIntensity, fgndColor, newAlpha);
+  }
+  else if constexpr (BLEND_TYPE == PixelBlendRowType::COLOR_ALPHA)
+  {
+    return GetColorAlphaNoAddBlend(bgndColor, fgndIntBuffIntensity, fgndColor, newAlpha);
+  }
+  else
+  {
+    return GetColorAlphaAndAddBlend(bgndColor, fgndIntBuffIntensity, fgndColor, newAlpha);
+  }
+}
+
+template<PixelBlendRowType BLEND_TYPE>
+auto BlendScalarPixelRow(const RowBlendParams& params, const size_t startIndex) noexcept -> void
+{
+  for (auto i = startIndex; i < params.bgndColors.size(); ++i)
+  {
+    auto& bgndColor = params.bgndColors[i];
+    bgndColor       = GetScalarBlendedPixel<BLEND_TYPE>(
+        bgndColor, params.fgndIntBuffIntensity, params.fgndColors[i * params.fgndStride]);
+  }
+}
+
+#ifdef GOOM_HAS_X86_SIMD
+
+// Each pixel is widened to four uint32 lanes, (R, G, B, A) on x86, so the sums and products
+// can't overflow before they're clamped, exactly as the scalar blends do it. The divides by
+// 255 and 65535 are done with the same multiply and shift a compiler would use, so they're
+// exact. SSE4.1 does one pixel a register, AVX2 does two.
+
+inline constexpr auto BRIGHTER_SHIFT =
+    static_cast<int>(UTILS::MATH::Log2(CHANNEL_COLOR_SCALAR_DIVISOR));
+// GetBrighterColor scales its brightness by 256, which is exact for the black brightness.
+inline constexpr auto BLACK_BLEND_INT_BRIGHTNESS =
+    static_cast<uint32_t>(BLACK_BLEND_BRIGHTNESS * 256.0F);
+inline constexpr auto DIV_255_MULTIPLIER   = 0x80808081U;
+inline constexpr auto DIV_255_SHIFT        = 39;
+inline constexpr auto DIV_65535_MULTIPLIER = 0x80008001U;
+inline constexpr auto DIV_65535_SHIFT      = 47;
+inline constexpr auto CHANNEL_MASK         = 0xFFFFU;
+inline constexpr auto SWAP_LANE_PAIRS      = 0xB1;
+inline constexpr auto SWAP_LANE_HALVES     = 0x4E;
+inline constexpr auto BROADCAST_ALPHA_LANE = 0xFF;
+// The blend masks of the alpha lanes and the odd lanes, in 16-bit lanes for SSE4.1 and in
+// 32-bit lanes for AVX2.
+inline constexpr auto SSE_ALPHA_LANE = 0xC0;
+inline constexpr auto SSE_ODD_LANES  = 0xCC;
+inline constexpr auto AVX_ALPHA_LANE = 0x88;
+inline constexpr auto AVX_ODD_LANES  = 0xAA;
+
+inline constexpr auto AVX2_GATHER_ORDER = 0x08; // Pixel 0, then pixel 1, in the low 128 bits.
+
+GOOM_SIMD_TARGET("sse4.1")
+inline auto LoadSse41Pixel(const Pixel* const pixel) noexcept -> __m128i
+{
+  return _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pixel)));
+}
+
+GOOM_SIMD_TARGET("sse4.1")
+inline auto StoreSse41Pixel(Pixel* const pixel, const __m128i channels) noexcept -> void
+{
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(pixel), _mm_packus_epi32(channels, channels));
+}
+
+GOOM_SIMD_TARGET("sse4.1")
+inline auto GetSse41UnsignedDivide(const __m128i dividend,
+                                   const uint32_t multiplier,
+                                   const int shift) noexcept -> __m128i
+{
+  const auto multiplierVec = _mm_set1_epi32(static_cast<int32_t>(multiplier));
+  const auto shiftVec      = _mm_cvtsi32_si128(shift);
+
+  const auto evenLanes = _mm_srl_epi64(_mm_mul_epu32(dividend, multiplierVec), shiftVec);
+  const auto oddLanes =
+      _mm_srl_epi64(_mm_mul_epu32(_mm_srli_epi64(dividend, 32), multiplierVec), shiftVec);
+
+  return _mm_blend_epi16(evenLanes, _mm_slli_epi64(oddLanes, 32), SSE_ODD_LANES);
+}
+
+GOOM_SIMD_TARGET("sse4.1")
+inline auto GetSse41IsCloseToBlack(const __m128i color) noexcept -> __m128i
+{
+  const auto threshold  = _mm_set1_epi32(static_cast<int32_t>(BLACK_BLEND_THRESHOLD));
+  const auto rgbIsBelow = _mm_blend_epi16(
+      _mm_cmpgt_epi32(threshold, color), _mm_set1_epi32(-1), SSE_ALPHA_LANE);
+  const auto pairs = _mm_and_si128(rgbIsBelow, _mm_shuffle_epi32(rgbIsBelow, SWAP_LANE_PAIRS));
+  return _mm_and_si128(pairs, _mm_shuffle_epi32(pairs, SWAP_LANE_HALVES));
+}
+
+GOOM_SIMD_TARGET("sse4.1")
+inline auto GetSse41BrighterColor(const __m128i brightness, const __m128i color) noexcept
+    -> __m128i
+{
+  const auto brighter = _mm_min_epu32(
+      _mm_srli_epi32(_mm_mullo_epi32(brightness, color), BRIGHTER_SHIFT),
+      _mm_set1_epi32(static_cast<int32_t>(MAX_CHANNEL_VALUE_HDR)));
+  return _mm_blend_epi16(brighter, color, SSE_ALPHA_LANE);
+}
+
+GOOM_SIMD_TARGET("sse4.1")
+inline auto GetSse41ColorAdd(const __m128i color1, const __m128i color2) noexcept -> __m128i
+{
+  return _mm_min_epu32(_mm_add_epi32(color1, color2),
+                       _mm_set1_epi32(static_cast<int32_t>(MAX_CHANNEL_VALUE_HDR)));
+}
+
+GOOM_SIMD_TARGET("sse4.1")
+inline auto GetSse41ColorMultiply(const __m128i color1, const __m128i color2) noexcept -> __m128i
+{
+  const auto product = _mm_mullo_epi32(color1, color2);
+  return _mm_and_si128(GetSse41UnsignedDivide(product, DIV_255_MULTIPLIER, DIV_255_SHIFT),
+                       _mm_set1_epi32(static_cast<int32_t>(CHANNEL_MASK)));
+}
+
+GOOM_SIMD_TARGET("sse4.1")
+inline auto GetSse41ColorAlphaBlend(const __m128i bgndColor, const __m128i fgndColor) noexcept
+    -> __m128i
+{
+  const auto fgndAlpha = _mm_shuffle_epi32(fgndColor, BROADCAST_ALPHA_LANE);
+  const auto product   = _mm_mullo_epi32(fgndAlpha, _mm_sub_epi32(fgndColor, bgndColor));
+  const auto quotient =
+      GetSse41UnsignedDivide(_mm_abs_epi32(product), DIV_65535_MULTIPLIER, DIV_65535_SHIFT);
+  return _mm_and_si128(_mm_add_epi32(bgndColor, _mm_sign_epi32(quotient, product)),
+                       _mm_set1_epi32(static_cast<int32_t>(CHANNEL_MASK)));
+}
+
+// The new alpha is the fgnd alpha.
+GOOM_SIMD_TARGET("sse4.1")
+inline auto GetSse41WithNewAlpha(const __m128i color, const __m128i fgndColor) noexcept
+    -> __m128i
+{
+  return _mm_blend_epi16(color, fgndColor, SSE_ALPHA_LANE);
+}
+
+template<PixelBlendRowType BLEND_TYPE>
+GOOM_SIMD_TARGET("sse4.1")
+inline auto GetSse41BlendedPixel(const __m128i bgndColor,
+                                 const __m128i brightness,
+                                 const __m128i fgndColor) noexcept -> __m128i
+{
+  if constexpr ((BLEND_TYPE == PixelBlendRowType::DARKEN_ONLY) or
+                (BLEND_TYPE == PixelBlendRowType::COLOR_MULTIPLY))
+  {
+    const auto blackBrightness =
+        _mm_set1_epi32(static_cast<int32_t>(BLACK_BLEND_INT_BRIGHTNESS));
+    const auto blendedColor =
+        BLEND_TYPE == PixelBlendRowType::DARKEN_ONLY
+            ? _mm_min_epu32(bgndColor, GetSse41BrighterColor(brightness, fgndColor))
+            : GetSse41ColorAdd(GetSse41ColorMultiply(bgndColor, fgndColor),
+                               GetSse41BrighterColor(brightness, fgndColor));
+
+    const auto bgndOrBlendedColor =
+        _mm_blendv_epi8(GetSse41WithNewAlpha(blendedColor, fgndColor),
+                        GetSse41BrighterColor(blackBrightness, fgndColor),
+                        GetSse41IsCloseToBlack(bgndColor));
+    return _mm_blendv_epi8(bgndOrBlendedColor,
+                           GetSse41BrighterColor(blackBrightness, bgndColor),
+                           GetSse41IsCloseToBlack(fgndColor));
+  }
+  else if constexpr (BLEND_TYPE == PixelBlendRowType::LIGHTEN_ONLY)
+  {
+    const auto maxColor = _mm_max_epu32(bgndColor, GetSse41BrighterColor(brightness, fgndColor));
+    return GetSse41WithNewAlpha(maxColor, fgndColor);
+  }
+  else if constexpr (BLEND_TYPE == PixelBlendRowType::COLOR_ALPHA)
+  {
+    return GetSse41WithNewAlpha(GetSse41ColorAlphaBlend(bgndColor, fgndColor), fgndColor);
+  }
+  else
+  {
+    auto addColor = fgndColor;
+    if constexpr (BLEND_TYPE == PixelBlendRowType::COLOR_ALPHA_AND_ADD)
+    {
+      const auto isOpaque = _mm_shuffle_epi32(
+          _mm_cmpeq_epi32(fgndColor, _mm_set1_epi32(MAX_ALPHA)), BROADCAST_ALPHA_LANE);
+      addColor =
+          _mm_blendv_epi8(GetSse41ColorAlphaBlend(bgndColor, fgndColor), fgndColor, isOpaque);
+    }
+    const auto addedColor =
+        GetSse41ColorAdd(bgndColor, GetSse41BrighterColor(brightness, addColor));
+    return GetSse41WithNewAlpha(addedColor, fgndColor);
+  }
+}
+
+template<PixelBlendRowType BLEND_TYPE>
+GOOM_SIMD_TARGET("sse4.1")
+auto BlendSse41PixelRow(const RowBlendParams& params) noexcept -> size_t
+{
+  const auto brightness = _mm_set1_epi32(static_cast<int32_t>(params.fgndIntBuffIntensity));
+
+  auto* const bgndColors = params.bgndColors.data();
+  const auto numPixels   = params.bgndColors.size();
+
+  for (auto i = 0U; i < numPixels; ++i)
+  {
+    const auto bgndColor = LoadSse41Pixel(bgndColors + i);
+    const auto fgndColor = LoadSse41Pixel(params.fgndColors + (i * params.fgndStride));
+
+    StoreSse41Pixel(bgndColors + i,
+                    GetSse41BlendedPixel<BLEND_TYPE>(bgndColor, brightness, fgndColor));
+  }
+
+  return numPixels;
+}
+
+GOOM_SIMD_TARGET("avx2")
+inline auto LoadAvx2Pixels(const Pixel* const pixel0, const Pixel* const pixel1) noexcept
+    -> __m256i
+{
+  return _mm256_cvtepu16_epi32(
+      _mm_unpacklo_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pixel0)),
+                         _mm_loadl_epi64(reinterpret_cast<const __m128i*>(pixel1))));
+}
+
+GOOM_SIMD_TARGET("avx2")
+inline auto StoreAvx2Pixels(Pixel* const pixels, const __m256i channels) noexcept -> void
+{
+  const auto packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(channels, channels),
+                                               AVX2_GATHER_ORDER);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels), _mm256_castsi256_si128(packed));
+}
+
+GOOM_SIMD_TARGET("avx2")
+inline auto GetAvx2UnsignedDivide(const __m256i dividend,
+                                  const uint32_t multiplier,
+                                  const int shift) noexcept -> __m256i
+{
+  const auto multiplierVec = _mm256_set1_epi32(static_cast<int32_t>(multiplier));
+  const auto shiftVec      = _mm_cvtsi32_si128(shift);
+
+  const auto evenLanes = _mm256_srl_epi64(_mm256_mul_epu32(dividend, multiplierVec), shiftVec);
+  const auto oddLanes =
+      _mm256_srl_epi64(_mm256_mul_epu32(_mm256_srli_epi64(dividend, 32), multiplierVec), shiftVec);
+
+  return _mm256_blend_epi32(evenLanes, _mm256_slli_epi64(oddLanes, 32), AVX_ODD_LANES);
+}
+
+GOOM_SIMD_TARGET("avx2")
+inline auto GetAvx2IsCloseToBlack(const __m256i colors) noexcept -> __m256i
+{
+  const auto threshold  = _mm256_set1_epi32(static_cast<int32_t>(BLACK_BLEND_THRESHOLD));
+  const auto rgbIsBelow = _mm256_blend_epi32(
+      _mm256_cmpgt_epi32(threshold, colors), _mm256_set1_epi32(-1), AVX_ALPHA_LANE);
+  const auto pairs =
+      _mm256_and_si256(rgbIsBelow, _mm256_shuffle_epi32(rgbIsBelow, SWAP_LANE_PAIRS));
+  return _mm256_and_si256(pairs, _mm256_shuffle_epi32(pairs, SWAP_LANE_HALVES));
+}
+
+GOOM_SIMD_TARGET("avx2")
+inline auto GetAvx2BrighterColors(const __m256i brightness, const __m256i colors) noexcept
+    -> __m256i
+{
+  const auto brighter = _mm256_min_epu32(
+      _mm256_srli_epi32(_mm256_mullo_epi32(brightness, colors), BRIGHTER_SHIFT),
+      _mm256_set1_epi32(static_cast<int32_t>(MAX_CHANNEL_VALUE_HDR)));
+  return _mm256_blend_epi32(brighter, colors, AVX_ALPHA_LANE);
+}
+
+GOOM_SIMD_TARGET("avx2")
+inline auto GetAvx2ColorsAdd(const __m256i colors1, const __m256i colors2) noexcept -> __m256i
+{
+  return _mm256_min_epu32(_mm256_add_epi32(colors1, colors2),
+                          _mm256_set1_epi32(static_cast<int32_t>(MAX_CHANNEL_VALUE_HDR)));
+}
+
+GOOM_SIMD_TARGET("avx2")
+inline auto GetAvx2ColorsMultiply(const __m256i colors1, const __m256i colors2) noexcept
+    -> __m256i
+{
+  const auto product = _mm256_mullo_epi32(colors1, colors2);
+  return _mm256_and_si256(GetAvx2UnsignedDivide(product, DIV_255_MULTIPLIER, DIV_255_SHIFT),
+                          _mm256_set1_epi32(static_cast<int32_t>(CHANNEL_MASK)));
+}
+
+GOOM_SIMD_TARGET("avx2")
+inline auto GetAvx2ColorsAlphaBlend(const __m256i bgndColors, const __m256i fgndColors) noexcept
+    -> __m256i
+{
+  const auto fgndAlphas = _mm256_shuffle_epi32(fgndColors, BROADCAST_ALPHA_LANE);
+  const auto product    = _mm256_mullo_epi32(fgndAlphas, _mm256_sub_epi32(fgndColors, bgndColors));
+  const auto quotient =
+      GetAvx2UnsignedDivide(_mm256_abs_epi32(product), DIV_65535_MULTIPLIER, DIV_65535_SHIFT);
+  return _mm256_and_si256(_mm256_add_epi32(bgndColors, _mm256_sign_epi32(quotient, product)),
+                          _mm256_set1_epi32(static_cast<int32_t>(CHANNEL_MASK)));
+}
+
+GOOM_SIMD_TARGET("avx2")
+inline auto GetAvx2WithNewAlpha(const __m256i colors, const __m256i fgndColors) noexcept
+    -> __m256i
+{
+  return _mm256_blend_epi32(colors, fgndColors, AVX_ALPHA_LANE);
+}
+
+template<PixelBlendRowType BLEND_TYPE>
+GOOM_SIMD_TARGET("avx2")
+inline auto GetAvx2BlendedPixels(const __m256i bgndColors,
+                                 const __m256i brightness,
+                                 const __m256i fgndColors) noexcept -> __m256i
+{
+  if constexpr ((BLEND_TYPE == PixelBlendRowType::DARKEN_ONLY) or
+                (BLEND_TYPE == PixelBlendRowType::COLOR_MULTIPLY))
+  {
+    const auto blackBrightness =
+        _mm256_set1_epi32(static_cast<int32_t>(BLACK_BLEND_INT_BRIGHTNESS));
+    const auto blendedColors =
+        BLEND_TYPE == PixelBlendRowType::DARKEN_ONLY
+            ? _mm256_min_epu32(bgndColors, GetAvx2BrighterColors(brightness, fgndColors))
+            : GetAvx2ColorsAdd(GetAvx2ColorsMultiply(bgndColors, fgndColors),
+                               GetAvx2BrighterColors(brightness, fgndColors));
+
+    const auto bgndOrBlendedColors =
+        _mm256_blendv_epi8(GetAvx2WithNewAlpha(blendedColors, fgndColors),
+                           GetAvx2BrighterColors(blackBrightness, fgndColors),
+                           GetAvx2IsCloseToBlack(bgndColors));
+    return _mm256_blendv_epi8(bgndOrBlendedColors,
+                              GetAvx2BrighterColors(blackBrightness, bgndColors),
+                              GetAvx2IsCloseToBlack(fgndColors));
+  }
+  else if constexpr (BLEND_TYPE == PixelBlendRowType::LIGHTEN_ONLY)
+  {
+    const auto maxColors =
+        _mm256_max_epu32(bgndColors, GetAvx2BrighterColors(brightness, fgndColors));
+    return GetAvx2WithNewAlpha(maxColors, fgndColors);
+  }
+  else if constexpr (BLEND_TYPE == PixelBlendRowType::COLOR_ALPHA)
+  {
+    return GetAvx2WithNewAlpha(GetAvx2ColorsAlphaBlend(bgndColors, fgndColors), fgndColors);
+  }
+  else
+  {
+    auto addColors = fgndColors;
+    if constexpr (BLEND_TYPE == PixelBlendRowType::COLOR_ALPHA_AND_ADD)
+    {
+      const auto isOpaque = _mm256_shuffle_epi32(
+          _mm256_cmpeq_epi32(fgndColors, _mm256_set1_epi32(MAX_ALPHA)), BROADCAST_ALPHA_LANE);
+      addColors = _mm256_blendv_epi8(
+          GetAvx2ColorsAlphaBlend(bgndColors, fgndColors), fgndColors, isOpaque);
+    }
+    const auto addedColors =
+        GetAvx2ColorsAdd(bgndColors, GetAvx2BrighterColors(brightness, addColors));
+    return GetAvx2WithNewAlpha(addedColors, fgndColors);
+  }
+}
+
+template<PixelBlendRowType BLEND_TYPE>
+GOOM_SIMD_TARGET("avx2")
+auto BlendAvx2PixelRow(const RowBlendParams& params) noexcept -> size_t
+{
+  static constexpr auto NUM_PIXELS = 2U;
+
+  const auto brightness = _mm256_set1_epi32(static_cast<int32_t>(params.fgndIntBuffIntensity));
+
+  auto* const bgndColors = params.bgndColors.data();
+  const auto numPixels   = params.bgndColors.size();
+
+  auto i = 0U;
+  for (; (i + NUM_PIXELS) <= numPixels; i += NUM_PIXELS)
+  {
+    const auto bgndColors2 = LoadAvx2Pixels(bgndColors + i, bgndColors + i + 1);
+    const auto fgndColors2 = LoadAvx2Pixels(params.fgndColors + (i * params.fgndStride),
+                                            params.fgndColors + ((i + 1) * params.fgndStride));
+
+    StoreAvx2Pixels(bgndColors + i,
+                    GetAvx2BlendedPixels<BLEND_TYPE>(bgndColors2, brightness, fgndColors2));
+  }
+
+  return i;
+}
+
+#endif
+
+template<PixelBlendRowType BLEND_TYPE>
+auto BlendPixelRow(const SimdLevel simdLevel, const RowBlendParams& params) noexcept -> void
+{
+  auto numDone = size_t{0U};
+
+#ifdef GOOM_HAS_X86_SIMD
+  switch (simdLevel)
+  {
+    case SimdLevel::AVX2:
+      numDone = BlendAvx2PixelRow<BLEND_TYPE>(params);
+      break;
+    case SimdLevel::SSE4_1:
+      numDone = BlendSse41PixelRow<BLEND_TYPE>(params);
+      break;
+    case SimdLevel::SCALAR:
+      break;
+  }
+#endif
+
+  BlendScalarPixelRow<BLEND_TYPE>(params, numDone);
+}
+
+auto BlendPixelRow(const SimdLevel simdLevel,
+                   const PixelBlendRowType blendType,
+                   const RowBlendParams& params) noexcept -> void
+{
+  Expects(IsSimdLevelSupported(simdLevel));
+
+  switch (blendType)
+  {
+    case PixelBlendRowType::COLOR_ADD:
+      BlendPixelRow<PixelBlendRowType::COLOR_ADD>(simdLevel, params);
+      break;
+    case PixelBlendRowType::DARKEN_ONLY:
+      BlendPixelRow<PixelBlendRowType::DARKEN_ONLY>(simdLevel, params);
+      break;
+    case PixelBlendRowType::LIGHTEN_ONLY:
+      BlendPixelRow<PixelBlendRowType::LIGHTEN_ONLY>(simdLevel, params);
+      break;
+    case PixelBlendRowType::COLOR_MULTIPLY:
+      BlendPixelRow<PixelBlendRowType::COLOR_MULTIPLY>(simdLevel, params);
+      break;
+    case PixelBlendRowType::COLOR_ALPHA:
+      BlendPixelRow<PixelBlendRowType::COLOR_ALPHA>(simdLevel, params);
+      break;
+    case PixelBlendRowType::COLOR_ALPHA_AND_ADD:
+      BlendPixelRow<PixelBlendRowType::COLOR_ALPHA_AND_ADD>(simdLevel, params);
+      break;
+  }
+}
+
+} // namespace
+
+auto BlendPixelRow(const PixelBlendRowType blendType,
+                   const uint32_t fgndIntBuffIntensity,
+                   const std::span<const Pixel> fgndColors,
+                   const std::span<Pixel> bgndColors) noexcept -> void
+{
+  BlendPixelRow(GetSimdLevel(), blendType, fgndIntBuffIntensity, fgndColors, bgndColors);
+}
+
+auto BlendPixelRow(const PixelBlendRowType blendType,
+                   const uint32_t fgndIntBuffIntensity,
+                   const Pixel& fgndColor,
+                   const std::span<Pixel> bgndColors) noexcept -> void
+{
+  BlendPixelRow(GetSimdLevel(), blendType, fgndIntBuffIntensity, fgndColor, bgndColors);
+}
+
+auto BlendPixelRow(const SimdLevel simdLevel,
+                   const PixelBlendRowType blendType,
+                   const uint32_t fgndIntBuffIntensity,
+                   const std::span<const Pixel> fgndColors,
+                   const std::span<Pixel> bgndColors) noexcept -> void
+{
+  Expects(fgndColors.size() >= bgndColors.size());
+
+  BlendPixelRow(simdLevel,
+                blendType,
+                {.fgndIntBuffIntensity = fgndIntBuffIntensity,
+                 .fgndColors           = fgndColors.data(),
+                 .fgndStride           = 1U,
+                 .bgndColors           = bgndColors});
+}
+
+auto BlendPixelRow(const SimdLevel simdLevel,
+                   const PixelBlendRowType blendType,
+                   const uint32_t fgndIntBuffIntensity,
+                   const Pixel& fgndColor,
+                   const std::span<Pixel> bgndColors) noexcept -> void
+{
+  BlendPixelRow(simdLevel,
+                blendType,
+                {.fgndIntBuffIntensity = fgndIntBuffIntensity,
+                 .fgndColors           = &fgndColor,
+                 .fgndStride           = 0U,
+                 .bgndColors           = bgndColors});
+}
+
+} // namespace GOOM::UTILS::GRAPHICS
@@ -3,13 +3,16 @@ module;
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <span>
 
 export module Goom.Utils.Graphics.PixelBlend;
 
 import Goom.Color.ColorMaps;
 import Goom.Color.ColorUtils;
+import Goom.Utils.CpuFeatures;
 import Goom.Utils.Graphics.PixelUtils;
 import Goom.Lib.GoomGraphic;
+import Goom.Lib.GoomTypes;
 
 export namespace GOOM::UTILS::GRAPHICS
 {
@@ -56,11 +59,90 @@ export namespace GOOM::UTILS::GRAPHICS
                                                       const Pixel& fgndColor,
                                                       PixelChannelType newAlpha) -> Pixel;
 
+// Whole row versions of the blends above. They give exactly the same pixels as the single
+// pixel blends, with the new alpha of each pixel being the alpha of its fgnd color, as the
+// goom draw classes use. The luma mix blend is float based, so it has no row version.
+enum class PixelBlendRowType : UnderlyingEnumType
+{
+  COLOR_ADD,
+  DARKEN_ONLY,
+  LIGHTEN_ONLY,
+  COLOR_MULTIPLY,
+  COLOR_ALPHA,
+  COLOR_ALPHA_AND_ADD,
+};
+
+// The single pixel blend of a row blend type, chosen at compile time.
+template<PixelBlendRowType BLEND_TYPE>
+[[nodiscard]] constexpr auto GetPixelBlend(const Pixel& bgndColor,
+                                           uint32_t fgndIntBuffIntensity,
+                                           const Pixel& fgndColor,
+                                           PixelChannelType newAlpha) -> Pixel;
+
+// Uses the best SIMD level available on this cpu.
+auto BlendPixelRow(PixelBlendRowType blendType,
+                   uint32_t fgndIntBuffIntensity,
+                   std::span<const Pixel> fgndColors,
+                   std::span<Pixel> bgndColors) noexcept -> void;
+auto BlendPixelRow(PixelBlendRowType blendType,
+                   uint32_t fgndIntBuffIntensity,
+                   const Pixel& fgndColor,
+                   std::span<Pixel> bgndColors) noexcept -> void;
+
+// Mainly for testing - 'simdLevel' must be supported by this cpu.
+auto BlendPixelRow(SimdLevel simdLevel,
+                   PixelBlendRowType blendType,
+                   uint32_t fgndIntBuffIntensity,
+                   std::span<const Pixel> fgndColors,
+                   std::span<Pixel> bgndColors) noexcept -> void;
+auto BlendPixelRow(SimdLevel simdLevel,
+                   PixelBlendRowType blendType,
+                   uint32_t fgndIntBuffIntensity,
+                   const Pixel& fgndColor,
+                   std::span<Pixel> bgndColors) noexcept -> void;
+
 } // namespace GOOM::UTILS::GRAPHICS
 
 namespace GOOM::UTILS::GRAPHICS
 {
 
+// Used by the darken only and multiply blends when either color is close to black.
+inline constexpr auto BLACK_BLEND_BRIGHTNESS = 2.0F;
+inline constexpr auto BLACK_BLEND_THRESHOLD  = 30U;
+
+template<PixelBlendRowType BLEND_TYPE>
+constexpr auto GetPixelBlend(const Pixel& bgndColor,
+                             const uint32_t fgndIntBuffIntensity,
+                             const Pixel& fgndColor,
+                             const PixelChannelType newAlpha) -> Pixel
+{
+  if constexpr (BLEND_TYPE == PixelBlendRowType::COLOR_ADD)
+  {
+    return GetColorAddPixelBlend(bgndColor, fgndIntBuffIntensity, fgndColor, newAlpha);
+  }
+  else if constexpr (BLEND_TYPE == PixelBlendRowType::DARKEN_ONLY)
+  {
+    return GetDarkenOnlyPixelBlend(bgndColor, fgndIntBuffIntensity, fgndColor, newAlpha);
+  }
+  else if constexpr (BLEND_TYPE == PixelBlendRowType::LIGHTEN_ONLY)
+  {
+    return GetLightenOnlyPixelBlend(bgndColor, fgndIntBuffIntensity, fgndColor, newAlpha);
+  }
+  else if constexpr (BLEND_TYPE == PixelBlendRowType::COLOR_MULTIPLY)
+  {
+    return GetColorMultiplyPixelBlend(bgndColor, fgndIntBuffIntensity, fgndColor, newAlpha);
+  }
+  else if constexpr (BLEND_TYPE == PixelBlendRowType::COLOR_ALPHA)
+  {
+    return GetColorAlphaNoAddBlend(bgndColor, fgndIntBuffIntensity, fgndColor, newAlpha);
+  }
+  else
+  {
+    static_assert(BLEND_TYPE == PixelBlendRowType::COLOR_ALPHA_AND_ADD);
+    return GetColorAlphaAndAddBlend(bgndColor, fgndIntBuffIntensity, fgndColor, newAlpha);
+  }
+}
+
 constexpr auto GetColorAddPixelBlend(const Pixel& bgndColor,
                                      const uint32_t fgndIntBuffIntensity,
                                      const Pixel& fgndColor,
@@ -75,17 +157,14 @@ constexpr auto GetColorMultiplyPixelBlend(const Pixel& bgndColor,
                                           const Pixel& fgndColor,
                                           const PixelChannelType newAlpha) -> Pixel
 {
-  constexpr auto BRIGHTNESS_INCREASE = 2.0F;
-  constexpr auto BLACK_THRESHOLD     = 30U;
-
-  if (COLOR::IsCloseToBlack(fgndColor, BLACK_THRESHOLD))
+  if (COLOR::IsCloseToBlack(fgndColor, BLACK_BLEND_THRESHOLD))
   {
-    return COLOR::GetBrighterColor(BRIGHTNESS_INCREASE, bgndColor);
+    return COLOR::GetBrighterColor(BLACK_BLEND_BRIGHTNESS, bgndColor);
   }
 
-  if (COLOR::IsCloseToBlack(bgndColor, BLACK_THRESHOLD))
+  if (COLOR::IsCloseToBlack(bgndColor, BLACK_BLEND_THRESHOLD))
   {
-    return COLOR::GetBrighterColor(BRIGHTNESS_INCREASE, fgndColor);
+    return COLOR::GetBrighterColor(BLACK_BLEND_BRIGHTNESS, fgndColor);
   }
 
   return GetColorAdd(GetColorMultiply(bgndColor, fgndColor, newAlpha),
@@ -98,17 +177,14 @@ constexpr auto GetDarkenOnlyPixelBlend(const Pixel& bgndColor,
                                        const Pixel& fgndColor,
                                        const PixelChannelType newAlpha) -> Pixel
 {
-  constexpr auto BRIGHTNESS_INCREASE = 2.0F;
-  constexpr auto BLACK_THRESHOLD     = 30U;
-
-  if (COLOR::IsCloseToBlack(fgndColor, BLACK_THRESHOLD))
+  if (COLOR::IsCloseToBlack(fgndColor, BLACK_BLEND_THRESHOLD))
   {
-    return COLOR::GetBrighterColor(BRIGHTNESS_INCREASE, bgndColor);
+    return COLOR::GetBrighterColor(BLACK_BLEND_BRIGHTNESS, bgndColor);
   }
 
-  if (COLOR::IsCloseToBlack(bgndColor, BLACK_THRESHOLD))
+  if (COLOR::IsCloseToBlack(bgndColor, BLACK_BLEND_THRESHOLD))
   {
-    return COLOR::GetBrighterColor(BRIGHTNESS_INCREASE, fgndColor);
+    return COLOR::GetBrighterColor(BLACK_BLEND_BRIGHTNESS, fgndColor);
   }
 
   return GetColorMin(
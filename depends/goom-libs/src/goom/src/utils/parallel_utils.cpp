@@ -0,0 +1,69 @@
+module;
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+module Goom.Utils.Parallel;
+
+namespace GOOM::UTILS
+{
+
+namespace
+{
+
+auto GetSharedConfigMutex() noexcept -> std::mutex&
+{
+  static auto s_mutex = std::mutex{};
+  return s_mutex;
+}
+
+auto GetSharedConfig() noexcept -> SharedThreadPoolConfig&
+{
+  static auto s_config = SharedThreadPoolConfig{};
+  return s_config;
+}
+
+auto MakeSharedThreadPool() noexcept -> ThreadPool
+{
+  const auto lock = std::scoped_lock{GetSharedConfigMutex()};
+
+  const auto& config = GetSharedConfig();
+
+  const auto numThreads =
+      config.maxNumThreads <= 0
+          ? GetNumAvailablePoolThreads()
+          : std::min(config.maxNumThreads,
+                     std::max(1, static_cast<int32_t>(std::thread::hardware_concurrency())));
+
+  return ThreadPool{static_cast<size_t>(numThreads), config.cpuAffinity};
+}
+
+} // namespace
+
+auto GetNumAvailablePoolThreads() noexcept -> int32_t
+{
+  // Leave room for the render thread and the transform buffer producer thread.
+  static constexpr auto MIN_NUM_THREADS  = 2;
+  static constexpr auto NUM_FREE_THREADS = 2;
+
+  const auto numHardwareThreads = static_cast<int32_t>(std::thread::hardware_concurrency());
+
+  return std::max(MIN_NUM_THREADS, numHardwareThreads - NUM_FREE_THREADS);
+}
+
+auto SetSharedThreadPoolConfig(const SharedThreadPoolConfig& config) noexcept -> void
+{
+  const auto lock   = std::scoped_lock{GetSharedConfigMutex()};
+  GetSharedConfig() = config;
+}
+
+auto GetSharedThreadPool() noexcept -> ThreadPool&
+{
+  static auto s_sharedThreadPool = MakeSharedThreadPool();
+  return s_sharedThreadPool;
+}
+
+} // namespace GOOM::UTILS
@@ -1,11 +1,9 @@
 module;
 
-// clang-format off
-// NOLINTBEGIN: Not my code
-
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
-#include <future>
+#include <memory>
 #include <thread>
 #include <vector>
 
@@ -17,14 +15,29 @@ import :ThreadPool;
 export namespace GOOM::UTILS
 {
 
-auto GetNumAvailablePoolThreads() noexcept -> int32_t;
+[[nodiscard]] auto GetNumAvailablePoolThreads() noexcept -> int32_t;
+
+struct SharedThreadPoolConfig
+{
+  // Hard cap on the number of shared pool threads. If <= 0, use GetNumAvailablePoolThreads().
+  int32_t maxNumThreads = 0;
+  // If not empty, pool thread i is pinned to cpu 'cpuAffinity[i % size]'.
+  std::vector<uint32_t> cpuAffinity{};
+};
+// Has no effect once the shared pool has been created.
+auto SetSharedThreadPoolConfig(const SharedThreadPoolConfig& config) noexcept -> void;
+// The one pool shared by all 'Parallel' objects that use a task priority.
+[[nodiscard]] auto GetSharedThreadPool() noexcept -> ThreadPool&;
 
 class Parallel
 {
 public:
-  // numPoolThreads > 0:  use this number of threads in the pool
-  // numPoolThreads <= 0: use (max cores - numPoolThreads) in the pool
-  explicit Parallel(int32_t numPoolThreads = 0) noexcept;
+  // Use the shared pool.
+  explicit Parallel(TaskPriority taskPriority) noexcept;
+  // Use a private pool:
+  //   numPoolThreads > 0:  use this number of threads in the pool
+  //   numPoolThreads <= 0: use (max cores - numPoolThreads) in the pool
+  explicit Parallel(int32_t numPoolThreads) noexcept;
 
   auto GetNumThreadsUsed() const noexcept -> size_t;
   auto GetThreadIds() const noexcept -> std::vector<std::thread::id>;
@@ -33,8 +46,10 @@ public:
   auto ForLoop(size_t numIters, Callable loopFunc) noexcept -> void;
 
 private:
-  ThreadPool m_threadPool;
-  bool m_forLoopInUse = false;
+  std::unique_ptr<ThreadPool> m_privateThreadPool;
+  ThreadPool* m_threadPool;
+  TaskPriority m_taskPriority = TaskPriority::FRAME_CRITICAL;
+  bool m_forLoopInUse         = false;
 };
 
 } // namespace GOOM::UTILS
@@ -42,24 +57,30 @@ private:
 namespace GOOM::UTILS
 {
 
+inline Parallel::Parallel(const TaskPriority taskPriority) noexcept
+  : m_threadPool{&GetSharedThreadPool()}, m_taskPriority{taskPriority}
+{
+}
+
 inline Parallel::Parallel(const int32_t numPoolThreads) noexcept
-  : m_threadPool{
+  : m_privateThreadPool{std::make_unique<ThreadPool>(
         (numPoolThreads <= 0)
             ? static_cast<size_t>(std::max(
                   1, static_cast<int32_t>(std::thread::hardware_concurrency()) + numPoolThreads))
             : static_cast<size_t>(std::min(
-                  numPoolThreads, static_cast<int32_t>(std::thread::hardware_concurrency())))}
+                  numPoolThreads, static_cast<int32_t>(std::thread::hardware_concurrency()))))},
+    m_threadPool{m_privateThreadPool.get()}
 {
 }
 
 inline auto Parallel::GetNumThreadsUsed() const noexcept -> size_t
 {
-  return m_threadPool.GetNumWorkers();
+  return m_threadPool->GetNumWorkers();
 }
 
 inline auto Parallel::GetThreadIds() const noexcept -> std::vector<std::thread::id>
 {
-  return m_threadPool.GetThreadIds();
+  return m_threadPool->GetThreadIds();
 }
 
 template<typename Callable>
@@ -69,11 +90,10 @@ auto Parallel::ForLoop(const size_t numIters, const Callable loopFunc) noexcept
   Expects(not m_forLoopInUse);
   m_forLoopInUse = true;
 
-  const size_t numThreads = std::min(numIters, m_threadPool.GetNumWorkers());
-
-  if (1 == numThreads)
+  // A loop inside a pool task can't wait on the pool, so it just runs inline.
+  if ((1 == numIters) or ThreadPool::IsPoolWorkerThread())
   {
-    for (size_t i = 0; i < numIters; ++i)
+    for (auto i = size_t{0}; i < numIters; ++i)
     {
       loopFunc(i);
     }
@@ -81,53 +101,24 @@ auto Parallel::ForLoop(const size_t numIters, const Callable loopFunc) noexcept
     return;
   }
 
-  const size_t chunkSize = numIters / numThreads; // >= 1
-  const size_t numLeftoverIters = numIters - (numThreads * chunkSize);
+  // Small chunks so slow iterations can be balanced out by stealing, but big enough
+  // that the atomic traffic per chunk doesn't matter.
+  static constexpr auto NUM_CHUNKS_PER_WORKER = 8U;
 
-  const auto loopContents =
-      [&chunkSize, &numThreads, &numLeftoverIters, &loopFunc](const uint32_t threadIndex)
-  {
-    const size_t inclusiveStartIndex = threadIndex * chunkSize;
-    const size_t exclusiveEndIndex =
-        inclusiveStartIndex + chunkSize + (threadIndex < (numThreads - 1) ? 0 : numLeftoverIters);
+  // The calling thread takes chunks too.
+  const auto numWorkers = m_threadPool->GetNumWorkers() + 1;
+  const auto chunkSize  = std::max(size_t{1}, numIters / (NUM_CHUNKS_PER_WORKER * numWorkers));
 
-    for (size_t k = inclusiveStartIndex; k < exclusiveEndIndex; ++k)
+  const auto loopRange = [&loopFunc](const size_t begin, const size_t end)
+  {
+    for (auto i = begin; i < end; ++i)
     {
-      loopFunc(k);
+      loopFunc(i);
     }
   };
-
-  std::vector<std::future<void>> futures{};
-  for (uint32_t j = 0; j < numThreads; ++j)
-  {
-    futures.emplace_back(m_threadPool.ScheduleAndGetFuture(loopContents, j));
-  }
-
-  for (const auto& future : futures)
-  {
-    future.wait();
-  }
+  m_threadPool->RunRange(m_taskPriority, numIters, chunkSize, RangeFunc{loopRange});
 
   m_forLoopInUse = false;
 }
 
-inline auto GetNumAvailablePoolThreads() noexcept -> int32_t
-{
-  static constexpr auto DESIRED_NUM_THREADS = 4;
-  static constexpr auto MIN_NUM_THREADS     = 2;
-  static constexpr auto NUM_FREE_THREADS    = 2;
-
-  const auto numHardwareThreads = static_cast<int32_t>(std::thread::hardware_concurrency());
-
-  if (DESIRED_NUM_THREADS <= (numHardwareThreads - NUM_FREE_THREADS))
-  {
-    return DESIRED_NUM_THREADS;
-  }
-
-  return std::max(MIN_NUM_THREADS, numHardwareThreads - NUM_FREE_THREADS);
-}
-
 } // namespace GOOM::UTILS
-
-// NOLINTEND
-// clang-format on
@@ -0,0 +1,217 @@
+module;
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+export module Goom.Utils.StageTimings;
+
+import Goom.Lib.AssertUtils;
+
+export namespace GOOM::UTILS
+{
+
+// Wall times for a set of named stages. As well as running totals, the most recent times
+// of each stage are kept in a ring buffer, so percentiles reflect what's happening now.
+// Different stages can have times added on different threads at the same time, but each
+// stage can only have times added on one thread at a time. All the stages must be added
+// before any times are, and times must not be queried while they're being added.
+// Debug builds assert the one thread per stage and the stages before times rules.
+class StageTimings
+{
+public:
+  static constexpr auto NUM_RECENT_TIMES = 512U;
+
+  StageTimings() noexcept = default;
+  explicit StageTimings(const std::vector<std::string>& stageNames);
+
+  // Returns the index of the new stage.
+  auto AddStage(const std::string& stageName) -> uint32_t;
+
+  [[nodiscard]] auto GetNumStages() const noexcept -> uint32_t;
+  [[nodiscard]] auto GetStageName(uint32_t stage) const noexcept -> const std::string&;
+  [[nodiscard]] auto GetNumTimes(uint32_t stage) const noexcept -> uint64_t;
+  [[nodiscard]] auto GetTotalTimeInNs(uint32_t stage) const noexcept -> uint64_t;
+  [[nodiscard]] auto GetMaxTimeInNs(uint32_t stage) const noexcept -> uint64_t;
+  [[nodiscard]] auto GetLastTimeInNs(uint32_t stage) const noexcept -> uint64_t;
+  // 'percentile' is in [0, 100] and is over the last NUM_RECENT_TIMES times of the stage.
+  [[nodiscard]] auto GetRecentPercentileTimeInNs(uint32_t stage, float percentile) const noexcept
+      -> uint64_t;
+
+  auto AddTime(uint32_t stage, uint64_t timeInNs) noexcept -> void;
+  auto Reset() noexcept -> void;
+
+private:
+  struct StageTimes
+  {
+    std::string name;
+    uint64_t numTimes      = 0U;
+    uint64_t totalTimeInNs = 0U;
+    uint64_t maxTimeInNs   = 0U;
+    std::vector<uint64_t> recentTimesInNs;
+  };
+  std::vector<StageTimes> m_stageTimes;
+  std::vector<std::atomic<bool>> m_stageTimeBeingAdded;
+  [[nodiscard]] auto GetStageTimes(uint32_t stage) const noexcept -> const StageTimes&;
+  mutable std::vector<uint64_t> m_sortedTimesInNs;
+};
+
+// Adds the time from construction to destruction to a stage.
+class ScopedStageTimer
+{
+public:
+  ScopedStageTimer(StageTimings& stageTimings, uint32_t stage) noexcept;
+  ScopedStageTimer(const ScopedStageTimer&)     = delete;
+  ScopedStageTimer(ScopedStageTimer&&) noexcept = delete;
+  ~ScopedStageTimer() noexcept;
+
+  auto operator=(const ScopedStageTimer&) -> ScopedStageTimer&     = delete;
+  auto operator=(ScopedStageTimer&&) noexcept -> ScopedStageTimer& = delete;
+
+private:
+  StageTimings* m_stageTimings;
+  uint32_t m_stage;
+  std::chrono::steady_clock::time_point m_startTime = std::chrono::steady_clock::now();
+};
+
+} // namespace GOOM::UTILS
+
+namespace GOOM::UTILS
+{
+
+inline StageTimings::StageTimings(const std::vector<std::string>& stageNames)
+{
+  m_stageTimes.reserve(stageNames.size());
+  for (const auto& stageName : stageNames)
+  {
+    AddStage(stageName);
+  }
+}
+
+inline auto StageTimings::AddStage(const std::string& stageName) -> uint32_t
+{
+  Expects(std::ranges::none_of(m_stageTimes, &StageTimes::numTimes),
+          "Stages must be added before any times.");
+
+  m_stageTimes.emplace_back(StageTimes{
+      .name = stageName, .recentTimesInNs = std::vector<uint64_t>(NUM_RECENT_TIMES)});
+  m_stageTimeBeingAdded = std::vector<std::atomic<bool>>(m_stageTimes.size());
+  return static_cast<uint32_t>(m_stageTimes.size() - 1);
+}
+
+inline auto StageTimings::GetNumStages() const noexcept -> uint32_t
+{
+  return static_cast<uint32_t>(m_stageTimes.size());
+}
+
+inline auto StageTimings::GetStageTimes(const uint32_t stage) const noexcept -> const StageTimes&
+{
+  Expects(stage < m_stageTimes.size());
+  return m_stageTimes[stage];
+}
+
+inline auto StageTimings::GetStageName(const uint32_t stage) const noexcept -> const std::string&
+{
+  return GetStageTimes(stage).name;
+}
+
+inline auto StageTimings::GetNumTimes(const uint32_t stage) const noexcept -> uint64_t
+{
+  return GetStageTimes(stage).numTimes;
+}
+
+inline auto StageTimings::GetTotalTimeInNs(const uint32_t stage) const noexcept -> uint64_t
+{
+  return GetStageTimes(stage).totalTimeInNs;
+}
+
+inline auto StageTimings::GetMaxTimeInNs(const uint32_t stage) const noexcept -> uint64_t
+{
+  return GetStageTimes(stage).maxTimeInNs;
+}
+
+inline auto StageTimings::GetLastTimeInNs(const uint32_t stage) const noexcept -> uint64_t
+{
+  const auto& stageTimes = GetStageTimes(stage);
+  if (0U == stageTimes.numTimes)
+  {
+    return 0U;
+  }
+  return stageTimes.recentTimesInNs[(stageTimes.numTimes - 1) % NUM_RECENT_TIMES];
+}
+
+inline auto StageTimings::GetRecentPercentileTimeInNs(const uint32_t stage,
+                                                      const float percentile) const noexcept
+    -> uint64_t
+{
+  Expects((0.0F <= percentile) and (percentile <= 100.0F));
+
+  const auto& stageTimes = GetStageTimes(stage);
+  const auto numRecent   = std::min(stageTimes.numTimes, static_cast<uint64_t>(NUM_RECENT_TIMES));
+  if (0U == numRecent)
+  {
+    return 0U;
+  }
+
+  m_sortedTimesInNs.assign(stageTimes.recentTimesInNs.cbegin(),
+                           stageTimes.recentTimesInNs.cbegin() +
+                               static_cast<std::ptrdiff_t>(numRecent));
+  const auto rank = static_cast<std::ptrdiff_t>(
+      std::round((percentile / 100.0F) * static_cast<float>(numRecent - 1)));
+  std::ranges::nth_element(m_sortedTimesInNs, m_sortedTimesInNs.begin() + rank);
+
+  return m_sortedTimesInNs[static_cast<size_t>(rank)];
+}
+
+inline auto StageTimings::AddTime(const uint32_t stage, const uint64_t timeInNs) noexcept -> void
+{
+  Expects(stage < m_stageTimes.size());
+  if constexpr (ASSERTS_ENABLED)
+  {
+    Expects(not m_stageTimeBeingAdded[stage].exchange(true, std::memory_order_acquire),
+            "A stage can only have times added on one thread at a time.");
+  }
+
+  auto& stageTimes = m_stageTimes[stage];
+  stageTimes.recentTimesInNs[stageTimes.numTimes % NUM_RECENT_TIMES] = timeInNs;
+  ++stageTimes.numTimes;
+  stageTimes.totalTimeInNs += timeInNs;
+  stageTimes.maxTimeInNs = std::max(stageTimes.maxTimeInNs, timeInNs);
+
+  if constexpr (ASSERTS_ENABLED)
+  {
+    m_stageTimeBeingAdded[stage].store(false, std::memory_order_release);
+  }
+}
+
+inline auto StageTimings::Reset() noexcept -> void
+{
+  for (auto& stageTimes : m_stageTimes)
+  {
+    stageTimes.numTimes      = 0U;
+    stageTimes.totalTimeInNs = 0U;
+    stageTimes.maxTimeInNs   = 0U;
+  }
+}
+
+inline ScopedStageTimer::ScopedStageTimer(StageTimings& stageTimings,
+                                          const uint32_t stage) noexcept
+  : m_stageTimings{&stageTimings}, m_stage{stage}
+{
+}
+
+inline ScopedStageTimer::~ScopedStageTimer() noexcept
+{
+  const auto elapsed = std::chrono::steady_clock::now() - m_startTime;
+  m_stageTimings->AddTime(
+      m_stage,
+      static_cast<uint64_t>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+}
+
+} // namespace GOOM::UTILS
@@ -0,0 +1,163 @@
+module;
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+module Goom.Utils.Text.CachedText;
+
+import Goom.Draw.GoomDrawBase;
+import Goom.Draw.ShaperDrawers.TextDrawer;
+import Goom.Utils.Graphics.PixelBlend;
+import Goom.Utils.Math.Misc;
+import Goom.Lib.GoomGraphic;
+import Goom.Lib.Point2d;
+
+namespace GOOM::UTILS::TEXT
+{
+
+using DRAW::IGoomDraw;
+using DRAW::SHAPE_DRAWERS::TextDrawer;
+using GRAPHICS::GetColorAlphaBlend;
+using MATH::I_HALF;
+
+CachedText::CachedText(IGoomDraw& draw, TextDrawer& textDrawer) noexcept
+  : m_draw{&draw}, m_textDrawer{&textDrawer}
+{
+}
+
+auto CachedText::SetText(const std::string& text) -> void
+{
+  if (IsLaidOut(text))
+  {
+    return;
+  }
+
+  m_text         = text;
+  m_fontFile     = m_textDrawer->GetFontFile();
+  m_fontSize     = m_textDrawer->GetFontSize();
+  m_outlineWidth = m_textDrawer->GetOutlineWidth();
+
+  m_textDrawer->SetText(m_text);
+  m_textDrawer->Prepare();
+  m_textDrawer->GetPreparedText(m_preparedText);
+
+  SortSpansIntoRows();
+}
+
+inline auto CachedText::IsLaidOut(const std::string& text) const noexcept -> bool
+{
+  return (text == m_text) and (m_textDrawer->GetFontSize() == m_fontSize) and
+         (m_textDrawer->GetOutlineWidth() == m_outlineWidth) and
+         (m_textDrawer->GetFontFile() == m_fontFile);
+}
+
+auto CachedText::SortSpansIntoRows() -> void
+{
+  auto& spans = m_preparedText.spans;
+  std::ranges::stable_sort(spans, {}, [](const auto& span) { return span.start.y; });
+
+  m_rowStarts.clear();
+  for (auto i = 0U; i < spans.size(); ++i)
+  {
+    if ((0U == i) or (spans[i].start.y != spans[i - 1].start.y))
+    {
+      m_rowStarts.emplace_back(i);
+    }
+  }
+  m_rowStarts.emplace_back(spans.size());
+}
+
+auto CachedText::Draw(const Point2dInt& pen,
+                      const TextDrawer::FontColorFunc& getFontColor,
+                      const TextDrawer::FontColorFunc& getOutlineFontColor) -> void
+{
+  if (m_preparedText.spans.empty())
+  {
+    return;
+  }
+
+  const auto charSpacingAdvance = m_textDrawer->GetCharSpacingAdvance();
+  const auto textPen = Point2dInt{.x = GetStartXPen(pen.x, charSpacingAdvance), .y = pen.y};
+
+  const auto drawRow =
+      [this, &textPen, &charSpacingAdvance, &getFontColor, &getOutlineFontColor](const size_t row)
+  {
+    for (auto i = m_rowStarts[row]; i < m_rowStarts[row + 1]; ++i)
+    {
+      const auto& span     = m_preparedText.spans[i];
+      const auto& getColor = span.isOutline ? getOutlineFontColor : getFontColor;
+      DrawSpan(span, textPen, charSpacingAdvance, getColor);
+    }
+  };
+
+  const auto numRows                          = m_rowStarts.size() - 1;
+  static constexpr auto MIN_PARALLEL_NUM_ROWS = 20U;
+  if (m_useParallelRender and (numRows >= MIN_PARALLEL_NUM_ROWS))
+  {
+    m_parallel.ForLoop(numRows, drawRow);
+  }
+  else
+  {
+    for (auto row = 0U; row < numRows; ++row)
+    {
+      drawRow(row);
+    }
+  }
+}
+
+// Same as the text drawer's alignment, but with the current char spacing.
+inline auto CachedText::GetStartXPen(const int32_t xPen,
+                                     const int32_t charSpacingAdvance) const noexcept -> int32_t
+{
+  const auto textWidth = m_preparedText.width +
+                         (static_cast<int32_t>(m_preparedText.numChars) * charSpacingAdvance);
+
+  switch (m_textDrawer->GetAlignment())
+  {
+    case TextDrawer::TextAlignment::LEFT:
+      return xPen;
+    case TextDrawer::TextAlignment::CENTER:
+      return xPen - (I_HALF * textWidth);
+    case TextDrawer::TextAlignment::RIGHT:
+      return xPen - textWidth;
+  }
+  return xPen;
+}
+
+auto CachedText::DrawSpan(const TextDrawer::TextSpan& span,
+                          const Point2dInt& textPen,
+                          const int32_t charSpacingAdvance,
+                          const TextDrawer::FontColorFunc& getColor) noexcept -> void
+{
+  const auto yPos = textPen.y + span.start.y;
+  if ((yPos < 0) or (yPos >= m_draw->GetDimensions().GetIntHeight()))
+  {
+    return;
+  }
+
+  const auto xPos0 = textPen.x + span.start.x +
+                     (static_cast<int32_t>(span.textIndexOfChar) * charSpacingAdvance);
+  for (auto width = 0; width < span.width; ++width)
+  {
+    const auto xPos = xPos0 + width;
+    if ((xPos < 0) or (xPos >= m_draw->GetDimensions().GetIntWidth()))
+    {
+      continue;
+    }
+
+    const auto charPoint = Point2dInt{.x = span.charPoint.x + width, .y = span.charPoint.y};
+    const auto color     = getColor(span.textIndexOfChar, charPoint, span.charDimensions);
+    const auto fgndColor = Pixel{
+        {.red = color.R(), .green = color.G(), .blue = color.B(), .alpha = span.coverage}
+    };
+    const auto bgndColor = m_draw->GetPixel({.x = xPos, .y = yPos});
+
+    const auto blendedColor = GetColorAlphaBlend(bgndColor, fgndColor, MAX_ALPHA);
+    m_draw->DrawPixelsUnblended({.x = xPos, .y = yPos}, {blendedColor, blendedColor});
+  }
+}
+
+} // namespace GOOM::UTILS::TEXT
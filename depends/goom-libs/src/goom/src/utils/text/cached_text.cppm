@@ -0,0 +1,73 @@
+module;
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+export module Goom.Utils.Text.CachedText;
+
+import Goom.Draw.GoomDrawBase;
+import Goom.Draw.ShaperDrawers.TextDrawer;
+import Goom.Utils.Parallel;
+import Goom.Lib.Point2d;
+
+export namespace GOOM::UTILS::TEXT
+{
+
+// Lays out and rasterizes a string once, with a text drawer, then keeps the spans so the
+// string can be drawn again and again at different positions, with different char
+// spacings and with different colors, without going back to the text drawer. The text is
+// only laid out again if it, or the text drawer's font, font size or outline width,
+// changes.
+class CachedText
+{
+public:
+  CachedText(DRAW::IGoomDraw& draw, DRAW::SHAPE_DRAWERS::TextDrawer& textDrawer) noexcept;
+
+  auto SetParallelRender(bool val) noexcept -> void;
+
+  auto SetText(const std::string& text) -> void;
+
+  // Uses the text drawer's current alignment and char spacing.
+  auto Draw(const Point2dInt& pen,
+            const DRAW::SHAPE_DRAWERS::TextDrawer::FontColorFunc& getFontColor,
+            const DRAW::SHAPE_DRAWERS::TextDrawer::FontColorFunc& getOutlineFontColor) -> void;
+
+private:
+  DRAW::IGoomDraw* m_draw;
+  DRAW::SHAPE_DRAWERS::TextDrawer* m_textDrawer;
+  UTILS::Parallel m_parallel{UTILS::TaskPriority::FRAME_CRITICAL};
+  bool m_useParallelRender = true;
+
+  std::string m_text;
+  std::string m_fontFile;
+  int32_t m_fontSize   = 0;
+  float m_outlineWidth = 0.0F;
+  [[nodiscard]] auto IsLaidOut(const std::string& text) const noexcept -> bool;
+
+  // The spans are sorted into rows, keeping their drawing order within a row, so the rows
+  // can be drawn in parallel.
+  DRAW::SHAPE_DRAWERS::TextDrawer::PreparedText m_preparedText{};
+  std::vector<size_t> m_rowStarts;
+  auto SortSpansIntoRows() -> void;
+
+  [[nodiscard]] auto GetStartXPen(int32_t xPen, int32_t charSpacingAdvance) const noexcept
+      -> int32_t;
+  auto DrawSpan(const DRAW::SHAPE_DRAWERS::TextDrawer::TextSpan& span,
+                const Point2dInt& textPen,
+                int32_t charSpacingAdvance,
+                const DRAW::SHAPE_DRAWERS::TextDrawer::FontColorFunc& getColor) noexcept -> void;
+};
+
+} // namespace GOOM::UTILS::TEXT
+
+namespace GOOM::UTILS::TEXT
+{
+
+inline auto CachedText::SetParallelRender(const bool val) noexcept -> void
+{
+  m_useParallelRender = val;
+}
+
+} // namespace GOOM::UTILS::TEXT
@@ -1,280 +1,448 @@
 module;
 
-#include <condition_variable>
-#include <functional>
-#include <future>
-#include <memory>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <mutex>
-#include <queue>
 #include <thread>
-#include <utility>
 #include <vector>
 
-// clang-format off
-// NOLINTBEGIN: Not my code
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 export module Goom.Utils.Parallel:ThreadPool;
 
+import Goom.Utils.EnumUtils;
 import Goom.Lib.AssertUtils;
+import Goom.Lib.GoomTypes;
 
 export namespace GOOM::UTILS
 {
 
-#define INVOKE_MACRO(CALLABLE, ARGS_TYPE, ARGS) \
-  std::invoke(CALLABLE, std::forward<ARGS_TYPE>(ARGS)...)
+// Workers always prefer frame critical work. Background work is only picked up
+// when there is no frame critical work left, and is checked again after every chunk.
+enum class TaskPriority : UnderlyingEnumType
+{
+  FRAME_CRITICAL,
+  BACKGROUND,
+};
+
+// A non-owning reference to a callable taking an iteration range [begin, end).
+// Unlike std::function, it never allocates.
+class RangeFunc
+{
+public:
+  template<typename Callable>
+  explicit RangeFunc(const Callable& callable) noexcept;
+
+  auto operator()(size_t begin, size_t end) const noexcept -> void;
 
+private:
+  using InvokeFunc = void (*)(const void* callable, size_t begin, size_t end) noexcept;
+  const void* m_callable;
+  InvokeFunc m_invoke;
+};
+
+// Workers share out the iterations of a loop by work stealing. Each worker starts with
+// an equal slice of the iterations and takes small chunks from the front of its slice.
+// A worker whose slice runs dry steals the back half of another worker's slice, so
+// iterations with very uneven costs still keep all the workers busy. Slices are single
+// atomic words - there are no queues or allocations per loop.
+//
+// The thread calling 'RunRange' has a slice too and takes and steals chunks just like a
+// worker. It only waits once there is nothing left to take, for the chunks still running.
+//
+// There is one loop slot per task priority, so a frame critical loop and a background
+// loop can run at the same time from different threads.
 class ThreadPool
 {
 public:
-  explicit ThreadPool(size_t numWorkers) noexcept;
-  ThreadPool(const ThreadPool&) = delete;
+  static constexpr auto MAX_NUM_ITERS = size_t{std::numeric_limits<uint32_t>::max()};
+
+  // If 'cpuAffinity' is not empty, worker i is pinned to cpu 'cpuAffinity[i % size]'.
+  explicit ThreadPool(size_t numWorkers, const std::vector<uint32_t>& cpuAffinity = {}) noexcept;
+  ThreadPool(const ThreadPool&)     = delete;
   ThreadPool(ThreadPool&&) noexcept = delete;
-  // The destructor blocks until all outstanding work is complete.
+  // The destructor waits for the workers to finish.
   ~ThreadPool() noexcept;
-  auto operator=(const ThreadPool&) -> ThreadPool& = delete;
+  auto operator=(const ThreadPool&) -> ThreadPool&     = delete;
   auto operator=(ThreadPool&&) noexcept -> ThreadPool& = delete;
 
-  //   Given a callable 'func' that returns a value of type 'RetT', this
-  //   function returns a std::future<RetT> that can be used to access
-  //   func's results.
-  template<typename FuncT, typename... ArgsT>
-  auto ScheduleAndGetFuture(FuncT&& func, ArgsT&&... args)
-      -> std::future<decltype(INVOKE_MACRO(func, ArgsT, args))>;
+  [[nodiscard]] auto GetNumWorkers() const noexcept -> size_t;
+  [[nodiscard]] auto GetThreadIds() const noexcept -> std::vector<std::thread::id>;
+  [[nodiscard]] static auto IsPoolWorkerThread() noexcept -> bool;
 
-  // Wait for all outstanding work to be completed.
-  void Wait();
-
-  auto GetNumWorkers() const -> size_t;
-  auto GetThreadIds() const -> std::vector<std::thread::id>;
-
-  auto GetOutstandingWorkSize() const -> size_t;
-  void SetWorkDoneCallback(std::function<void(int)> func);
+  // Blocks until 'rangeFunc' has been called over all of [0, numIters), in chunks of
+  // at most 'chunkSize' iterations, on the pool workers and the calling thread. Callers
+  // with the same priority take turns. Must not be called from a pool worker.
+  auto RunRange(TaskPriority priority,
+                size_t numIters,
+                size_t chunkSize,
+                const RangeFunc& rangeFunc) noexcept -> void;
 
 private:
-  size_t m_numWorkers = 0;
-
-  // The destructor sets 'finished' to true and then notifies all workers.
-  // 'finished' causes each thread to break out of their work loop.
-  bool m_finished = false;
-
-  // Work queue. Guarded by 'm_mutex'.
-  mutable std::mutex m_mutex{};
-  struct WorkItem
+  struct Chunk
   {
-    std::function<void(void)> func{};
+    size_t begin;
+    size_t end;
   };
-  std::queue<WorkItem> m_workQueue{};
-
-  std::vector<std::thread> m_workers{};
-  std::condition_variable m_newWorkCondition{};
-  std::condition_variable m_workDoneCondition{};
-
-  // Whenever a work item is complete, we call this callback. If this is empty,
-  // nothing is done.
-  std::function<void(int)> m_workDoneCallback{};
+  static constexpr auto CACHE_LINE_SIZE = 64U;
+  struct alignas(CACHE_LINE_SIZE) WorkerSlice
+  {
+    // Packed as (begin << 32) | end so owner and thieves can update it with one CAS.
+    std::atomic<uint64_t> range{0U};
+  };
+  static constexpr auto NUM_END_BITS = 32U;
+  static constexpr auto END_MASK     = uint64_t{std::numeric_limits<uint32_t>::max()};
+  [[nodiscard]] static constexpr auto PackRange(size_t begin, size_t end) noexcept -> uint64_t;
+  [[nodiscard]] static constexpr auto UnpackRange(uint64_t range) noexcept -> Chunk;
 
-  void ThreadLoop();
+  struct LoopSlot
+  {
+    explicit LoopSlot(size_t numWorkers) noexcept;
+    std::mutex runMutex;
+    const RangeFunc* rangeFunc = nullptr;
+    std::atomic<size_t> chunkSize{1U};
+    std::atomic<size_t> numItersLeft{0U};
+    // One per worker, and the last one is for the thread running the loop.
+    std::vector<WorkerSlice> workerSlices;
+  };
+  std::array<LoopSlot, NUM<TaskPriority>> m_loopSlots;
+  std::vector<std::thread> m_workers;
+
+  std::atomic<uint64_t> m_workSignal{0U};
+  std::atomic<bool> m_finished{false};
+
+  static auto SetCpuAffinity(std::thread& thread, uint32_t cpu) noexcept -> void;
+  auto ThreadLoop(size_t workerIndex) noexcept -> void;
+  [[nodiscard]] auto DoNextChunk(size_t workerIndex) noexcept -> bool;
+  [[nodiscard]] static auto TakeChunk(LoopSlot& loopSlot, size_t workerIndex) noexcept -> Chunk;
+  static auto RunChunk(LoopSlot& loopSlot, const Chunk& chunk) noexcept -> void;
+  [[nodiscard]] static auto PopChunk(LoopSlot& loopSlot, size_t workerIndex) noexcept -> Chunk;
+  [[nodiscard]] static auto StealChunk(LoopSlot& loopSlot, size_t thiefIndex) noexcept -> Chunk;
 };
 
 } // namespace GOOM::UTILS
 
-//module : private;
-
 namespace GOOM::UTILS
 {
 
-namespace THREAD_POOL_IMPL
+template<typename Callable>
+RangeFunc::RangeFunc(const Callable& callable) noexcept
+  : m_callable{&callable},
+    m_invoke{[](const void* const func, const size_t begin, const size_t end) noexcept
+             { (*static_cast<const Callable*>(func))(begin, end); }}
 {
+}
 
-// This helper class simply returns a std::function that executes:
-//
-//   ReturnT x = func();
-//   promise->set_value(x);
-//
-// However, this is tricky in the case where T == void. The code above won't
-// compile if ReturnT == void, and neither will
-//
-//   promise->set_value(func());
-//
-// To workaround this, we use a template specialization for the case where ReturnT
-// is void. If the "regular void" proposal is accepted, this could be simpler:
-//   http://www.open-std.org/jtc1/sc22/wg21/docs/papers/2016/p0146r1.html.
-
-// The following non-specialized 'FuncWrapper' handles callables that return a
-// non-void value.
-template<typename ReturnT>
-struct FuncWrapper
+inline auto RangeFunc::operator()(const size_t begin, const size_t end) const noexcept -> void
 {
-  template<typename FuncT, typename... ArgsT>
-  auto GetWrapped(FuncT&& func, std::shared_ptr<std::promise<ReturnT>> promise, ArgsT&&... args)
-      -> std::function<void()>
-  {
-    // Capturing by value is inefficient. It would be more efficient to move-capture
-    // everything - can a generalized lambda capture help??
-    return
-        [promise, func, args...]() mutable { promise->set_value(INVOKE_MACRO(func, ArgsT, args)); };
-  }
-};
+  m_invoke(m_callable, begin, end);
+}
 
-template<typename FuncT, typename... ArgsT>
-void InvokeVoidRet(FuncT&& func,
-                   const std::shared_ptr<std::promise<void>>& promise,
-                   ArgsT&&... args)
+inline ThreadPool::LoopSlot::LoopSlot(const size_t numWorkers) noexcept
+  : workerSlices(numWorkers + 1)
 {
-  INVOKE_MACRO(func, ArgsT, args);
-  promise->set_value();
 }
 
-// Specialization to handle callables that return void.
-template<>
-struct FuncWrapper<void>
+namespace THREAD_POOL_IMPL
 {
-  template<typename FuncT, typename... ArgsT>
-  auto GetWrapped(FuncT&& func, const std::shared_ptr<std::promise<void>>& promise, ArgsT&&... args)
-      -> std::function<void()>
-  {
-    return [promise, func, args...]() mutable {
-      INVOKE_MACRO(func, ArgsT, args);
-      promise->set_value();
-    };
-  }
-};
+
+inline thread_local auto t_isPoolWorkerThread = false;
 
 } // namespace THREAD_POOL_IMPL
 
-template<typename FuncT, typename... ArgsT>
-auto ThreadPool::ScheduleAndGetFuture(FuncT&& func, ArgsT&&... args)
-    -> std::future<decltype(INVOKE_MACRO(func, ArgsT, args))>
+inline ThreadPool::ThreadPool(const size_t numWorkers,
+                              const std::vector<uint32_t>& cpuAffinity) noexcept
+  : m_loopSlots{LoopSlot{numWorkers}, LoopSlot{numWorkers}}
 {
-  using ReturnT = decltype(INVOKE_MACRO(func, ArgsT, args));
-
-  // We are only allocating this std::promise in a shared_ptr because
-  // std::promise is non-copyable.
-  std::shared_ptr<std::promise<ReturnT>> promise = std::make_shared<std::promise<ReturnT>>();
-  std::future<ReturnT> retFuture = promise->get_future();
-
-  THREAD_POOL_IMPL::FuncWrapper<ReturnT> funcWrapper{};
-  std::function<void()> wrappedFunc = funcWrapper.GetWrapped(
-      std::forward<FuncT>(func), std::move(promise), std::forward<ArgsT>(args)...);
+  Expects(numWorkers > 0);
 
-  // Acquire the lock, and then push the WorkItem onto the queue.
+  m_workers.reserve(numWorkers);
+  for (auto i = 0U; i < numWorkers; ++i)
   {
-    const std::scoped_lock<std::mutex> lock{m_mutex};
-    WorkItem work{};
-    work.func = std::move(wrappedFunc);
-    m_workQueue.emplace(std::move(work));
+    m_workers.emplace_back(&ThreadPool::ThreadLoop, this, i);
+    if (not cpuAffinity.empty())
+    {
+      SetCpuAffinity(m_workers.back(), cpuAffinity[i % cpuAffinity.size()]);
+    }
   }
-  m_newWorkCondition.notify_one(); // Tell one worker we are ready.
-
-  return retFuture;
 }
 
-ThreadPool::ThreadPool(const size_t numWorkers) noexcept : m_numWorkers(numWorkers)
+inline ThreadPool::~ThreadPool() noexcept
 {
-  Expects(numWorkers > 0);
+  m_finished.store(true, std::memory_order_release);
+  m_workSignal.fetch_add(1U, std::memory_order_release);
+  m_workSignal.notify_all();
 
-  m_workers.reserve(m_numWorkers);
-  for (size_t i = 0; i < m_numWorkers; ++i)
+  for (auto& worker : m_workers)
   {
-    m_workers.emplace_back(&ThreadPool::ThreadLoop, this);
+    worker.join();
   }
 }
 
-ThreadPool::~ThreadPool() noexcept
+inline auto ThreadPool::SetCpuAffinity([[maybe_unused]] std::thread& thread,
+                                       [[maybe_unused]] const uint32_t cpu) noexcept -> void
 {
+#ifdef __linux__
+  if (cpu >= CPU_SETSIZE)
   {
-    const std::scoped_lock<std::mutex> lock{m_mutex};
-    m_finished = true;
+    return;
   }
-  // Tell all the workers we're ready.
-  m_newWorkCondition.notify_all();
+  auto cpuSet = cpu_set_t{};
+  CPU_ZERO(&cpuSet);
+  CPU_SET(cpu, &cpuSet);
+  // Best effort - a failure just leaves the worker unpinned.
+  ::pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpuSet);
+#endif
+}
 
-  for (std::thread& thread : m_workers)
-  {
-    thread.join();
-  }
+inline auto ThreadPool::GetNumWorkers() const noexcept -> size_t
+{
+  return m_workers.size();
 }
 
-auto ThreadPool::GetThreadIds() const -> std::vector<std::thread::id>
+inline auto ThreadPool::GetThreadIds() const noexcept -> std::vector<std::thread::id>
 {
-  std::vector<std::thread::id> threadIds{};
-  for (const std::thread& thread : m_workers)
+  auto threadIds = std::vector<std::thread::id>{};
+  threadIds.reserve(m_workers.size());
+  for (const auto& worker : m_workers)
   {
-    threadIds.emplace_back(thread.get_id());
+    threadIds.emplace_back(worker.get_id());
   }
   return threadIds;
 }
 
-auto ThreadPool::GetOutstandingWorkSize() const -> size_t
+inline auto ThreadPool::IsPoolWorkerThread() noexcept -> bool
 {
-  const std::scoped_lock<std::mutex> lock{m_mutex};
-  return m_workQueue.size();
+  return THREAD_POOL_IMPL::t_isPoolWorkerThread;
 }
 
-auto ThreadPool::GetNumWorkers() const -> size_t
+constexpr auto ThreadPool::PackRange(const size_t begin, const size_t end) noexcept -> uint64_t
 {
-  return m_numWorkers;
+  return (static_cast<uint64_t>(begin) << NUM_END_BITS) | static_cast<uint64_t>(end);
 }
 
-void ThreadPool::SetWorkDoneCallback(std::function<void(int)> func)
+constexpr auto ThreadPool::UnpackRange(const uint64_t range) noexcept -> Chunk
 {
-  m_workDoneCallback = std::move(func);
+  return {.begin = static_cast<size_t>(range >> NUM_END_BITS),
+          .end   = static_cast<size_t>(range & END_MASK)};
 }
 
-void ThreadPool::Wait()
+inline auto ThreadPool::RunRange(const TaskPriority priority,
+                                 const size_t numIters,
+                                 const size_t chunkSize,
+                                 const RangeFunc& rangeFunc) noexcept -> void
 {
-  std::unique_lock<std::mutex> lock{m_mutex};
-  if (!m_workQueue.empty())
+  Expects(numIters <= MAX_NUM_ITERS);
+  Expects(chunkSize > 0);
+  Expects(not IsPoolWorkerThread());
+
+  if (0 == numIters)
   {
-    m_workDoneCondition.wait(lock, [this] { return m_workQueue.empty(); });
+    return;
   }
+
+  auto& loopSlot  = m_loopSlots.at(static_cast<size_t>(priority));
+  const auto lock = std::scoped_lock{loopSlot.runMutex};
+
+  loopSlot.rangeFunc = &rangeFunc;
+  loopSlot.chunkSize.store(chunkSize, std::memory_order_relaxed);
+  loopSlot.numItersLeft.store(numIters, std::memory_order_relaxed);
+
+  // The release stores publish the loop to any worker that claims a chunk of it.
+  const auto numSlices = loopSlot.workerSlices.size();
+  for (auto i = 0U; i < numSlices; ++i)
+  {
+    const auto begin = (i * numIters) / numSlices;
+    const auto end   = ((i + 1) * numIters) / numSlices;
+    loopSlot.workerSlices[i].range.store(PackRange(begin, end), std::memory_order_release);
+  }
+
+  m_workSignal.fetch_add(1U, std::memory_order_release);
+  m_workSignal.notify_all();
+
+  // Only this thread can run this loop slot now, so the last slice can't be in use by
+  // anyone else.
+  const auto callerIndex = numSlices - 1;
+  while (true)
+  {
+    const auto chunk = TakeChunk(loopSlot, callerIndex);
+    if (chunk.begin >= chunk.end)
+    {
+      break;
+    }
+    RunChunk(loopSlot, chunk);
+  }
+
+  for (auto numItersLeft = loopSlot.numItersLeft.load(std::memory_order_acquire);
+       numItersLeft != 0;
+       numItersLeft = loopSlot.numItersLeft.load(std::memory_order_acquire))
+  {
+    loopSlot.numItersLeft.wait(numItersLeft, std::memory_order_acquire);
+  }
+
+  loopSlot.rangeFunc = nullptr;
 }
 
-void ThreadPool::ThreadLoop()
+inline auto ThreadPool::ThreadLoop(const size_t workerIndex) noexcept -> void
 {
-  // Wait until the ThreadPool sends us work.
+  THREAD_POOL_IMPL::t_isPoolWorkerThread = true;
+
+  auto lastWorkSignal = uint64_t{0U};
+
   while (true)
   {
-    WorkItem workItem{};
+    m_workSignal.wait(lastWorkSignal, std::memory_order_acquire);
+    lastWorkSignal = m_workSignal.load(std::memory_order_acquire);
 
-    int32_t prevWorkSize = -1;
+    if (m_finished.load(std::memory_order_acquire))
     {
-      std::unique_lock<std::mutex> lock{m_mutex};
-      m_newWorkCondition.wait(lock, [this] { return m_finished || (!m_workQueue.empty()); });
+      break;
+    }
 
-      // If all the work is done and exit_ is true, then break out of the loop.
-      if (m_finished && m_workQueue.empty())
-      {
-        break;
-      }
+    while (DoNextChunk(workerIndex))
+    {
+    }
+  }
+}
 
-      // Pop the work off of the queue - we are careful to execute the
-      // work_item.func callback only after we have released the lock.
-      prevWorkSize = static_cast<int32_t>(m_workQueue.size());
-      workItem = std::move(m_workQueue.front());
-      m_workQueue.pop();
+inline auto ThreadPool::DoNextChunk(const size_t workerIndex) noexcept -> bool
+{
+  // Slots are in priority order, so returning after every chunk means a newly
+  // arrived frame critical loop preempts background work at the next chunk.
+  for (auto& loopSlot : m_loopSlots)
+  {
+    if (const auto chunk = TakeChunk(loopSlot, workerIndex); chunk.begin < chunk.end)
+    {
+      RunChunk(loopSlot, chunk);
+      return true;
     }
+  }
 
-    // We are careful to do the work without the lock held!
-    workItem.func(); // Do work.
+  return false;
+}
 
-    if (m_workDoneCallback)
+inline auto ThreadPool::TakeChunk(LoopSlot& loopSlot, const size_t workerIndex) noexcept -> Chunk
+{
+  if (const auto chunk = PopChunk(loopSlot, workerIndex); chunk.begin < chunk.end)
+  {
+    return chunk;
+  }
+  return StealChunk(loopSlot, workerIndex);
+}
+
+inline auto ThreadPool::RunChunk(LoopSlot& loopSlot, const Chunk& chunk) noexcept -> void
+{
+  (*loopSlot.rangeFunc)(chunk.begin, chunk.end);
+
+  const auto numItersDone = chunk.end - chunk.begin;
+  if (numItersDone == loopSlot.numItersLeft.fetch_sub(numItersDone, std::memory_order_acq_rel))
+  {
+    loopSlot.numItersLeft.notify_all();
+  }
+}
+
+inline auto ThreadPool::PopChunk(LoopSlot& loopSlot, const size_t workerIndex) noexcept -> Chunk
+{
+  auto& slice = loopSlot.workerSlices[workerIndex].range;
+
+  auto packedRange = slice.load(std::memory_order_acquire);
+  while (true)
+  {
+    const auto range = UnpackRange(packedRange);
+    if (range.begin >= range.end)
     {
-      m_workDoneCallback(prevWorkSize - 1);
+      return {.begin = 0U, .end = 0U};
     }
 
-    // Notify if all work is done.
+    const auto chunkSize = loopSlot.chunkSize.load(std::memory_order_relaxed);
+    const auto chunkEnd  = range.begin + std::min(chunkSize, range.end - range.begin);
+    if (slice.compare_exchange_weak(packedRange,
+                                    PackRange(chunkEnd, range.end),
+                                    std::memory_order_acq_rel,
+                                    std::memory_order_acquire))
     {
-      const std::unique_lock<std::mutex> lock{m_mutex};
-      if (m_workQueue.empty() && (1 == prevWorkSize))
+      return {.begin = range.begin, .end = chunkEnd};
+    }
+  }
+}
+
+// Any slice can be stolen from, including the calling thread's, as long as it holds more
+// than one chunk. The thief takes the back half, runs the first chunk of it and puts the
+// rest in its own slice, where it can be stolen again.
+//
+// The thief's slice is empty when it starts stealing, but a worker can be slow enough that
+// the loop it was stealing from finishes and a new loop in this slot refills its slice.
+// What it then steals belongs to the new loop (a CAS only succeeds on the current range),
+// but its own slice can't be overwritten. In that case the whole stolen half is returned as
+// one chunk, and only those iterations can't be stolen again. The check up front makes this
+// rare - it needs a new loop to arrive between the check and the steal.
+inline auto ThreadPool::StealChunk(LoopSlot& loopSlot, const size_t thiefIndex) noexcept -> Chunk
+{
+  auto& thiefSlice = loopSlot.workerSlices[thiefIndex].range;
+  if (const auto thiefRange = UnpackRange(thiefSlice.load(std::memory_order_acquire));
+      thiefRange.begin < thiefRange.end)
+  {
+    // A new loop has started - go back to popping.
+    return {.begin = 0U, .end = 0U};
+  }
+
+  const auto numSlices = loopSlot.workerSlices.size();
+
+  for (auto i = 1U; i < numSlices; ++i)
+  {
+    auto& victimSlice = loopSlot.workerSlices[(thiefIndex + i) % numSlices].range;
+
+    auto packedRange = victimSlice.load(std::memory_order_acquire);
+    while (true)
+    {
+      // Not worth stealing what the owner will take in one chunk anyway.
+      const auto range = UnpackRange(packedRange);
+      if ((range.begin >= range.end) or
+          ((range.end - range.begin) <= loopSlot.chunkSize.load(std::memory_order_relaxed)))
+      {
+        break;
+      }
+
+      const auto middle = range.begin + ((range.end - range.begin) / 2);
+      if (not victimSlice.compare_exchange_weak(packedRange,
+                                                PackRange(range.begin, middle),
+                                                std::memory_order_acq_rel,
+                                                std::memory_order_acquire))
       {
-        m_workDoneCondition.notify_all();
+        continue;
+      }
+
+      const auto chunkEnd =
+          middle + std::min(loopSlot.chunkSize.load(std::memory_order_relaxed), range.end - middle);
+
+      auto thiefPackedRange = thiefSlice.load(std::memory_order_acquire);
+      while (true)
+      {
+        const auto thiefRange = UnpackRange(thiefPackedRange);
+        if (thiefRange.begin < thiefRange.end)
+        {
+          // Refilled by a new loop since the check above.
+          return {.begin = middle, .end = range.end};
+        }
+        if (thiefSlice.compare_exchange_weak(thiefPackedRange,
+                                             PackRange(chunkEnd, range.end),
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_acquire))
+        {
+          return {.begin = middle, .end = chunkEnd};
+        }
       }
     }
   }
+
+  return {.begin = 0U, .end = 0U};
 }
 
 } // namespace GOOM::UTILS
-
-// NOLINTEND
-// clang-format on
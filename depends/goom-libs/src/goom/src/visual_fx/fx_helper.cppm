@@ -6,6 +6,7 @@ export module Goom.VisualFx.FxHelper;
 
 import Goom.Control.GoomSoundEvents;
 import Goom.Draw.GoomDrawBase;
+import Goom.Utils.FrameArena;
 import Goom.Utils.Graphics.Blend2dToGoom;
 import Goom.Utils.Math.GoomRand;
 import Goom.Utils.GoomTime;
@@ -22,7 +23,8 @@ public:
            const PluginInfo& goomInfo,
            const UTILS::MATH::GoomRand& goomRand,
            GoomLogger& goomLogger,
-           UTILS::GRAPHICS::Blend2dContexts& blend2dContexts) noexcept;
+           UTILS::GRAPHICS::Blend2dContexts& blend2dContexts,
+           UTILS::FrameArena& frameArena) noexcept;
 
   [[nodiscard]] auto GetDraw() const noexcept -> const DRAW::IGoomDraw&;
   [[nodiscard]] auto GetDraw() noexcept -> DRAW::IGoomDraw&;
@@ -32,6 +34,9 @@ public:
   [[nodiscard]] auto GetGoomLogger() noexcept -> GoomLogger&;
   [[nodiscard]] auto GetBlend2dContexts() const noexcept -> const UTILS::GRAPHICS::Blend2dContexts&;
   [[nodiscard]] auto GetBlend2dContexts() noexcept -> UTILS::GRAPHICS::Blend2dContexts&;
+  // For scratch memory that's only needed during 'ApplyToImageBuffers'. It's reset before
+  // each update, and each fx has its own arena, so no other fx can be using it.
+  [[nodiscard]] auto GetFrameArena() noexcept -> UTILS::FrameArena&;
 
   [[nodiscard]] auto GetDimensions() const noexcept -> const Dimensions&;
   [[nodiscard]] auto GetSoundEvents() const -> const CONTROL::GoomSoundEvents&;
@@ -43,18 +48,21 @@ private:
   const UTILS::MATH::GoomRand* m_goomRand;
   GoomLogger* m_goomLogger;
   UTILS::GRAPHICS::Blend2dContexts* m_blend2dContexts;
+  UTILS::FrameArena* m_frameArena;
 };
 
 inline FxHelper::FxHelper(DRAW::IGoomDraw& draw,
                           const PluginInfo& goomInfo,
                           const UTILS::MATH::GoomRand& goomRand,
                           GoomLogger& goomLogger,
-                          UTILS::GRAPHICS::Blend2dContexts& blend2dContexts) noexcept
+                          UTILS::GRAPHICS::Blend2dContexts& blend2dContexts,
+                          UTILS::FrameArena& frameArena) noexcept
   : m_draw{&draw},
     m_goomInfo{&goomInfo},
     m_goomRand{&goomRand},
     m_goomLogger{&goomLogger},
-    m_blend2dContexts{&blend2dContexts}
+    m_blend2dContexts{&blend2dContexts},
+    m_frameArena{&frameArena}
 {
 }
 
@@ -98,6 +106,11 @@ inline auto FxHelper::GetBlend2dContexts() noexcept -> UTILS::GRAPHICS::Blend2dC
   return *m_blend2dContexts;
 }
 
+inline auto FxHelper::GetFrameArena() noexcept -> UTILS::FrameArena&
+{
+  return *m_frameArena;
+}
+
 inline auto FxHelper::GetDimensions() const noexcept -> const Dimensions&
 {
   return m_goomInfo->GetDimensions();
@@ -1,6 +1,7 @@
 module;
 
 #include <cstdint>
+#include <optional>
 
 export module Goom.VisualFx.FxUtils:RandomPixelBlender;
 
@@ -21,6 +22,7 @@ using GOOM::UTILS::GRAPHICS::GetDarkenOnlyPixelBlend;
 using GOOM::UTILS::GRAPHICS::GetLightenOnlyPixelBlend;
 using GOOM::UTILS::GRAPHICS::GetPixelWithNewAlpha;
 using GOOM::UTILS::GRAPHICS::GetSameLumaMixPixelBlend;
+using GOOM::UTILS::GRAPHICS::PixelBlendRowType;
 using GOOM::UTILS::MATH::GoomRand;
 using GOOM::UTILS::MATH::NumberRange;
 using GOOM::UTILS::MATH::TValue;
@@ -66,6 +68,10 @@ public:
   auto SetPixelBlendType(PixelBlendType pixelBlendType) noexcept -> void;
   auto SetRandomPixelBlendType() noexcept -> void;
   [[nodiscard]] auto GetCurrentPixelBlendFunc() const noexcept -> DRAW::IGoomDraw::PixelBlendFunc;
+  // The row blend type that draws exactly as the current blend func, over a transparent
+  // bgnd as well. There is none while lerping between two blends, or for the luma mix.
+  [[nodiscard]] auto GetCurrentPixelBlendRowType() const noexcept
+      -> std::optional<UTILS::GRAPHICS::PixelBlendRowType>;
 
   [[nodiscard]] static auto GetRandomPixelBlendType(const UTILS::MATH::GoomRand& goomRand) noexcept
       -> PixelBlendType;
@@ -77,6 +83,7 @@ private:
   DRAW::IGoomDraw::PixelBlendFunc m_previousPixelBlendFunc = GetNextPixelBlendFunc();
   DRAW::IGoomDraw::PixelBlendFunc m_nextPixelBlendFunc     = m_previousPixelBlendFunc;
   DRAW::IGoomDraw::PixelBlendFunc m_currentPixelBlendFunc  = m_previousPixelBlendFunc;
+  bool m_lerpingPixelBlendFuncs                            = false;
   static constexpr auto LERP_STEPS_RANGE                   = NumberRange{50U, 500U};
   TValue m_lerpT{
       {.stepType = TValue::StepType::SINGLE_CYCLE, .numSteps = LERP_STEPS_RANGE.min}
@@ -110,7 +117,8 @@ inline auto RandomPixelBlender::Update() noexcept -> void
 
   if (m_lerpT() >= 1.0F)
   {
-    m_currentPixelBlendFunc = m_nextPixelBlendFunc;
+    m_currentPixelBlendFunc  = m_nextPixelBlendFunc;
+    m_lerpingPixelBlendFuncs = false;
   }
 }
 
@@ -120,6 +128,33 @@ inline auto RandomPixelBlender::GetCurrentPixelBlendFunc() const noexcept
   return m_currentPixelBlendFunc;
 }
 
+inline auto RandomPixelBlender::GetCurrentPixelBlendRowType() const noexcept
+    -> std::optional<PixelBlendRowType>
+{
+  if (m_lerpingPixelBlendFuncs)
+  {
+    return std::nullopt;
+  }
+
+  switch (m_nextPixelBlendType)
+  {
+    case PixelBlendType::ADD:
+      return PixelBlendRowType::COLOR_ADD;
+    case PixelBlendType::DARKEN_ONLY:
+      return PixelBlendRowType::DARKEN_ONLY;
+    case PixelBlendType::LIGHTEN_ONLY:
+      return PixelBlendRowType::LIGHTEN_ONLY;
+    case PixelBlendType::LUMA_MIX:
+      return std::nullopt;
+    case PixelBlendType::MULTIPLY:
+      return PixelBlendRowType::COLOR_MULTIPLY;
+    case PixelBlendType::ALPHA:
+      return PixelBlendRowType::COLOR_ALPHA;
+    case PixelBlendType::ALPHA_AND_ADD:
+      return PixelBlendRowType::COLOR_ALPHA_AND_ADD;
+  }
+}
+
 const Weights<RandomPixelBlender::PixelBlendType>::EventWeightPairs
     // NOLINTNEXTLINE(cert-err58-cpp): How to fix this?
     RandomPixelBlender::DEFAULT_PIXEL_BLEND_TYPE_WEIGHTS{
@@ -189,8 +224,9 @@ auto RandomPixelBlender::SetPixelBlendFunc(const PixelBlendType pixelBlendType)
 
   if (previousPixelBlendType != m_nextPixelBlendType)
   {
-    m_nextPixelBlendFunc    = GetNextPixelBlendFunc();
-    m_currentPixelBlendFunc = GetLerpedPixelBlendFunc();
+    m_nextPixelBlendFunc     = GetNextPixelBlendFunc();
+    m_currentPixelBlendFunc  = GetLerpedPixelBlendFunc();
+    m_lerpingPixelBlendFuncs = true;
   }
 
   m_lerpT.SetNumSteps(m_goomRand->GetRandInRange<LERP_STEPS_RANGE>());
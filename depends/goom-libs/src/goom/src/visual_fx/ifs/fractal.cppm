@@ -13,6 +13,8 @@ import Goom.Utils.Graphics.SmallImageBitmaps;
 import Goom.Utils.Math.TValues;
 import Goom.Utils.Math.GoomRand;
 import Goom.Utils.Math.Misc;
+import Goom.Utils.Parallel;
+import Goom.VisualFx.IfsDancersFx.FractalTrace;
 import Goom.Lib.GoomTypes;
 import :FractalHits;
 import :Similitudes;
@@ -23,6 +25,7 @@ using GOOM::UTILS::MATH::GoomRand;
 using GOOM::UTILS::MATH::NumberRange;
 using GOOM::UTILS::MATH::TValue;
 using GOOM::UTILS::MATH::U_HALF;
+using GOOM::UTILS::Parallel;
 
 namespace GOOM::VISUAL_FX::IFS
 {
@@ -30,7 +33,8 @@ namespace GOOM::VISUAL_FX::IFS
 class Fractal
 {
 public:
-  Fractal(const Dimensions& dimensions,
+  Fractal(Parallel& parallel,
+          const Dimensions& dimensions,
           const GoomRand& goomRand,
           const SmallImageBitmaps& smallBitmaps);
 
@@ -46,6 +50,7 @@ public:
   [[nodiscard]] auto GetMaxHitCount() const -> uint32_t;
 
 private:
+  Parallel* m_parallel;
   Similitudes m_similitudes;
   const GoomRand* m_goomRand;
 
@@ -74,10 +79,29 @@ private:
   auto UpdateMainSimis() -> void;
   [[nodiscard]] auto GetCurrentIfsPoints() -> const std::vector<IfsPoint>&;
   auto DrawFractal() -> void;
-  auto Trace(uint32_t curDepth, const FltPoint& point0) -> void;
-  [[nodiscard]] static auto AreSimilarPoints(const FltPoint& point1, const FltPoint& point2)
-      -> bool;
-  auto UpdateHits(const Similitude& simi, const FltPoint& point) -> void;
+
+  // The main simis, as the fractal trace wants them.
+  class SimiTransformer
+  {
+  public:
+    using Point = FltPoint;
+
+    explicit SimiTransformer(const Similitudes& similitudes) noexcept;
+
+    [[nodiscard]] auto GetNumSimis() const -> uint32_t;
+    [[nodiscard]] auto Transform(uint32_t simiIndex, const FltPoint& point0) const -> FltPoint;
+    [[nodiscard]] static auto AreSimilarPoints(const FltPoint& point1, const FltPoint& point2)
+        -> bool;
+
+  private:
+    const Similitudes* m_similitudes;
+  };
+  SimiTransformer m_simiTransformer{m_similitudes};
+  std::vector<FltPoint> m_topLevelPoints;
+  FractalTrace<SimiTransformer> m_fractalTrace{*m_parallel};
+  using TraceHit = FractalTrace<SimiTransformer>::Hit;
+  auto SetTopLevelPoints() -> void;
+  auto UpdateHits(const TraceHit& hit) -> void;
 };
 
 } // namespace GOOM::VISUAL_FX::IFS
@@ -90,10 +114,12 @@ inline auto Fractal::GetMaxHitCount() const -> uint32_t
   return m_curHits->GetMaxHitCount();
 }
 
-Fractal::Fractal(const Dimensions& dimensions,
+Fractal::Fractal(Parallel& parallel,
+                 const Dimensions& dimensions,
                  const GoomRand& goomRand,
                  const SmallImageBitmaps& smallBitmaps)
-  : m_similitudes{goomRand, smallBitmaps},
+  : m_parallel{&parallel},
+    m_similitudes{goomRand, smallBitmaps},
     m_goomRand{&goomRand},
     m_halfWidth{static_cast<Flt>(U_HALF * (dimensions.GetWidth() - 1))},
     m_halfHeight{static_cast<Flt>(U_HALF * (dimensions.GetHeight() - 1))},
@@ -182,10 +208,20 @@ inline auto Fractal::UpdateIterationCount() -> void
 }
 
 auto Fractal::DrawFractal() -> void
+{
+  SetTopLevelPoints();
+
+  m_fractalTrace.Trace(m_simiTransformer, m_topLevelPoints, m_similitudes.GetSimiDepth());
+  m_fractalTrace.ForEachHit([this](const TraceHit& hit) { UpdateHits(hit); });
+}
+
+auto Fractal::SetTopLevelPoints() -> void
 {
   const auto& mainSimiGroup = m_similitudes.GetMainSimiGroup();
   const auto numSimis       = m_similitudes.GetNumSimis();
 
+  m_topLevelPoints.clear();
+
   for (auto i = 0U; i < numSimis; ++i)
   {
     const auto point0 = mainSimiGroup[i].GetCPoint();
@@ -194,8 +230,7 @@ auto Fractal::DrawFractal() -> void
     {
       if (i != j)
       {
-        const auto point = m_similitudes.Transform(mainSimiGroup[j], point0);
-        Trace(m_similitudes.GetSimiDepth(), point);
+        m_topLevelPoints.emplace_back(m_similitudes.Transform(mainSimiGroup[j], point0));
       }
     }
   }
@@ -208,44 +243,35 @@ inline auto Fractal::UpdateMainSimis() -> void
   m_similitudes.UpdateMainSimis(uValue);
 }
 
-// https://glk.youtrack.cloud/issue/G-92
-// NOLINTNEXTLINE(misc-no-recursion)
-auto Fractal::Trace(const uint32_t curDepth, const FltPoint& point0) -> void
+inline Fractal::SimiTransformer::SimiTransformer(const Similitudes& similitudes) noexcept
+  : m_similitudes{&similitudes}
 {
-  const auto& mainSimiGroup = m_similitudes.GetMainSimiGroup();
-  const auto numSimis       = m_similitudes.GetNumSimis();
-
-  for (auto i = 0U; i < numSimis; ++i)
-  {
-    const auto point = m_similitudes.Transform(mainSimiGroup[i], point0);
-
-    UpdateHits(mainSimiGroup[i], point);
+}
 
-    if (0 == curDepth)
-    {
-      continue;
-    }
-    if (AreSimilarPoints(point0, point))
-    {
-      continue;
-    }
+inline auto Fractal::SimiTransformer::GetNumSimis() const -> uint32_t
+{
+  return static_cast<uint32_t>(m_similitudes->GetNumSimis());
+}
 
-    Trace(curDepth - 1, point);
-  }
+inline auto Fractal::SimiTransformer::Transform(const uint32_t simiIndex,
+                                                const FltPoint& point0) const -> FltPoint
+{
+  return m_similitudes->Transform(m_similitudes->GetMainSimiGroup()[simiIndex], point0);
 }
 
-inline auto Fractal::AreSimilarPoints(const FltPoint& point1, const FltPoint& point2) -> bool
+inline auto Fractal::SimiTransformer::AreSimilarPoints(const FltPoint& point1,
+                                                       const FltPoint& point2) -> bool
 {
   // TODO(glk) What's going on here?
   static constexpr auto CUTOFF = 16;
   return (std::abs(point1.x - point2.x) < CUTOFF) || (std::abs(point1.y - point2.y) < CUTOFF);
 }
 
-inline auto Fractal::UpdateHits(const Similitude& simi, const FltPoint& point) -> void
+inline auto Fractal::UpdateHits(const TraceHit& hit) -> void
 {
-  const auto x = m_halfWidth + DivBy2Units(point.x * m_halfWidth);
-  const auto y = m_halfHeight - DivBy2Units(point.y * m_halfHeight);
-  m_curHits->AddHit(x, y, simi);
+  const auto x = m_halfWidth + DivBy2Units(hit.point.x * m_halfWidth);
+  const auto y = m_halfHeight - DivBy2Units(hit.point.y * m_halfHeight);
+  m_curHits->AddHit(x, y, m_similitudes.GetMainSimiGroup()[hit.simiIndex]);
 }
 
 } // namespace GOOM::VISUAL_FX::IFS
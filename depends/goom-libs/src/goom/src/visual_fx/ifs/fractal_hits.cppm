@@ -39,9 +39,9 @@ private:
     Pixel color    = BLACK_PIXEL;
     const Similitude* simi{};
   };
-  std::vector<std::vector<HitInfo>> m_hitInfo{GetHitInfo(m_dimensions)};
-  [[nodiscard]] static auto GetHitInfo(const Dimensions& dimensions) noexcept
-      -> std::vector<std::vector<HitInfo>>;
+  // One flat row major grid, so a hit is a single index away.
+  std::vector<HitInfo> m_hitInfo = std::vector<HitInfo>(m_dimensions.GetSize());
+  [[nodiscard]] auto GetHitIndex(uint32_t x, uint32_t y) const noexcept -> size_t;
   uint32_t m_maxHitCount                = 0;
   static constexpr size_t HITS_ESTIMATE = 1000;
   std::vector<IfsPoint> m_hits;
@@ -65,23 +65,16 @@ FractalHits::FractalHits(const Dimensions& dimensions) noexcept : m_dimensions{d
   m_hits.reserve(HITS_ESTIMATE);
 }
 
-auto FractalHits::GetHitInfo(const Dimensions& dimensions) noexcept
-    -> std::vector<std::vector<HitInfo>>
+inline auto FractalHits::GetHitIndex(const uint32_t x, const uint32_t y) const noexcept -> size_t
 {
-  auto hitInfo = std::vector<std::vector<HitInfo>>(dimensions.GetHeight());
-  for (auto& xHit : hitInfo)
-  {
-    xHit.resize(dimensions.GetWidth());
-  }
-  return hitInfo;
+  return (static_cast<size_t>(y) * m_dimensions.GetWidth()) + x;
 }
 
 void FractalHits::Reset()
 {
   for (const auto& hit : m_hits)
   {
-    auto& hitInfo = m_hitInfo[hit.GetY()][hit.GetX()];
-    hitInfo.count = 0;
+    m_hitInfo[GetHitIndex(hit.GetX(), hit.GetY())].count = 0;
   }
 
   m_hits.clear();
@@ -99,7 +92,7 @@ void FractalHits::AddHit(const int32_t x, const int32_t y, const Similitude& sim
     return;
   }
 
-  auto& hitInfo = m_hitInfo[static_cast<uint32_t>(y)][static_cast<uint32_t>(x)];
+  auto& hitInfo = m_hitInfo[GetHitIndex(static_cast<uint32_t>(x), static_cast<uint32_t>(y))];
 
   ++hitInfo.count;
   m_maxHitCount = std::max(hitInfo.count, m_maxHitCount);
@@ -124,7 +117,7 @@ auto FractalHits::GetBuffer() -> const std::vector<IfsPoint>&
   for (const auto& hit : m_hits)
   {
     auto updatedHit     = hit;
-    const auto& hitInfo = m_hitInfo[hit.GetY()][hit.GetX()];
+    const auto& hitInfo = m_hitInfo[GetHitIndex(hit.GetX(), hit.GetY())];
 
     updatedHit.SetCount(hitInfo.count);
     updatedHit.SetColor(hitInfo.color);
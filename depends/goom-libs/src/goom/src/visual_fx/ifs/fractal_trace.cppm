@@ -0,0 +1,262 @@
+module;
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+export module Goom.VisualFx.IfsDancersFx.FractalTrace;
+
+import Goom.Utils.Parallel;
+import Goom.Lib.AssertUtils;
+
+export namespace GOOM::VISUAL_FX::IFS
+{
+
+// Traces an IFS fractal, depth first, below some top level points. At each point, every
+// simi is applied, and each new point is a hit. The trace goes on below a hit until it's
+// 'depth' levels down, or the hit is too close to the point it came from.
+//
+// The trace is done as a list of tasks, in the order a depth first trace would visit them.
+// A task is a hit, if it has a simi, followed by a trace of the points below it. The top
+// levels of the trace are expanded, breadth first, until there are enough tasks to keep the
+// thread pool busy. Then the tasks are traced in parallel, each into its own hit list. So
+// the hits, taken in task order, are exactly the same as for one serial recursive trace.
+//
+// 'SimiTransformer' gives the point type as 'Point', and has:
+//   'GetNumSimis() -> uint32_t'
+//   'Transform(simiIndex, point) -> Point'
+//   'AreSimilarPoints(point1, point2) -> bool'
+template<class SimiTransformer>
+class FractalTrace
+{
+public:
+  using Point = typename SimiTransformer::Point;
+  struct Hit
+  {
+    Point point;
+    uint32_t simiIndex;
+  };
+  static constexpr auto MAX_TRACE_DEPTH = 15U;
+
+  explicit FractalTrace(UTILS::Parallel& parallel) noexcept;
+
+  // The top level points are not hits.
+  auto Trace(const SimiTransformer& simiTransformer,
+             std::span<const Point> topLevelPoints,
+             uint32_t depth) -> void;
+  // Calls 'hitFunc(hit)' for each hit of the last trace, in depth first order.
+  template<typename HitFunc>
+  auto ForEachHit(const HitFunc& hitFunc) const -> void;
+
+private:
+  UTILS::Parallel* m_parallel;
+  const SimiTransformer* m_simiTransformer = nullptr;
+
+  static constexpr auto NO_SIMI = ~0U;
+  struct TraceTask
+  {
+    Hit hit;
+    uint32_t depth;
+    bool isTraced;
+  };
+  static constexpr auto MIN_TASKS_PER_THREAD = 4U;
+  std::vector<TraceTask> m_traceTasks;
+  std::vector<TraceTask> m_expandedTraceTasks;
+  std::vector<std::vector<Hit>> m_taskHits;
+  auto SetTopLevelTraceTasks(std::span<const Point> topLevelPoints, uint32_t depth) -> void;
+  [[nodiscard]] auto GetMinNumTraceTasks() const -> size_t;
+  [[nodiscard]] auto ExpandTraceTasks() -> bool;
+  auto AddChildTraceTasks(const TraceTask& traceTask) -> void;
+  auto TraceTasks() -> void;
+  auto TraceBelow(uint32_t depth, const Point& point0, std::vector<Hit>& hits) const -> void;
+};
+
+} // namespace GOOM::VISUAL_FX::IFS
+
+namespace GOOM::VISUAL_FX::IFS
+{
+
+template<class SimiTransformer>
+FractalTrace<SimiTransformer>::FractalTrace(UTILS::Parallel& parallel) noexcept
+  : m_parallel{&parallel}
+{
+}
+
+template<class SimiTransformer>
+auto FractalTrace<SimiTransformer>::Trace(const SimiTransformer& simiTransformer,
+                                          const std::span<const Point> topLevelPoints,
+                                          const uint32_t depth) -> void
+{
+  m_simiTransformer = &simiTransformer;
+
+  SetTopLevelTraceTasks(topLevelPoints, depth);
+
+  const auto minNumTraceTasks = GetMinNumTraceTasks();
+  while (m_traceTasks.size() < minNumTraceTasks)
+  {
+    if (not ExpandTraceTasks())
+    {
+      break;
+    }
+  }
+
+  TraceTasks();
+}
+
+template<class SimiTransformer>
+template<typename HitFunc>
+auto FractalTrace<SimiTransformer>::ForEachHit(const HitFunc& hitFunc) const -> void
+{
+  for (auto i = 0U; i < m_traceTasks.size(); ++i)
+  {
+    if (const auto& hit = m_traceTasks[i].hit; hit.simiIndex != NO_SIMI)
+    {
+      hitFunc(hit);
+    }
+    for (const auto& hit : m_taskHits[i])
+    {
+      hitFunc(hit);
+    }
+  }
+}
+
+template<class SimiTransformer>
+auto FractalTrace<SimiTransformer>::SetTopLevelTraceTasks(
+    const std::span<const Point> topLevelPoints, const uint32_t depth) -> void
+{
+  m_traceTasks.clear();
+
+  for (const auto& point : topLevelPoints)
+  {
+    m_traceTasks.emplace_back(Hit{.point = point, .simiIndex = NO_SIMI}, depth, true);
+  }
+}
+
+template<class SimiTransformer>
+inline auto FractalTrace<SimiTransformer>::GetMinNumTraceTasks() const -> size_t
+{
+  return MIN_TASKS_PER_THREAD * m_parallel->GetNumThreadsUsed();
+}
+
+template<class SimiTransformer>
+auto FractalTrace<SimiTransformer>::ExpandTraceTasks() -> bool
+{
+  m_expandedTraceTasks.clear();
+
+  auto expanded = false;
+  for (const auto& traceTask : m_traceTasks)
+  {
+    if (not traceTask.isTraced)
+    {
+      m_expandedTraceTasks.emplace_back(traceTask);
+      continue;
+    }
+
+    if (traceTask.hit.simiIndex != NO_SIMI)
+    {
+      m_expandedTraceTasks.emplace_back(traceTask.hit, 0U, false);
+    }
+    AddChildTraceTasks(traceTask);
+    expanded = true;
+  }
+
+  std::swap(m_traceTasks, m_expandedTraceTasks);
+
+  return expanded;
+}
+
+// Does one level of 'TraceBelow', but into tasks instead of hits.
+template<class SimiTransformer>
+auto FractalTrace<SimiTransformer>::AddChildTraceTasks(const TraceTask& traceTask) -> void
+{
+  const auto numSimis = m_simiTransformer->GetNumSimis();
+  const auto& point0  = traceTask.hit.point;
+
+  for (auto i = 0U; i < numSimis; ++i)
+  {
+    const auto point    = m_simiTransformer->Transform(i, point0);
+    const auto isTraced = (traceTask.depth > 0) and
+                          (not m_simiTransformer->AreSimilarPoints(point0, point));
+
+    m_expandedTraceTasks.emplace_back(Hit{.point = point, .simiIndex = i},
+                                      isTraced ? (traceTask.depth - 1) : 0U,
+                                      isTraced);
+  }
+}
+
+template<class SimiTransformer>
+auto FractalTrace<SimiTransformer>::TraceTasks() -> void
+{
+  if (m_taskHits.size() < m_traceTasks.size())
+  {
+    m_taskHits.resize(m_traceTasks.size());
+  }
+
+  m_parallel->ForLoop(m_traceTasks.size(),
+                      [this](const size_t i)
+                      {
+                        auto& hits = m_taskHits[i];
+                        hits.clear();
+
+                        const auto& traceTask = m_traceTasks[i];
+                        if (traceTask.isTraced)
+                        {
+                          TraceBelow(traceTask.depth, traceTask.hit.point, hits);
+                        }
+                      });
+}
+
+// A depth first trace with an explicit stack. The hits are in the same order as they would
+// be for a recursive trace.
+template<class SimiTransformer>
+auto FractalTrace<SimiTransformer>::TraceBelow(const uint32_t depth,
+                                               const Point& point0,
+                                               std::vector<Hit>& hits) const -> void
+{
+  Expects(depth <= MAX_TRACE_DEPTH);
+
+  const auto numSimis = m_simiTransformer->GetNumSimis();
+
+  struct TraceFrame
+  {
+    Point point0;
+    uint32_t depth;
+    uint32_t nextSimi;
+  };
+  auto stack     = std::array<TraceFrame, MAX_TRACE_DEPTH + 1>{};
+  auto stackSize = 1U;
+  stack[0]       = {.point0 = point0, .depth = depth, .nextSimi = 0U};
+
+  while (stackSize > 0)
+  {
+    auto& frame = stack.at(stackSize - 1);
+    if (frame.nextSimi == numSimis)
+    {
+      --stackSize;
+      continue;
+    }
+
+    const auto simiIndex = frame.nextSimi;
+    ++frame.nextSimi;
+
+    const auto point = m_simiTransformer->Transform(simiIndex, frame.point0);
+    hits.emplace_back(point, simiIndex);
+
+    if (0 == frame.depth)
+    {
+      continue;
+    }
+    if (m_simiTransformer->AreSimilarPoints(frame.point0, point))
+    {
+      continue;
+    }
+
+    stack.at(stackSize) = {.point0 = point, .depth = frame.depth - 1, .nextSimi = 0U};
+    ++stackSize;
+  }
+}
+
+} // namespace GOOM::VISUAL_FX::IFS
@@ -5,7 +5,7 @@ module;
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <vector>
+#include <span>
 
 module Goom.VisualFx.IfsDancersFx:LowDensityBlurrer;
 
@@ -72,14 +72,14 @@ public:
 
   auto SetNeighbourMixFactor(float neighbourMixFactor) noexcept -> void;
 
-  auto DoBlur(std::vector<IfsPoint>& lowDensityPoints, uint32_t maxLowDensityCount) noexcept
-      -> void;
+  auto DoBlur(std::span<IfsPoint> lowDensityPoints, uint32_t maxLowDensityCount) noexcept -> void;
 
 private:
   IGoomDraw* m_draw;
   BitmapDrawer m_bitmapDrawer{*m_draw};
   PixelDrawer m_pixelDrawer{*m_draw};
   const GoomRand* m_goomRand;
+  static constexpr auto MAX_WIDTH = 7U;
   uint32_t m_width;
   size_t m_widthSquared = Sq(static_cast<size_t>(m_width));
   const SmallImageBitmaps* m_smallBitmaps;
@@ -89,20 +89,22 @@ private:
   BlurrerColorMode m_colorMode{};
   Pixel m_singleColor;
 
-  auto SetPointColors(std::vector<IfsPoint>& lowDensityPoints,
+  auto SetPointColors(std::span<IfsPoint> lowDensityPoints,
                       uint32_t maxLowDensityCount) const noexcept -> void;
-  auto DrawPoints(const std::vector<IfsPoint>& lowDensityPoints) noexcept -> void;
+  auto DrawPoints(std::span<const IfsPoint> lowDensityPoints) noexcept -> void;
   auto DrawPoint(const IfsPoint& point) noexcept -> void;
   [[nodiscard]] auto GetImageBitmap(bool useBitmaps) const noexcept -> const ImageBitmap*;
   [[nodiscard]] auto GetBrightness() const noexcept -> float;
-  [[nodiscard]] auto GetNeighbours(const IfsPoint& point) const noexcept -> std::vector<Pixel>;
+  // The neighbours are gathered into a fixed window on the stack, so there's no
+  // allocation per point.
+  using NeighbourWindow = std::array<Pixel, MAX_WIDTH * MAX_WIDTH>;
+  [[nodiscard]] auto GetNeighbourhoodAverageColor(const IfsPoint& point) const noexcept -> Pixel;
   [[nodiscard]] auto GetPointColor(const IfsPoint& point,
                                    float t,
-                                   const std::vector<Pixel>& neighbours,
                                    float logMaxLowDensityCount) const noexcept -> Pixel;
   [[nodiscard]] auto GetMixedPointColor(const Pixel& baseColor,
                                         const IfsPoint& point,
-                                        const std::vector<Pixel>& neighbours,
+                                        const Pixel& neighbourhoodAverageColor,
                                         float brightness,
                                         float logAlpha) const noexcept -> Pixel;
 
@@ -142,6 +144,7 @@ LowDensityBlurrer::LowDensityBlurrer(IGoomDraw& draw,
     m_smallBitmaps{&smallBitmaps},
     m_colorizer{&colorizer}
 {
+  Expects(m_width <= MAX_WIDTH);
 }
 
 auto LowDensityBlurrer::SetWidth(const uint32_t val) noexcept -> void
@@ -152,6 +155,7 @@ auto LowDensityBlurrer::SetWidth(const uint32_t val) noexcept -> void
 #endif
   static constexpr auto VALID_WIDTHS = std::array{3, 5, 7};
   Expects(std::ranges::find(VALID_WIDTHS, val) != cend(VALID_WIDTHS));
+  static_assert(static_cast<uint32_t>(std::ranges::max(VALID_WIDTHS)) <= MAX_WIDTH);
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
@@ -181,14 +185,14 @@ auto LowDensityBlurrer::GetImageBitmap(const bool useBitmaps) const noexcept ->
   return &m_smallBitmaps->GetImageBitmap(SmallImageBitmaps::ImageNames::SPHERE, bitmapRes);
 }
 
-auto LowDensityBlurrer::DoBlur(std::vector<IfsPoint>& lowDensityPoints,
+auto LowDensityBlurrer::DoBlur(const std::span<IfsPoint> lowDensityPoints,
                                const uint32_t maxLowDensityCount) noexcept -> void
 {
   SetPointColors(lowDensityPoints, maxLowDensityCount);
   DrawPoints(lowDensityPoints);
 }
 
-inline auto LowDensityBlurrer::SetPointColors(std::vector<IfsPoint>& lowDensityPoints,
+inline auto LowDensityBlurrer::SetPointColors(const std::span<IfsPoint> lowDensityPoints,
                                               const uint32_t maxLowDensityCount) const noexcept
     -> void
 {
@@ -207,15 +211,16 @@ inline auto LowDensityBlurrer::SetPointColors(std::vector<IfsPoint>& lowDensityP
       continue;
     }
 
-    point.SetColor(GetPointColor(point, t, GetNeighbours(point), logMaxLowDensityCount));
+    point.SetColor(GetPointColor(point, t, logMaxLowDensityCount));
 
     t += tStep;
   }
 }
 
-auto LowDensityBlurrer::GetNeighbours(const IfsPoint& point) const noexcept -> std::vector<Pixel>
+auto LowDensityBlurrer::GetNeighbourhoodAverageColor(const IfsPoint& point) const noexcept
+    -> Pixel
 {
-  auto neighbours = std::vector<Pixel>(m_widthSquared);
+  auto neighbours = NeighbourWindow{};
 
   const auto neighX0 = static_cast<int32_t>(point.GetX() - (m_width / 2));
   auto neighY        = static_cast<int32_t>(point.GetY() - (m_width / 2));
@@ -233,10 +238,10 @@ auto LowDensityBlurrer::GetNeighbours(const IfsPoint& point) const noexcept -> s
     ++neighY;
   }
 
-  return neighbours;
+  return GetColorAverage(m_widthSquared, neighbours);
 }
 
-inline auto LowDensityBlurrer::DrawPoints(const std::vector<IfsPoint>& lowDensityPoints) noexcept
+inline auto LowDensityBlurrer::DrawPoints(const std::span<const IfsPoint> lowDensityPoints) noexcept
     -> void
 {
   std::ranges::for_each(lowDensityPoints,
@@ -268,7 +273,6 @@ inline auto LowDensityBlurrer::DrawPoint(const IfsPoint& point) noexcept -> void
 
 auto LowDensityBlurrer::GetPointColor(const IfsPoint& point,
                                       const float t,
-                                      const std::vector<Pixel>& neighbours,
                                       const float logMaxLowDensityCount) const noexcept -> Pixel
 {
   const auto logAlpha =
@@ -288,7 +292,7 @@ auto LowDensityBlurrer::GetPointColor(const IfsPoint& point,
       break;
     case SINGLE_WITH_NEIGHBOURS:
       pointColor = ColorMaps::GetColorMix(
-          m_singleColor, GetColorAverage(neighbours.size(), neighbours), m_neighbourMixFactor);
+          m_singleColor, GetNeighbourhoodAverageColor(point), m_neighbourMixFactor);
       break;
     case SIMI_NO_NEIGHBOURS:
       pointColor = point.GetSimi()->GetColor();
@@ -296,8 +300,8 @@ auto LowDensityBlurrer::GetPointColor(const IfsPoint& point,
     case SIMI_WITH_NEIGHBOURS:
     {
       const auto simiColor = point.GetSimi()->GetColor();
-      const auto mixedPointColor =
-          GetMixedPointColor(simiColor, point, neighbours, brightness, logAlpha);
+      const auto mixedPointColor = GetMixedPointColor(
+          simiColor, point, GetNeighbourhoodAverageColor(point), brightness, logAlpha);
       pointColor = mixedPointColor;
       break;
     }
@@ -307,8 +311,8 @@ auto LowDensityBlurrer::GetPointColor(const IfsPoint& point,
     case SMOOTH_WITH_NEIGHBOURS:
     {
       const auto simiSmoothColor = point.GetSimi()->GetColorMap().GetColor(t);
-      const auto mixedPointColor =
-          GetMixedPointColor(simiSmoothColor, point, neighbours, brightness, logAlpha);
+      const auto mixedPointColor = GetMixedPointColor(
+          simiSmoothColor, point, GetNeighbourhoodAverageColor(point), brightness, logAlpha);
       pointColor = mixedPointColor;
       break;
     }
@@ -342,15 +346,13 @@ inline auto LowDensityBlurrer::GetBrightness() const noexcept -> float
 
 inline auto LowDensityBlurrer::GetMixedPointColor(const Pixel& baseColor,
                                                   const IfsPoint& point,
-                                                  const std::vector<Pixel>& neighbours,
+                                                  const Pixel& neighbourhoodAverageColor,
                                                   const float brightness,
                                                   const float logAlpha) const noexcept -> Pixel
 {
   const auto fx = static_cast<float>(point.GetX()) / m_draw->GetDimensions().GetFltWidth();
   const auto fy = static_cast<float>(point.GetY()) / m_draw->GetDimensions().GetFltHeight();
 
-  const auto neighbourhoodAverageColor = GetColorAverage(neighbours.size(), neighbours);
-
   const auto baseAndNeighbourhoodMixedColor =
       ColorMaps::GetColorMix(baseColor, neighbourhoodAverageColor, m_neighbourMixFactor);
 
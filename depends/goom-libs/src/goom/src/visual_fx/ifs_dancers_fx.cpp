@@ -41,6 +41,8 @@ module;
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <memory_resource>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -49,9 +51,11 @@ module Goom.VisualFx.IfsDancersFx;
 import Goom.Color.RandomColorMaps;
 import Goom.Draw.ShapeDrawers.BitmapDrawer;
 import Goom.Draw.ShaperDrawers.PixelDrawer;
+import Goom.Utils.FrameArena;
 import Goom.Utils.Graphics.SmallImageBitmaps;
 import Goom.Utils.Math.TValues;
 import Goom.Utils.Math.GoomRand;
+import Goom.Utils.Parallel;
 import Goom.VisualFx.FxHelper;
 import Goom.VisualFx.FxUtils;
 import Goom.Lib.GoomGraphic;
@@ -77,11 +81,14 @@ using UTILS::GRAPHICS::SmallImageBitmaps;
 using UTILS::MATH::NumberRange;
 using UTILS::MATH::TValue;
 using UTILS::MATH::Weights;
+using UTILS::Parallel;
 
 class IfsDancersFx::IfsDancersFxImpl
 {
 public:
-  IfsDancersFxImpl(FxHelper& fxHelper, const SmallImageBitmaps& smallBitmaps) noexcept;
+  IfsDancersFxImpl(Parallel& parallel,
+                   FxHelper& fxHelper,
+                   const SmallImageBitmaps& smallBitmaps) noexcept;
 
   auto Start() noexcept -> void;
 
@@ -147,11 +154,11 @@ private:
   auto DrawLowDensityPoints(size_t numPointsAlreadyDrawn,
                             const std::vector<IfsPoint>& points) noexcept -> void;
   [[nodiscard]] auto BlurTheLowDensityPoints(
-      size_t numPointsAlreadyDrawn, const std::vector<IfsPoint>& lowDensityPoints) const noexcept
+      size_t numPointsAlreadyDrawn, std::span<const IfsPoint> lowDensityPoints) const noexcept
       -> bool;
-  auto DrawLowDensityPointsWithoutBlur(const std::vector<IfsPoint>& lowDensityPoints,
+  auto DrawLowDensityPointsWithoutBlur(std::span<const IfsPoint> lowDensityPoints,
                                        uint32_t maxLowDensityCount) noexcept -> void;
-  auto DrawLowDensityPointsWithBlur(std::vector<IfsPoint>& lowDensityPoints,
+  auto DrawLowDensityPointsWithBlur(std::span<IfsPoint> lowDensityPoints,
                                     uint32_t maxLowDensityCount) noexcept -> void;
   auto UpdateLowDensityBlurThreshold() noexcept -> void;
   [[nodiscard]] auto GetNewBlurWidth() const noexcept -> uint32_t;
@@ -161,8 +168,10 @@ private:
   Weights<BlurrerColorMode> m_blurrerColorModeWeights;
 };
 
-IfsDancersFx::IfsDancersFx(FxHelper& fxHelper, const SmallImageBitmaps& smallBitmaps) noexcept
-  : m_pimpl{spimpl::make_unique_impl<IfsDancersFxImpl>(fxHelper, smallBitmaps)}
+IfsDancersFx::IfsDancersFx(Parallel& parallel,
+                           FxHelper& fxHelper,
+                           const SmallImageBitmaps& smallBitmaps) noexcept
+  : m_pimpl{spimpl::make_unique_impl<IfsDancersFxImpl>(parallel, fxHelper, smallBitmaps)}
 {
 }
 
@@ -223,14 +232,16 @@ static constexpr auto BLURRER_COLOR_MODE_SIMI_NO_NEIGHBOURS_WGT     = 005.0F;
 static constexpr auto BLURRER_COLOR_MODE_SINGLE_WITH_NEIGHBOURS_WGT = 001.0F;
 static constexpr auto BLURRER_COLOR_MODE_SINGLE_NO_NEIGHBOURS_WGT   = 005.0F;
 
-IfsDancersFx::IfsDancersFxImpl::IfsDancersFxImpl(FxHelper& fxHelper,
+IfsDancersFx::IfsDancersFxImpl::IfsDancersFxImpl(Parallel& parallel,
+                                                 FxHelper& fxHelper,
                                                  const SmallImageBitmaps& smallBitmaps) noexcept
   : m_fxHelper{&fxHelper},
     m_bitmapDrawer{fxHelper.GetDraw()},
     m_pixelDrawer{fxHelper.GetDraw()},
     m_colorizer{fxHelper.GetGoomRand(), m_defaultAlpha},
     m_pixelBlender{fxHelper.GetGoomRand()},
-    m_fractal{std::make_unique<Fractal>(fxHelper.GetDimensions(),
+    m_fractal{std::make_unique<Fractal>(parallel,
+                                        fxHelper.GetDimensions(),
                                         fxHelper.GetGoomRand(),
                                         smallBitmaps)},
     m_blurrer{fxHelper.GetDraw(), fxHelper.GetGoomRand(), BLUR_WIDTH, m_colorizer, smallBitmaps},
@@ -519,10 +530,14 @@ inline auto IfsDancersFx::IfsDancersFxImpl::DrawLowDensityPoints(
   }
 
   const auto numPoints    = points.size();
+  const auto ifsIncr      = static_cast<uint32_t>(m_ifsIncr);
   auto maxLowDensityCount = 0U;
-  auto lowDensityPoints   = std::vector<IfsPoint>{};
+  // Only needed for this frame. Reserved up front - the arena never gets back the blocks
+  // a growing vector lets go of.
+  auto lowDensityPoints = std::pmr::vector<IfsPoint>{&m_fxHelper->GetFrameArena()};
+  lowDensityPoints.reserve((numPoints + (ifsIncr - 1)) / ifsIncr);
 
-  for (auto i = 0U; i < numPoints; i += static_cast<uint32_t>(m_ifsIncr))
+  for (auto i = 0U; i < numPoints; i += ifsIncr)
   {
     const auto& point = points[i];
 
@@ -547,7 +562,7 @@ inline auto IfsDancersFx::IfsDancersFxImpl::DrawLowDensityPoints(
 
 inline auto IfsDancersFx::IfsDancersFxImpl::BlurTheLowDensityPoints(
     const size_t numPointsAlreadyDrawn,
-    const std::vector<IfsPoint>& lowDensityPoints) const noexcept -> bool
+    const std::span<const IfsPoint> lowDensityPoints) const noexcept -> bool
 {
   if (0 == numPointsAlreadyDrawn)
   {
@@ -558,7 +573,7 @@ inline auto IfsDancersFx::IfsDancersFxImpl::BlurTheLowDensityPoints(
 }
 
 inline auto IfsDancersFx::IfsDancersFxImpl::DrawLowDensityPointsWithoutBlur(
-    const std::vector<IfsPoint>& lowDensityPoints, const uint32_t maxLowDensityCount) noexcept
+    const std::span<const IfsPoint> lowDensityPoints, const uint32_t maxLowDensityCount) noexcept
     -> void
 {
   const auto logMaxLowDensityCount = std::log(static_cast<float>(maxLowDensityCount));
@@ -579,7 +594,8 @@ inline auto IfsDancersFx::IfsDancersFxImpl::DrawLowDensityPointsWithoutBlur(
 }
 
 inline auto IfsDancersFx::IfsDancersFxImpl::DrawLowDensityPointsWithBlur(
-    std::vector<IfsPoint>& lowDensityPoints, const uint32_t maxLowDensityCount) noexcept -> void
+    const std::span<IfsPoint> lowDensityPoints, const uint32_t maxLowDensityCount) noexcept
+    -> void
 {
   if (static constexpr auto PROB_FIXED_MIX_FACTOR = 0.8F;
       m_fxHelper->GetGoomRand().ProbabilityOf<PROB_FIXED_MIX_FACTOR>())
@@ -7,6 +7,7 @@ export module Goom.VisualFx.IfsDancersFx;
 
 import Goom.Color.RandomColorMaps;
 import Goom.Utils.Graphics.SmallImageBitmaps;
+import Goom.Utils.Parallel;
 import Goom.VisualFx.FxHelper;
 import Goom.VisualFx.VisualFxBase;
 import Goom.Lib.GoomTypes;
@@ -32,7 +33,9 @@ public:
   };
 
   IfsDancersFx() noexcept = delete;
-  IfsDancersFx(FxHelper& fxHelper, const UTILS::GRAPHICS::SmallImageBitmaps& smallBitmaps) noexcept;
+  IfsDancersFx(UTILS::Parallel& parallel,
+               FxHelper& fxHelper,
+               const UTILS::GRAPHICS::SmallImageBitmaps& smallBitmaps) noexcept;
 
   [[nodiscard]] auto GetFxName() const noexcept -> std::string override;
 
@@ -0,0 +1,128 @@
+module;
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+
+module Goom.VisualFx.ImageFx.TiledChunks;
+
+import Goom.Draw.DirtyTiles;
+import Goom.Utils.Parallel;
+import Goom.Lib.GoomTypes;
+import Goom.Lib.Point2d;
+
+namespace GOOM::VISUAL_FX::IMAGE
+{
+
+using DRAW::TileGrid;
+using UTILS::Parallel;
+
+TiledChunks::TiledChunks(Parallel& parallel,
+                         const Dimensions& screenDimensions,
+                         const Dimensions& drawDimensions,
+                         const Dimensions& chunkDimensions) noexcept
+  : m_parallel{&parallel},
+    m_tileGrid{screenDimensions},
+    m_drawWidth{std::min(drawDimensions.GetIntWidth(), screenDimensions.GetIntWidth())},
+    m_drawHeight{std::min(drawDimensions.GetIntHeight(), screenDimensions.GetIntHeight())},
+    m_chunkWidth{chunkDimensions.GetIntWidth()},
+    m_chunkHeight{chunkDimensions.GetIntHeight()}
+{
+}
+
+auto TiledChunks::GetChunkTiles(const Point2dInt& chunkPosition) const noexcept -> ChunkTiles
+{
+  const auto xMin = std::max(chunkPosition.x, 0);
+  const auto xMax = std::min(chunkPosition.x + (m_chunkWidth - 1), m_drawWidth - 1);
+  const auto yMin = std::max(chunkPosition.y, 0);
+  const auto yMax = std::min(chunkPosition.y + (m_chunkHeight - 1), m_drawHeight - 1);
+  if ((xMin > xMax) or (yMin > yMax))
+  {
+    return {
+        .isVisible  = false,
+        .firstTileX = 0U,
+        .lastTileX  = 0U,
+        .firstTileY = 0U,
+        .lastTileY  = 0U,
+    };
+  }
+
+  return {
+      .isVisible  = true,
+      .firstTileX = static_cast<uint32_t>(xMin) >> TileGrid::TILE_SHIFT,
+      .lastTileX  = static_cast<uint32_t>(xMax) >> TileGrid::TILE_SHIFT,
+      .firstTileY = static_cast<uint32_t>(yMin) >> TileGrid::TILE_SHIFT,
+      .lastTileY  = static_cast<uint32_t>(yMax) >> TileGrid::TILE_SHIFT,
+  };
+}
+
+auto TiledChunks::BinChunksByTile(const std::span<const Point2dInt> chunkPositions) noexcept
+    -> void
+{
+  const auto numChunks        = static_cast<uint32_t>(chunkPositions.size());
+  const auto numTilesX        = m_tileGrid.GetNumTilesX();
+  const auto forEachChunkTile = [&numTilesX](const ChunkTiles& chunkTiles, const auto& func)
+  {
+    if (not chunkTiles.isVisible)
+    {
+      return;
+    }
+    for (auto tileY = chunkTiles.firstTileY; tileY <= chunkTiles.lastTileY; ++tileY)
+    {
+      for (auto tileX = chunkTiles.firstTileX; tileX <= chunkTiles.lastTileX; ++tileX)
+      {
+        func((tileY * numTilesX) + tileX);
+      }
+    }
+  };
+
+  // A counting sort - count the chunks in each tile, turn the counts into bin positions,
+  // then fill the bins in chunk order.
+  m_chunkTiles.resize(numChunks);
+  std::ranges::fill(m_tileBinEnds, 0U);
+  for (auto i = 0U; i < numChunks; ++i)
+  {
+    m_chunkTiles[i] = GetChunkTiles(chunkPositions[i]);
+    forEachChunkTile(m_chunkTiles[i],
+                     [this](const uint32_t tileIndex) { ++m_tileBinEnds[tileIndex]; });
+  }
+
+  m_tilesToDraw.clear();
+  auto binStart = 0U;
+  for (auto tileIndex = 0U; tileIndex < m_tileGrid.GetNumTiles(); ++tileIndex)
+  {
+    const auto numTileChunks = m_tileBinEnds[tileIndex];
+    if (numTileChunks > 0U)
+    {
+      m_tilesToDraw.emplace_back(tileIndex);
+    }
+    m_tileBinStarts[tileIndex] = binStart;
+    m_tileBinEnds[tileIndex]   = binStart;
+    binStart += numTileChunks;
+  }
+
+  m_binnedChunks.resize(binStart);
+  for (auto i = 0U; i < numChunks; ++i)
+  {
+    forEachChunkTile(m_chunkTiles[i],
+                     [this, &i](const uint32_t tileIndex)
+                     {
+                       m_binnedChunks[m_tileBinEnds[tileIndex]] = i;
+                       ++m_tileBinEnds[tileIndex];
+                     });
+  }
+}
+
+auto TiledChunks::GetDrawRect(const uint32_t tileIndex) const noexcept -> DrawRect
+{
+  const auto tileBounds = m_tileGrid.GetTileBounds(tileIndex);
+
+  return {
+      .xBegin = static_cast<int32_t>(tileBounds.xBegin),
+      .xEnd   = std::min(static_cast<int32_t>(tileBounds.xEnd), m_drawWidth),
+      .yBegin = static_cast<int32_t>(tileBounds.yBegin),
+      .yEnd   = std::min(static_cast<int32_t>(tileBounds.yEnd), m_drawHeight),
+  };
+}
+
+} // namespace GOOM::VISUAL_FX::IMAGE
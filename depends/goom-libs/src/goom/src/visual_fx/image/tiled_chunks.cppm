@@ -0,0 +1,121 @@
+module;
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+export module Goom.VisualFx.ImageFx.TiledChunks;
+
+import Goom.Draw.DirtyTiles;
+import Goom.Utils.Parallel;
+import Goom.Lib.GoomTypes;
+import Goom.Lib.Point2d;
+
+export namespace GOOM::VISUAL_FX::IMAGE
+{
+
+// Draws the pixels of same sized chunks, binned by the screen tiles the chunks cover. Each
+// tile only draws the chunk pixels inside it, so the tiles are drawn in parallel, no two
+// threads ever blend the same pixel, and the chunks in a tile are always drawn in chunk
+// order. The pixels are the same as drawing each whole chunk, one after the other.
+class TiledChunks
+{
+public:
+  // The chunk pixels are only drawn inside 'drawDimensions', from the top left of the screen.
+  TiledChunks(UTILS::Parallel& parallel,
+              const Dimensions& screenDimensions,
+              const Dimensions& drawDimensions,
+              const Dimensions& chunkDimensions) noexcept;
+
+  // 'chunkPositions' are the top left of each chunk. 'drawPixel(chunkIndex, chunkPoint, point)'
+  // is called for each chunk pixel to draw, where 'chunkPoint' is the pixel's place in its
+  // chunk.
+  template<typename DrawPixelFunc>
+  auto Draw(std::span<const Point2dInt> chunkPositions, const DrawPixelFunc& drawPixel) -> void;
+
+private:
+  UTILS::Parallel* m_parallel;
+  DRAW::TileGrid m_tileGrid;
+  int32_t m_drawWidth;
+  int32_t m_drawHeight;
+  int32_t m_chunkWidth;
+  int32_t m_chunkHeight;
+
+  struct ChunkTiles
+  {
+    bool isVisible;
+    // A chunk can straddle up to four tiles. The last tiles are inclusive.
+    uint32_t firstTileX;
+    uint32_t lastTileX;
+    uint32_t firstTileY;
+    uint32_t lastTileY;
+  };
+  struct DrawRect
+  {
+    int32_t xBegin;
+    int32_t xEnd;
+    int32_t yBegin;
+    int32_t yEnd;
+  };
+  std::vector<ChunkTiles> m_chunkTiles;
+  std::vector<uint32_t> m_tileBinStarts = std::vector<uint32_t>(m_tileGrid.GetNumTiles());
+  std::vector<uint32_t> m_tileBinEnds   = std::vector<uint32_t>(m_tileGrid.GetNumTiles());
+  std::vector<uint32_t> m_binnedChunks;
+  std::vector<uint32_t> m_tilesToDraw;
+  [[nodiscard]] auto GetChunkTiles(const Point2dInt& chunkPosition) const noexcept -> ChunkTiles;
+  auto BinChunksByTile(std::span<const Point2dInt> chunkPositions) noexcept -> void;
+  [[nodiscard]] auto GetDrawRect(uint32_t tileIndex) const noexcept -> DrawRect;
+  template<typename DrawPixelFunc>
+  auto DrawTile(std::span<const Point2dInt> chunkPositions,
+                uint32_t tileIndex,
+                const DrawPixelFunc& drawPixel) const -> void;
+};
+
+} // namespace GOOM::VISUAL_FX::IMAGE
+
+namespace GOOM::VISUAL_FX::IMAGE
+{
+
+template<typename DrawPixelFunc>
+auto TiledChunks::Draw(const std::span<const Point2dInt> chunkPositions,
+                       const DrawPixelFunc& drawPixel) -> void
+{
+  BinChunksByTile(chunkPositions);
+
+  m_parallel->ForLoop(m_tilesToDraw.size(),
+                      [this, &chunkPositions, &drawPixel](const size_t i)
+                      { DrawTile(chunkPositions, m_tilesToDraw[i], drawPixel); });
+}
+
+template<typename DrawPixelFunc>
+auto TiledChunks::DrawTile(const std::span<const Point2dInt> chunkPositions,
+                           const uint32_t tileIndex,
+                           const DrawPixelFunc& drawPixel) const -> void
+{
+  const auto drawRect = GetDrawRect(tileIndex);
+
+  for (auto binPos = m_tileBinStarts[tileIndex]; binPos < m_tileBinEnds[tileIndex]; ++binPos)
+  {
+    const auto chunkIndex     = m_binnedChunks[binPos];
+    const auto& chunkPosition = chunkPositions[chunkIndex];
+
+    const auto yBegin = std::max(chunkPosition.y, drawRect.yBegin);
+    const auto yEnd   = std::min(chunkPosition.y + m_chunkHeight, drawRect.yEnd);
+    const auto xBegin = std::max(chunkPosition.x, drawRect.xBegin);
+    const auto xEnd   = std::min(chunkPosition.x + m_chunkWidth, drawRect.xEnd);
+
+    for (auto y = yBegin; y < yEnd; ++y)
+    {
+      for (auto x = xBegin; x < xEnd; ++x)
+      {
+        drawPixel(chunkIndex,
+                  Point2dInt{.x = x - chunkPosition.x, .y = y - chunkPosition.y},
+                  Point2dInt{.x = x, .y = y});
+      }
+    }
+  }
+}
+
+} // namespace GOOM::VISUAL_FX::IMAGE
@@ -28,6 +28,7 @@ import Goom.Utils.Math.Misc;
 import Goom.Utils.Math.TValues;
 import Goom.VisualFx.FxHelper;
 import Goom.VisualFx.FxUtils;
+import Goom.VisualFx.ImageFx.TiledChunks;
 import Goom.Lib.AssertUtils;
 import Goom.Lib.GoomConfigPaths;
 import Goom.Lib.GoomGraphic;
@@ -49,6 +50,7 @@ using COLOR::WeightedRandomColorMaps;
 using DRAW::MultiplePixels;
 using DRAW::SHAPE_DRAWERS::PixelDrawer;
 using FX_UTILS::RandomPixelBlender;
+using IMAGE::TiledChunks;
 using UTILS::Parallel;
 using UTILS::GRAPHICS::ImageBitmap;
 using UTILS::MATH::FULL_CIRCLE_RANGE;
@@ -175,16 +177,32 @@ private:
   };
   auto InitImage() -> void;
 
+  // The color map colors of the current image's chunk pixels. They only change when the
+  // image or the color map changes, so there's no need to work them out every frame.
+  std::vector<ChunkPixels> m_mappedChunkPixels;
+  auto UpdateMappedChunkPixels() -> void;
+
+  // The chunks are drawn by screen tile, in parallel.
+  std::vector<Point2dInt> m_chunkPositions;
+  std::vector<float> m_chunkBrightnesses;
+  TiledChunks m_tiledChunks{
+      *m_parallel,
+      m_fxHelper->GetDimensions(),
+      {static_cast<uint32_t>(m_availableWidth), static_cast<uint32_t>(m_availableHeight)},
+      {CHUNK_WIDTH, CHUNK_HEIGHT}
+  };
   auto DrawChunks() -> void;
   [[nodiscard]] auto GetPositionAdjustedBrightness(float brightness,
                                                    const Point2dInt& position) const -> float;
-  auto DrawChunk(const Point2dInt& pos, float brightness, const ChunkPixels& pixels) -> void;
+  auto DrawChunkPixel(uint32_t chunkIndex, const Point2dInt& chunkPoint, const Point2dInt& point)
+      -> void;
   [[nodiscard]] auto GetNextChunkStartPosition(size_t i) const -> Point2dInt;
   [[nodiscard]] auto GetNextChunkPosition(const Point2dInt& nextStartPosition,
                                           const ChunkedImage::ImageChunk& imageChunk) const
       -> Point2dInt;
-  [[nodiscard]] auto GetPixelColors(const Pixel& pixelColor, float brightness) const
-      -> MultiplePixels;
+  [[nodiscard]] auto GetPixelColors(const Pixel& pixelColor,
+                                    const Pixel& mappedColor,
+                                    float brightness) const -> MultiplePixels;
   [[nodiscard]] auto GetMappedColor(const Pixel& pixelColor) const -> Pixel;
 
   auto UpdateImageStartPositions() -> void;
@@ -316,6 +334,7 @@ inline auto ImageFx::ImageFxImpl::Start() -> void
 {
   InitImage();
   ResetCurrentImage();
+  UpdateMappedChunkPixels();
   ResetStartPositions();
   SetNewFloatingStartPosition();
 }
@@ -443,23 +462,24 @@ inline auto ImageFx::ImageFxImpl::DrawChunks() -> void
   const auto brightness =
       inOutT > IN_OUT_CLOSE_TO_RESOLVED_IMAGE ? 0.0F : m_brightnessBase + (IN_OUT_FACTOR * inOutT);
 
-  const auto drawChunk = [this, &brightness](const size_t i)
-  {
-    const auto nextStartPosition  = GetNextChunkStartPosition(i);
-    const auto& imageChunk        = m_currentImage->GetImageChunk(i);
-    const auto nextChunkPosition  = GetNextChunkPosition(nextStartPosition, imageChunk);
-    const auto adjustedBrightness = GetPositionAdjustedBrightness(brightness, nextChunkPosition);
-    DrawChunk(nextChunkPosition, adjustedBrightness, imageChunk.pixels);
-  };
-
-  m_parallel->ForLoop(m_currentImage->GetNumChunks(), drawChunk);
-
-  /*** 3 times slower
-  for (auto i = 0U; i < m_currentImage->GetNumChunks(); ++i)
-  {
-    drawChunk(i);
-  }
-   **/
+  const auto numChunks = m_currentImage->GetNumChunks();
+  m_chunkPositions.resize(numChunks);
+  m_chunkBrightnesses.resize(numChunks);
+  m_parallel->ForLoop(numChunks,
+                      [this, &brightness](const size_t i)
+                      {
+                        const auto nextStartPosition = GetNextChunkStartPosition(i);
+                        const auto& imageChunk       = m_currentImage->GetImageChunk(i);
+                        m_chunkPositions[i] = GetNextChunkPosition(nextStartPosition, imageChunk);
+                        m_chunkBrightnesses[i] =
+                            GetPositionAdjustedBrightness(brightness, m_chunkPositions[i]);
+                      });
+
+  m_tiledChunks.Draw(m_chunkPositions,
+                     [this](const uint32_t chunkIndex,
+                            const Point2dInt& chunkPoint,
+                            const Point2dInt& point)
+                     { DrawChunkPixel(chunkIndex, chunkPoint, point); });
 }
 
 inline auto ImageFx::ImageFxImpl::GetPositionAdjustedBrightness(const float brightness,
@@ -492,9 +512,30 @@ inline auto ImageFx::ImageFxImpl::UpdateImageStartPositions() -> void
     SetNewFloatingStartPosition();
     m_floatingT.Reset(1.0F);
     m_currentColorMap = GetRandomColorMap();
+    UpdateMappedChunkPixels();
   }
 }
 
+auto ImageFx::ImageFxImpl::UpdateMappedChunkPixels() -> void
+{
+  const auto numChunks = m_currentImage->GetNumChunks();
+
+  m_mappedChunkPixels.resize(numChunks);
+  m_parallel->ForLoop(numChunks,
+                      [this](const size_t i)
+                      {
+                        const auto& pixels = m_currentImage->GetImageChunk(i).pixels;
+                        auto& mappedPixels = m_mappedChunkPixels[i];
+                        for (auto y = 0U; y < CHUNK_HEIGHT; ++y)
+                        {
+                          for (auto x = 0U; x < CHUNK_WIDTH; ++x)
+                          {
+                            mappedPixels.at(y).at(x) = GetMappedColor(pixels.at(y).at(x));
+                          }
+                        }
+                      });
+}
+
 inline auto ImageFx::ImageFxImpl::GetNextChunkStartPosition(const size_t i) const -> Point2dInt
 {
   return lerp(m_currentImage->GetStartPosition(i),
@@ -510,44 +551,26 @@ inline auto ImageFx::ImageFxImpl::GetNextChunkPosition(
   return nextChunkPosition;
 }
 
-auto ImageFx::ImageFxImpl::DrawChunk(const Point2dInt& pos,
-                                     const float brightness,
-                                     const ChunkPixels& pixels) -> void
-
+inline auto ImageFx::ImageFxImpl::DrawChunkPixel(const uint32_t chunkIndex,
+                                                const Point2dInt& chunkPoint,
+                                                const Point2dInt& point) -> void
 {
-  auto y = pos.y;
-  for (auto i = 0U; i < CHUNK_HEIGHT; ++i)
-  {
-    const auto& pixelRow = pixels.at(i);
+  const auto x            = static_cast<size_t>(chunkPoint.x);
+  const auto y            = static_cast<size_t>(chunkPoint.y);
+  const auto& pixelColor  = m_currentImage->GetImageChunk(chunkIndex).pixels.at(y).at(x);
+  const auto& mappedColor = m_mappedChunkPixels[chunkIndex].at(y).at(x);
 
-    auto x = pos.x;
-    for (const auto& xPixel : pixelRow)
-    {
-      if ((x < 0) || (x >= m_availableWidth))
-      {
-        continue;
-      }
-      if ((y < 0) || (y >= m_availableHeight))
-      {
-        continue;
-      }
-      const auto pixelColors = GetPixelColors(xPixel, brightness);
-      m_pixelDrawer.DrawPixels({.x = x, .y = y}, pixelColors);
-
-      ++x;
-    }
-
-    ++y;
-  }
+  m_pixelDrawer.DrawPixels(
+      point, GetPixelColors(pixelColor, mappedColor, m_chunkBrightnesses[chunkIndex]));
 }
 
 inline auto ImageFx::ImageFxImpl::GetPixelColors(const Pixel& pixelColor,
+                                                 const Pixel& mappedColor,
                                                  const float brightness) const -> MultiplePixels
 {
-  const auto mixedColor =
-      ColorMaps::GetColorMix(GetMappedColor(pixelColor), pixelColor, m_inOutTSq);
-  const auto color0 = GetBrighterColor(brightness, mixedColor);
-  const auto color1 = GetBrighterColor(0.5F * brightness, pixelColor);
+  const auto mixedColor = ColorMaps::GetColorMix(mappedColor, pixelColor, m_inOutTSq);
+  const auto color0     = GetBrighterColor(brightness, mixedColor);
+  const auto color1     = GetBrighterColor(0.5F * brightness, pixelColor);
 
   if (m_pixelColorIsDominant)
   {
@@ -0,0 +1,94 @@
+module;
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+
+module Goom.VisualFx.ParticlesFx.Particles.TiledSplats;
+
+import Goom.Draw.DirtyTiles;
+import Goom.Utils.Parallel;
+import Goom.Lib.GoomTypes;
+
+namespace GOOM::VISUAL_FX::PARTICLES
+{
+
+using DRAW::TileGrid;
+using UTILS::Parallel;
+
+TiledSplats::TiledSplats(Parallel& parallel, const Dimensions& dimensions) noexcept
+  : m_parallel{&parallel}, m_tileGrid{dimensions}
+{
+}
+
+auto TiledSplats::GetSplatTiles(const Splat& splat) const noexcept -> SplatTiles
+{
+  const auto radius = splat.isCircle ? CIRCLE_RADIUS : 0;
+
+  const auto xMin = std::max(splat.centre.x - radius, 0);
+  const auto xMax = std::min(splat.centre.x + radius, m_tileGrid.GetDimensions().GetIntWidth() - 1);
+  const auto yMin = std::max(splat.centre.y - radius, 0);
+  const auto yMax =
+      std::min(splat.centre.y + radius, m_tileGrid.GetDimensions().GetIntHeight() - 1);
+
+  return {
+      .firstTileX = static_cast<uint32_t>(xMin) >> TileGrid::TILE_SHIFT,
+      .lastTileX  = static_cast<uint32_t>(xMax) >> TileGrid::TILE_SHIFT,
+      .firstTileY = static_cast<uint32_t>(yMin) >> TileGrid::TILE_SHIFT,
+      .lastTileY  = static_cast<uint32_t>(yMax) >> TileGrid::TILE_SHIFT,
+  };
+}
+
+auto TiledSplats::BinSplatsByTile(const std::span<const Splat> splats) noexcept -> void
+{
+  const auto numSplats        = static_cast<uint32_t>(splats.size());
+  const auto numTilesX        = m_tileGrid.GetNumTilesX();
+  const auto forEachSplatTile = [&numTilesX](const SplatTiles& splatTiles, const auto& func)
+  {
+    for (auto tileY = splatTiles.firstTileY; tileY <= splatTiles.lastTileY; ++tileY)
+    {
+      for (auto tileX = splatTiles.firstTileX; tileX <= splatTiles.lastTileX; ++tileX)
+      {
+        func((tileY * numTilesX) + tileX);
+      }
+    }
+  };
+
+  // A counting sort - count the splats in each tile, turn the counts into bin positions,
+  // then fill the bins in splat order, so the splats in a tile keep their order.
+  m_splatTiles.resize(numSplats);
+  std::ranges::fill(m_tileBinEnds, 0U);
+  for (auto i = 0U; i < numSplats; ++i)
+  {
+    m_splatTiles[i] = GetSplatTiles(splats[i]);
+    forEachSplatTile(m_splatTiles[i],
+                     [this](const uint32_t tileIndex) { ++m_tileBinEnds[tileIndex]; });
+  }
+
+  m_tilesToDraw.clear();
+  auto binStart = 0U;
+  for (auto tileIndex = 0U; tileIndex < m_tileGrid.GetNumTiles(); ++tileIndex)
+  {
+    const auto numTileSplats = m_tileBinEnds[tileIndex];
+    if (numTileSplats > 0U)
+    {
+      m_tilesToDraw.emplace_back(tileIndex);
+    }
+    m_tileBinStarts[tileIndex] = binStart;
+    m_tileBinEnds[tileIndex]   = binStart;
+    binStart += numTileSplats;
+  }
+
+  m_binnedSplats.resize(binStart);
+  for (auto i = 0U; i < numSplats; ++i)
+  {
+    forEachSplatTile(m_splatTiles[i],
+                     [this, &i](const uint32_t tileIndex)
+                     {
+                       m_binnedSplats[m_tileBinEnds[tileIndex]] = i;
+                       ++m_tileBinEnds[tileIndex];
+                     });
+  }
+}
+
+} // namespace GOOM::VISUAL_FX::PARTICLES
@@ -0,0 +1,184 @@
+module;
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+export module Goom.VisualFx.ParticlesFx.Particles.TiledSplats;
+
+import Goom.Draw.DirtyTiles;
+import Goom.Draw.GoomDrawBase;
+import Goom.Draw.ShaperDrawers.CircleDrawer;
+import Goom.Draw.ShaperDrawers.PixelDrawer;
+import Goom.Utils.Parallel;
+import Goom.Lib.GoomGraphic;
+import Goom.Lib.GoomTypes;
+import Goom.Lib.Point2d;
+
+export namespace GOOM::VISUAL_FX::PARTICLES
+{
+
+// Draws particle splats - small filled circles or single pixels - binned by the screen tiles
+// they cover. Each tile only draws its own pixels, so the tiles are drawn in parallel, and
+// every pixel is still blended in splat order - the blends don't commute, so that order
+// matters. The pixels are the same as drawing the splats one after the other.
+class TiledSplats
+{
+public:
+  static constexpr auto CIRCLE_RADIUS = 4;
+  struct Splat
+  {
+    Point2dInt centre;
+    Pixel color;
+    bool isCircle;
+  };
+
+  TiledSplats(UTILS::Parallel& parallel, const Dimensions& dimensions) noexcept;
+
+  // 'DrawT' is IGoomDraw, or a GoomDrawTo for a fully inlined draw. The splat centres must be
+  // on the screen.
+  template<class DrawT>
+  auto Draw(DrawT& draw, std::span<const Splat> splats) noexcept -> void;
+
+private:
+  UTILS::Parallel* m_parallel;
+  DRAW::TileGrid m_tileGrid;
+
+  struct SplatTiles
+  {
+    // A circle can straddle up to four tiles. The last tiles are inclusive.
+    uint32_t firstTileX;
+    uint32_t lastTileX;
+    uint32_t firstTileY;
+    uint32_t lastTileY;
+  };
+  std::vector<SplatTiles> m_splatTiles;
+  std::vector<uint32_t> m_tileBinStarts = std::vector<uint32_t>(m_tileGrid.GetNumTiles());
+  std::vector<uint32_t> m_tileBinEnds   = std::vector<uint32_t>(m_tileGrid.GetNumTiles());
+  std::vector<uint32_t> m_binnedSplats;
+  std::vector<uint32_t> m_tilesToDraw;
+  [[nodiscard]] auto GetSplatTiles(const Splat& splat) const noexcept -> SplatTiles;
+  auto BinSplatsByTile(std::span<const Splat> splats) noexcept -> void;
+  template<class DrawT>
+  auto DrawTile(DrawT& draw, std::span<const Splat> splats, uint32_t tileIndex) noexcept
+      -> void;
+};
+
+} // namespace GOOM::VISUAL_FX::PARTICLES
+
+namespace GOOM::VISUAL_FX::PARTICLES
+{
+
+// Passes on only the pixels inside one tile. Spans are cut to the tile, and rows outside
+// it are dropped, so each pixel in the tile gets exactly the blends a plain draw gives it.
+template<class DrawT>
+class TileClippedDraw
+{
+public:
+  TileClippedDraw(DrawT& draw, const DRAW::TileGrid::TileBounds& tileBounds) noexcept;
+
+  [[nodiscard]] auto GetDimensions() const noexcept -> const Dimensions&;
+
+  auto DrawPixels(const Point2dInt& point, const DRAW::MultiplePixels& colors) noexcept
+      -> void;
+  auto DrawHorizontalSpan(const Point2dInt& start,
+                          uint32_t length,
+                          const DRAW::MultiplePixels& colors) noexcept -> void;
+
+private:
+  DrawT* m_draw;
+  int32_t m_xBegin;
+  int32_t m_xEnd;
+  int32_t m_yBegin;
+  int32_t m_yEnd;
+};
+
+template<class DrawT>
+TileClippedDraw<DrawT>::TileClippedDraw(DrawT& draw,
+                                        const DRAW::TileGrid::TileBounds& tileBounds) noexcept
+  : m_draw{&draw},
+    m_xBegin{static_cast<int32_t>(tileBounds.xBegin)},
+    m_xEnd{static_cast<int32_t>(tileBounds.xEnd)},
+    m_yBegin{static_cast<int32_t>(tileBounds.yBegin)},
+    m_yEnd{static_cast<int32_t>(tileBounds.yEnd)}
+{
+}
+
+template<class DrawT>
+inline auto TileClippedDraw<DrawT>::GetDimensions() const noexcept -> const Dimensions&
+{
+  return m_draw->GetDimensions();
+}
+
+template<class DrawT>
+inline auto TileClippedDraw<DrawT>::DrawPixels(const Point2dInt& point,
+                                               const DRAW::MultiplePixels& colors) noexcept
+    -> void
+{
+  if ((point.x < m_xBegin) or (point.x >= m_xEnd) or (point.y < m_yBegin) or
+      (point.y >= m_yEnd))
+  {
+    return;
+  }
+  m_draw->DrawPixels(point, colors);
+}
+
+template<class DrawT>
+inline auto TileClippedDraw<DrawT>::DrawHorizontalSpan(
+    const Point2dInt& start, const uint32_t length, const DRAW::MultiplePixels& colors) noexcept
+    -> void
+{
+  if ((start.y < m_yBegin) or (start.y >= m_yEnd))
+  {
+    return;
+  }
+  const auto xBegin = std::max(start.x, m_xBegin);
+  const auto xEnd   = std::min(start.x + static_cast<int32_t>(length), m_xEnd);
+  if (xBegin >= xEnd)
+  {
+    return;
+  }
+  m_draw->DrawHorizontalSpan(
+      {.x = xBegin, .y = start.y}, static_cast<uint32_t>(xEnd - xBegin), colors);
+}
+
+template<class DrawT>
+auto TiledSplats::Draw(DrawT& draw, const std::span<const Splat> splats) noexcept -> void
+{
+  BinSplatsByTile(splats);
+
+  m_parallel->ForLoop(m_tilesToDraw.size(),
+                      [this, &draw, &splats](const size_t i)
+                      { DrawTile(draw, splats, m_tilesToDraw[i]); });
+}
+
+template<class DrawT>
+auto TiledSplats::DrawTile(DrawT& draw,
+                           const std::span<const Splat> splats,
+                           const uint32_t tileIndex) noexcept -> void
+{
+  static_assert((2 * CIRCLE_RADIUS) <= static_cast<int32_t>(DRAW::TileGrid::TILE_SIZE));
+
+  auto tileDraw     = TileClippedDraw<DrawT>{draw, m_tileGrid.GetTileBounds(tileIndex)};
+  auto circleDrawer = DRAW::SHAPE_DRAWERS::BasicCircleDrawer<TileClippedDraw<DrawT>>{tileDraw};
+  auto pixelDrawer  = DRAW::SHAPE_DRAWERS::BasicPixelDrawer<TileClippedDraw<DrawT>>{tileDraw};
+
+  for (auto i = m_tileBinStarts[tileIndex]; i < m_tileBinEnds[tileIndex]; ++i)
+  {
+    const auto& splat = splats[m_binnedSplats[i]];
+    const auto colors = DRAW::MultiplePixels{.color1 = splat.color, .color2 = splat.color};
+
+    if (splat.isCircle)
+    {
+      circleDrawer.DrawFilledCircle(splat.centre, CIRCLE_RADIUS, colors);
+    }
+    else
+    {
+      pixelDrawer.DrawPixelsClipped(splat.centre, colors);
+    }
+  }
+}
+
+} // namespace GOOM::VISUAL_FX::PARTICLES
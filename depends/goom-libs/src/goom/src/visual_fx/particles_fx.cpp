@@ -5,10 +5,12 @@ module;
 #include "goom/goom_logger.h"
 
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <glm/ext/vector_float3.hpp>
 #include <glm/ext/vector_float4.hpp>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -16,14 +18,17 @@ module Goom.VisualFx.ParticlesFx;
 
 import Particles.Effect;
 import Goom.VisualFx.ParticlesFx.Particles.AttractorEffect;
+import Goom.VisualFx.ParticlesFx.Particles.TiledSplats;
 import Goom.Color.ColorAdjustment;
 import Goom.Color.ColorMaps;
 import Goom.Color.ColorUtils;
 import Goom.Color.RandomColorMaps;
 import Goom.Draw.GoomDrawBase;
-import Goom.Draw.ShaperDrawers.CircleDrawer;
-import Goom.Draw.ShaperDrawers.PixelDrawer;
+import Goom.Draw.GoomDrawTo;
+import Goom.Draw.GoomDrawToBuffer;
+import Goom.Draw.GoomDrawToLayer;
 import Goom.Utils.Graphics.Camera;
+import Goom.Utils.Graphics.PixelBlend;
 import Goom.Utils.Graphics.PixelUtils;
 import Goom.Utils.Graphics.PointUtils;
 import Goom.Utils.Graphics.SmallImageBitmaps;
@@ -32,6 +37,7 @@ import Goom.Utils.Math.IncrementedValues;
 import Goom.Utils.Math.TValues;
 import Goom.Utils.Math.Misc;
 import Goom.Utils.GoomTime;
+import Goom.Utils.Parallel;
 import Goom.VisualFx.FxHelper;
 import Goom.VisualFx.FxUtils;
 import Goom.Lib.AssertUtils;
@@ -46,15 +52,19 @@ namespace GOOM::VISUAL_FX
 using COLOR::ColorAdjustment;
 using COLOR::ColorMapPtrWrapper;
 using COLOR::WeightedRandomColorMaps;
+using DRAW::GoomDrawTo;
+using DRAW::GoomDrawToLayer;
+using DRAW::GoomDrawToTwoBuffers;
 using DRAW::IGoomDraw;
-using DRAW::SHAPE_DRAWERS::CircleDrawer;
-using DRAW::SHAPE_DRAWERS::PixelDrawer;
+using DRAW::TransparentBgnd;
 using FX_UTILS::RandomPixelBlender;
 using PARTICLES::AttractorEffect;
+using PARTICLES::TiledSplats;
 using ::PARTICLES::EFFECTS::IEffect;
 using UTILS::GRAPHICS::Camera;
 using UTILS::GRAPHICS::GetPointClippedToRectangle;
 using UTILS::GRAPHICS::MakePixel;
+using UTILS::GRAPHICS::PixelBlendRowType;
 using UTILS::GRAPHICS::SmallImageBitmaps;
 using UTILS::MATH::GoomRand;
 using UTILS::MATH::IncrementedValue;
@@ -62,6 +72,8 @@ using UTILS::MATH::NumberRange;
 using UTILS::MATH::TValue;
 using UTILS::MATH::TWO_PI;
 using UTILS::MATH::U_HALF;
+using UTILS::Parallel;
+using UTILS::TaskPriority;
 
 // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access): glm problem
 
@@ -87,6 +99,9 @@ public:
            const Camera& camera) noexcept;
 
   auto SetDrawCircleFrequency(uint32_t drawCircleFrequency) noexcept -> void;
+  // The row type of the blend func set in the draw, if it has one.
+  auto SetPixelBlendRowType(std::optional<PixelBlendRowType> pixelBlendRowType) noexcept
+      -> void;
 
   auto UpdateFrame(const IEffect& effect) noexcept -> void;
 
@@ -101,7 +116,10 @@ public:
 
 private:
   IGoomDraw* m_draw;
+  GoomDrawToLayer* m_layerDraw;
+  GoomDrawToTwoBuffers* m_buffersDraw;
   [[maybe_unused]] GoomLogger* m_goomLogger;
+  Parallel m_parallel{TaskPriority::FRAME_CRITICAL};
   uint64_t m_numSkippedNegativeParticles = 0U;
   uint64_t m_numSkippedTooBigParticles   = 0U;
   uint32_t m_drawCircleFrequency         = 1U;
@@ -115,7 +133,27 @@ private:
 
   const Camera* m_camera;
 
-  [[nodiscard]] auto GetScreenPos(const glm::vec4& pos) const -> Point2dInt;
+  // A frame is drawn in passes over flat arrays. The alive particles are projected in one
+  // batch, the ones off the screen are dropped, the colors of the rest are adjusted, then
+  // the splats are drawn by screen tile, in parallel.
+  std::vector<glm::vec4> m_worldPositions;
+  std::vector<Point2dInt> m_screenPositions;
+  std::vector<uint32_t> m_splatParticles;
+  std::vector<TiledSplats::Splat> m_splats;
+  TiledSplats m_tiledSplats{m_parallel, m_draw->GetDimensions()};
+  auto ProjectParticles(const IEffect& effect) noexcept -> void;
+  auto ClipParticles() noexcept -> void;
+  auto SetSplats(const IEffect& effect) noexcept -> void;
+  [[nodiscard]] auto IsCircleSplat(uint32_t particle) const noexcept -> bool;
+
+  // Most frames, the blend has a row type and the draw blends straight into the buffers,
+  // not into a layer. Then the splats are drawn through a GoomDrawTo, so the circles inline
+  // down to the blend. Otherwise they're drawn through 'm_draw'. The pixels are the same.
+  std::optional<PixelBlendRowType> m_pixelBlendRowType = std::nullopt;
+  [[nodiscard]] auto GetDirectDestDraw() const noexcept -> GoomDrawToTwoBuffers*;
+  auto DrawSplats() noexcept -> void;
+  template<PixelBlendRowType BLEND_TYPE>
+  auto DrawSplatsTo(GoomDrawToTwoBuffers& destDraw) noexcept -> void;
 };
 
 class EffectFactory
@@ -189,7 +227,12 @@ Renderer::Renderer(IGoomDraw& draw,
                    GoomLogger& goomLogger,
                    const float brightness,
                    const Camera& camera) noexcept
-  : m_draw{&draw}, m_goomLogger{&goomLogger}, m_circleBrightness{brightness}, m_camera{&camera}
+  : m_draw{&draw},
+    m_layerDraw{dynamic_cast<GoomDrawToLayer*>(&draw)},
+    m_buffersDraw{dynamic_cast<GoomDrawToTwoBuffers*>(&draw)},
+    m_goomLogger{&goomLogger},
+    m_circleBrightness{brightness},
+    m_camera{&camera}
 {
 }
 
@@ -198,52 +241,137 @@ inline auto Renderer::SetDrawCircleFrequency(const uint32_t drawCircleFrequency)
   m_drawCircleFrequency = drawCircleFrequency;
 }
 
+inline auto Renderer::SetPixelBlendRowType(
+    const std::optional<PixelBlendRowType> pixelBlendRowType) noexcept -> void
+{
+  m_pixelBlendRowType = pixelBlendRowType;
+}
+
 auto Renderer::UpdateFrame(const IEffect& effect) noexcept -> void
 {
-  auto circleDrawer = CircleDrawer{*m_draw};
-  auto pixelDrawer  = PixelDrawer{*m_draw};
+  ProjectParticles(effect);
+  ClipParticles();
+  if (m_splatParticles.empty())
+  {
+    return;
+  }
+
+  SetSplats(effect);
+  DrawSplats();
+}
+
+auto Renderer::ProjectParticles(const IEffect& effect) noexcept -> void
+{
+  const auto& finalData   = effect.GetSystem().GetFinalData();
+  const auto numParticles = static_cast<size_t>(effect.GetSystem().GetNumAliveParticles());
+
+  m_worldPositions.resize(numParticles);
+  m_screenPositions.resize(numParticles);
 
-  for (auto i = 0U; i < effect.GetSystem().GetNumAliveParticles(); ++i)
+  for (auto i = 0U; i < numParticles; ++i)
   {
-    const auto pos       = effect.GetSystem().GetFinalData().GetPosition(i);
-    const auto color     = effect.GetSystem().GetFinalData().GetColor(i);
-    const auto screenPos = GetScreenPos(pos);
+    m_worldPositions[i] = finalData.GetPosition(i);
+  }
 
-    if ((screenPos.x < 0) or (screenPos.y < 0))
-    {
-      ++m_numSkippedTooBigParticles;
-      continue;
-    }
-    if ((screenPos.x >= m_draw->GetDimensions().GetIntWidth()) or
-        (screenPos.y >= m_draw->GetDimensions().GetIntHeight()))
+  m_camera->GetScreenPositions(m_worldPositions, m_screenPositions);
+}
+
+auto Renderer::ClipParticles() noexcept -> void
+{
+  const auto width  = m_draw->GetDimensions().GetIntWidth();
+  const auto height = m_draw->GetDimensions().GetIntHeight();
+
+  m_splatParticles.clear();
+
+  for (auto i = 0U; i < m_screenPositions.size(); ++i)
+  {
+    const auto& screenPos = m_screenPositions[i];
+    if ((screenPos.x < 0) or (screenPos.y < 0) or (screenPos.x >= width) or
+        (screenPos.y >= height))
     {
       ++m_numSkippedTooBigParticles;
       continue;
     }
+    m_splatParticles.emplace_back(i);
+  }
+}
 
-    const auto pixelColor = GetPixel(color);
+auto Renderer::SetSplats(const IEffect& effect) noexcept -> void
+{
+  const auto& finalData = effect.GetSystem().GetFinalData();
 
-    if (0 == (i % m_drawCircleFrequency))
-    {
-      const auto brighterPixelColor =
-          m_colorAdjustment.GetAdjustment(m_circleBrightness, pixelColor);
-      static constexpr auto RADIUS = 4;
-      circleDrawer.DrawFilledCircle(
-          screenPos, RADIUS, {.color1 = brighterPixelColor, .color2 = brighterPixelColor});
-    }
-    else
-    {
-      const auto brighterPixelColor =
-          m_colorAdjustment.GetAdjustment(m_pixelBrightness, pixelColor);
-      pixelDrawer.DrawPixelsClipped(screenPos,
-                                    {.color1 = brighterPixelColor, .color2 = brighterPixelColor});
-    }
+  m_splats.resize(m_splatParticles.size());
+
+  m_parallel.ForLoop(m_splatParticles.size(),
+                     [this, &finalData](const size_t i)
+                     {
+                       const auto particle   = m_splatParticles[i];
+                       const auto pixelColor = GetPixel(finalData.GetColor(particle));
+                       const auto isCircle   = IsCircleSplat(particle);
+                       const auto brightness = isCircle ? m_circleBrightness : m_pixelBrightness;
+
+                       m_splats[i] = {
+                           .centre   = m_screenPositions[particle],
+                           .color    = m_colorAdjustment.GetAdjustment(brightness, pixelColor),
+                           .isCircle = isCircle,
+                       };
+                     });
+}
+
+inline auto Renderer::IsCircleSplat(const uint32_t particle) const noexcept -> bool
+{
+  return 0 == (particle % m_drawCircleFrequency);
+}
+
+auto Renderer::GetDirectDestDraw() const noexcept -> GoomDrawToTwoBuffers*
+{
+  if (m_layerDraw != nullptr)
+  {
+    return m_layerDraw->IsDrawingToLayer() ? nullptr : &m_layerDraw->GetDestDraw();
+  }
+  return m_buffersDraw;
+}
+
+auto Renderer::DrawSplats() noexcept -> void
+{
+  auto* const destDraw = GetDirectDestDraw();
+  if ((destDraw == nullptr) or (not m_pixelBlendRowType.has_value()))
+  {
+    m_tiledSplats.Draw(*m_draw, m_splats);
+    return;
+  }
+
+  switch (*m_pixelBlendRowType)
+  {
+    case PixelBlendRowType::COLOR_ADD:
+      DrawSplatsTo<PixelBlendRowType::COLOR_ADD>(*destDraw);
+      break;
+    case PixelBlendRowType::DARKEN_ONLY:
+      DrawSplatsTo<PixelBlendRowType::DARKEN_ONLY>(*destDraw);
+      break;
+    case PixelBlendRowType::LIGHTEN_ONLY:
+      DrawSplatsTo<PixelBlendRowType::LIGHTEN_ONLY>(*destDraw);
+      break;
+    case PixelBlendRowType::COLOR_MULTIPLY:
+      DrawSplatsTo<PixelBlendRowType::COLOR_MULTIPLY>(*destDraw);
+      break;
+    case PixelBlendRowType::COLOR_ALPHA:
+      DrawSplatsTo<PixelBlendRowType::COLOR_ALPHA>(*destDraw);
+      break;
+    case PixelBlendRowType::COLOR_ALPHA_AND_ADD:
+      DrawSplatsTo<PixelBlendRowType::COLOR_ALPHA_AND_ADD>(*destDraw);
+      break;
   }
 }
 
-inline auto Renderer::GetScreenPos(const glm::vec4& pos) const -> Point2dInt
+// A layer draw has its own buffer intensity, so that's the one to use, not the dest draw's.
+template<PixelBlendRowType BLEND_TYPE>
+auto Renderer::DrawSplatsTo(GoomDrawToTwoBuffers& destDraw) noexcept -> void
 {
-  return m_camera->GetScreenPosition(pos);
+  auto draw = GoomDrawTo<2U, BLEND_TYPE, TransparentBgnd::USE_FGND>{destDraw};
+  draw.SetBuffIntensity(m_draw->GetBuffIntensity());
+
+  m_tiledSplats.Draw(draw, m_splats);
 }
 
 class ParticlesFx::ParticlesFxImpl
@@ -453,6 +581,7 @@ inline auto ParticlesFx::ParticlesFxImpl::ChangePixelBlender(
 inline auto ParticlesFx::ParticlesFxImpl::UpdatePixelBlender() noexcept -> void
 {
   m_fxHelper->GetDraw().SetPixelBlendFunc(m_pixelBlender.GetCurrentPixelBlendFunc());
+  m_renderer.SetPixelBlendRowType(m_pixelBlender.GetCurrentPixelBlendRowType());
   m_pixelBlender.Update();
 }
 
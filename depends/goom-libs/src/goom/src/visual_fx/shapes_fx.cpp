@@ -322,8 +322,6 @@ inline auto ShapesFx::ShapesFxImpl::Start() noexcept -> void
 
 inline auto ShapesFx::ShapesFxImpl::ApplyToImageBuffers() noexcept -> void
 {
-  m_fxHelper->GetBlend2dContexts().blend2dBuffersWereUsed = true;
-
   UpdatePixelBlender();
   UpdateShapeSpeeds();
   UpdateShapes();
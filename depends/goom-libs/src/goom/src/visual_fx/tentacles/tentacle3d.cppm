@@ -49,7 +49,9 @@ public:
   auto StartIterating() -> void;
 
   auto Iterate() -> void;
-  [[nodiscard]] auto GetTentacleVertices(const V3dFlt& startPosOffset) const -> std::vector<V3dFlt>;
+  // Replaces the contents of 'vertices', so a reused vector keeps its capacity.
+  auto GetTentacleVertices(const V3dFlt& startPosOffset, std::vector<V3dFlt>& vertices) const
+      -> void;
 
 private:
   std::unique_ptr<Tentacle2D> m_tentacle;
@@ -132,12 +134,13 @@ auto Tentacle3D::SetEndPosOffset(const V3dFlt& endPosOffset) noexcept -> void
   m_endPosOffset = endPosOffset;
 }
 
-auto Tentacle3D::GetTentacleVertices(const V3dFlt& startPosOffset) const -> std::vector<V3dFlt>
+auto Tentacle3D::GetTentacleVertices(const V3dFlt& startPosOffset,
+                                     std::vector<V3dFlt>& vertices) const -> void
 {
   const auto& [xVec2D, yVec2D] = m_tentacle->GetDampedXAndYVectors();
 
   const auto numPoints = xVec2D.size();
-  auto vec3d           = std::vector<V3dFlt>(numPoints);
+  vertices.resize(numPoints);
 
   const auto x0 = m_startPos.x + startPosOffset.x;
   const auto xn = m_endPos.x + m_endPosOffset.x;
@@ -152,15 +155,13 @@ auto Tentacle3D::GetTentacleVertices(const V3dFlt& startPosOffset) const -> std:
   auto y = y0;
   for (auto i = 0U; i < numPoints; ++i)
   {
-    vec3d[i].x = x;
-    vec3d[i].y = y + static_cast<float>(yVec2D[i]);
-    vec3d[i].z = z0 + static_cast<float>(xVec2D[i]);
+    vertices[i].x = x;
+    vertices[i].y = y + static_cast<float>(yVec2D[i]);
+    vertices[i].z = z0 + static_cast<float>(xVec2D[i]);
 
     x += xStep;
     y += yStep;
   }
-
-  return vec3d;
 }
 
 } // namespace GOOM::VISUAL_FX::TENTACLES
@@ -114,6 +114,11 @@ private:
                                                 const IterationParams& tentacleParams) noexcept
       -> std::unique_ptr<Tentacle2D>;
   uint32_t m_tentacleGroupSize = static_cast<uint32_t>(m_tentacles.size());
+  struct PlotColors
+  {
+    float dominantT;
+    const TentacleAndAttributes* tentacleAndAttributes;
+  };
   [[nodiscard]] auto GetMixedColors(float dominantT,
                                     float nodeT,
                                     const TentacleAndAttributes& tentacleAndAttributes,
@@ -478,9 +483,16 @@ auto TentacleDriver::DrawTentacles() noexcept -> void
     m_tentaclePlotter.SetTentacleLineThickness(GetLineThickness(i));
 
     static constexpr auto BRIGHTNESS = 10.0F;
+    const auto plotColors =
+        PlotColors{.dominantT = colorT(), .tentacleAndAttributes = &tentacleAndAttributes};
+    // Only two pointers are captured, so the function fits in the 'std::function' small
+    // buffer and setting it doesn't allocate.
     m_tentaclePlotter.SetGetColorsFunc(
-        [this, &colorT, &tentacleAndAttributes](const float nodeT)
-        { return GetMixedColors(colorT(), nodeT, tentacleAndAttributes, BRIGHTNESS); });
+        [this, &plotColors](const float nodeT)
+        {
+          return GetMixedColors(
+              plotColors.dominantT, nodeT, *plotColors.tentacleAndAttributes, BRIGHTNESS);
+        });
 
     // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks): Not sure why this is flagged???
     m_tentaclePlotter.Plot3D(tentacleAndAttributes.tentacle3D);
@@ -68,24 +68,20 @@ private:
   static_assert(CAMERA_Z_OFFSET_RANGE.min < CAMERA_Z_OFFSET_RANGE.max);
   V3dFlt m_cameraPosition{.x = 0.0F, .y = 0.0F, .z = CAMERA_Z_OFFSET_RANGE.min};
 
+  // Scratch buffers, reused for every tentacle, so plotting doesn't touch the heap once
+  // they've grown to the biggest tentacle.
+  std::vector<V3dFlt> m_points3D;
   auto PlotPoints(const std::vector<V3dFlt>& points3D) -> void;
   struct Line2DInt
   {
     Point2dInt point1;
     Point2dInt point2;
   };
-  [[nodiscard]] auto GetPerspectiveProjection(const std::vector<V3dFlt>& points3D) const
-      -> std::vector<Line2DInt>;
+  std::vector<Line2DInt> m_lines2D;
+  auto SetPerspectiveProjection(const std::vector<V3dFlt>& points3D) -> void;
   [[nodiscard]] auto GetPerspectivePoint(const V3dFlt& point3D) const -> Point2dFlt;
   [[nodiscard]] static auto GetLine2D(const Point2dFlt& point1Flt,
                                       const Point2dFlt& point2Flt) noexcept -> Line2DInt;
-  struct Line3DFlt
-  {
-    V3dFlt point1;
-    V3dFlt point2;
-  };
-  [[nodiscard]] static auto GetLines3D(const std::vector<V3dFlt>& points3D)
-      -> std::vector<Line3DFlt>;
 };
 
 } // namespace GOOM::VISUAL_FX::TENTACLES
@@ -140,16 +136,16 @@ inline auto TentaclePlotter::GetLineClipRectangle(const uint8_t lineThickness) c
 
 auto TentaclePlotter::Plot3D(const Tentacle3D& tentacle) noexcept -> void
 {
-  const auto points3D = tentacle.GetTentacleVertices(m_cameraPosition);
+  tentacle.GetTentacleVertices(m_cameraPosition, m_points3D);
 
-  PlotPoints(points3D);
+  PlotPoints(m_points3D);
 }
 
 inline auto TentaclePlotter::PlotPoints(const std::vector<V3dFlt>& points3D) -> void
 {
-  const auto lines2D = GetPerspectiveProjection(points3D);
+  SetPerspectiveProjection(points3D);
 
-  const auto numNodes = static_cast<uint32_t>(lines2D.size());
+  const auto numNodes = static_cast<uint32_t>(m_lines2D.size());
   if (0 == numNodes)
   {
     return;
@@ -160,7 +156,7 @@ inline auto TentaclePlotter::PlotPoints(const std::vector<V3dFlt>& points3D) ->
        .numSteps  = numNodes,
        .startingT = m_nodeTOffset}
   };
-  for (const auto& line : lines2D)
+  for (const auto& line : m_lines2D)
   {
     const auto colors = m_getColors(nodeT());
     m_lineDrawer.DrawLine(line.point1, line.point2, colors);
@@ -168,39 +164,41 @@ inline auto TentaclePlotter::PlotPoints(const std::vector<V3dFlt>& points3D) ->
   }
 
   static constexpr auto END_DOT_RADIUS = 1;
-  m_circleDrawer.DrawFilledCircle(lines2D.back().point2, END_DOT_RADIUS, m_endDotColors);
+  m_circleDrawer.DrawFilledCircle(m_lines2D.back().point2, END_DOT_RADIUS, m_endDotColors);
 }
 
-auto TentaclePlotter::GetPerspectiveProjection(const std::vector<V3dFlt>& points3D) const
-    -> std::vector<Line2DInt>
+// The lines between consecutive points are projected straight from the points, and each
+// point is only projected once.
+auto TentaclePlotter::SetPerspectiveProjection(const std::vector<V3dFlt>& points3D) -> void
 {
-  const auto lines3D = GetLines3D(points3D);
-
-  auto lines2D = std::vector<Line2DInt>{};
-  for (const auto& line3D : lines3D)
+  m_lines2D.clear();
+  if (points3D.size() < 2)
   {
-    if (static constexpr auto MIN_Z = 2.0F;
-        (line3D.point1.z <= MIN_Z) or (line3D.point2.z <= MIN_Z))
-    {
-      continue;
-    }
+    return;
+  }
 
-    const auto pointFlt1 = GetPerspectivePoint(line3D.point1);
-    const auto pointFlt2 = GetPerspectivePoint(line3D.point2);
+  // Points too close to the camera aren't projected - their lines are dropped anyway.
+  static constexpr auto MIN_Z    = 2.0F;
+  const auto getPerspectivePoint = [this](const V3dFlt& point3D)
+  { return (point3D.z <= MIN_Z) ? Point2dFlt{} : GetPerspectivePoint(point3D); };
 
-    const auto clippedLine =
-        m_lineClipper.GetClippedLine({.point1 = pointFlt1, .point2 = pointFlt2});
-    if (clippedLine.clipResult == LineClipper::ClipResult::REJECTED)
+  auto pointFlt1 = getPerspectivePoint(points3D[0]);
+  for (auto i = 1U; i < points3D.size(); ++i)
+  {
+    const auto pointFlt2 = getPerspectivePoint(points3D[i]);
+
+    if ((points3D[i - 1].z > MIN_Z) and (points3D[i].z > MIN_Z))
     {
-      continue;
+      const auto clippedLine =
+          m_lineClipper.GetClippedLine({.point1 = pointFlt1, .point2 = pointFlt2});
+      if (clippedLine.clipResult != LineClipper::ClipResult::REJECTED)
+      {
+        m_lines2D.emplace_back(GetLine2D(clippedLine.line.point1, clippedLine.line.point2));
+      }
     }
 
-    const auto line2D = GetLine2D(clippedLine.line.point1, clippedLine.line.point2);
-
-    lines2D.emplace_back(line2D);
+    pointFlt1 = pointFlt2;
   }
-
-  return lines2D;
 }
 
 inline auto TentaclePlotter::GetPerspectivePoint(const V3dFlt& point3D) const -> Point2dFlt
@@ -212,24 +210,6 @@ inline auto TentaclePlotter::GetPerspectivePoint(const V3dFlt& point3D) const ->
   return Point2dFlt{.x = xProj, .y = -yProj} + m_screenCentre;
 }
 
-inline auto TentaclePlotter::GetLines3D(const std::vector<V3dFlt>& points3D)
-    -> std::vector<Line3DFlt>
-{
-  auto lines3D = std::vector<Line3DFlt>{};
-  if (points3D.size() < 2)
-  {
-    return lines3D;
-  }
-
-  const auto numPointsMinus1 = points3D.size() - 1;
-  for (auto i = 0U; i < numPointsMinus1; ++i)
-  {
-    lines3D.emplace_back(Line3DFlt{.point1 = points3D[i], .point2 = points3D[i + 1]});
-  }
-
-  return lines3D;
-}
-
 inline auto TentaclePlotter::GetLine2D(const Point2dFlt& point1Flt,
                                        const Point2dFlt& point2Flt) noexcept -> Line2DInt
 {
@@ -748,14 +748,14 @@ inline auto TubesFx::TubeFxImpl::GetAverageColor(const GoomDrawToContainer::Colo
 {
   if (1 == colorsList.count)
   {
-    return colorsList.colorsArray[0];
+    return colorsList.colors[0];
   }
   if (0 == colorsList.count)
   {
     return BLACK_PIXEL;
   }
 
-  return GetColorAverage(colorsList.count, colorsList.colorsArray);
+  return GetColorAverage(colorsList.count, colorsList.colors);
 }
 
 inline auto TubesFx::TubeFxImpl::GetClipped(const int32_t val, const int32_t maxVal) -> int32_t
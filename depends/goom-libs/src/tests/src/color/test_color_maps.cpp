@@ -0,0 +1,178 @@
+// NOLINTBEGIN(cert-err58-cpp): Catch2 3.6.0 issue
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_message.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+
+import Goom.Color.ColorData.ColorMapEnums;
+import Goom.Color.ColorMapBase;
+import Goom.Color.ColorMaps;
+import Goom.Lib.GoomGraphic;
+
+namespace GOOM::UNIT_TESTS
+{
+
+using COLOR::ColorMapGroup;
+using COLOR::ColorMapLut;
+using COLOR::ColorMaps;
+using COLOR::IColorMap;
+using COLOR::COLOR_DATA::ColorMapName;
+
+namespace
+{
+
+// Not a multiple of the lut size, so most samples fall between lut entries.
+constexpr auto NUM_SAMPLES = 3001U;
+// A linear color map is a straight line between lut entries, so the lut is only out by the
+// rounding of the entries and the lerp.
+constexpr auto MAX_CHANNEL_DIFF = 3;
+
+constexpr auto TINT_PROPERTIES = ColorMaps::TintProperties{.saturation = 0.8F, .lightness = 0.9F};
+constexpr auto ROTATE_POINT    = 0.3F;
+
+[[nodiscard]] auto GetSampleT(const uint32_t i, const uint32_t numSamples) noexcept -> float
+{
+  // The same sum as used to bake the lut entries.
+  return static_cast<float>(i) / static_cast<float>(numSamples - 1);
+}
+
+[[nodiscard]] auto GetChannelDiff(const Pixel& color1, const Pixel& color2) noexcept -> int32_t
+{
+  const auto diff = [](const PixelChannelType chan1, const PixelChannelType chan2)
+  { return std::abs(static_cast<int32_t>(chan1) - static_cast<int32_t>(chan2)); };
+
+  return std::max(
+      {diff(color1.R(), color2.R()), diff(color1.G(), color2.G()), diff(color1.B(), color2.B())});
+}
+
+[[nodiscard]] auto GetMaxChannelDiff(const IColorMap& colorMap) noexcept -> int32_t
+{
+  auto maxDiff = 0;
+  for (auto i = 0U; i < NUM_SAMPLES; ++i)
+  {
+    const auto t = GetSampleT(i, NUM_SAMPLES);
+    maxDiff =
+        std::max(maxDiff, GetChannelDiff(colorMap.GetColor(t), colorMap.GetExactColor(t)));
+  }
+  return maxDiff;
+}
+
+// Colors that are anything but smooth in t, like the hue of near grey colors, can only be
+// exact at the lut entries.
+auto CheckExactAtLutEntries(const IColorMap& colorMap) noexcept -> void
+{
+  for (auto i = 0U; i < ColorMapLut::NUM_ENTRIES; ++i)
+  {
+    const auto t = GetSampleT(i, ColorMapLut::NUM_ENTRIES);
+    UNSCOPED_INFO(std::format("i = {}", i));
+    REQUIRE(colorMap.GetColor(t) == colorMap.GetExactColor(t));
+  }
+}
+
+} // namespace
+
+// NOLINTBEGIN(bugprone-chained-comparison): Catch2 needs to fix this.
+// NOLINTBEGIN(readability-function-cognitive-complexity)
+TEST_CASE("ColorMapLut")
+{
+  static constexpr auto MAX_T_CHANNEL = 255.0F;
+
+  auto numGetColorCalls = 0U;
+  const auto getColor    = [&numGetColorCalls](const float t)
+  {
+    ++numGetColorCalls;
+    const auto channel = static_cast<PixelChannelType>(std::round(t * MAX_T_CHANNEL));
+    return Pixel{channel, channel, channel, MAX_ALPHA};
+  };
+
+  const auto colorMapLut = ColorMapLut{};
+  REQUIRE(numGetColorCalls == 0U);
+
+  REQUIRE(colorMapLut.GetColor(0.0F, getColor) == Pixel{0U, 0U, 0U, MAX_ALPHA});
+  REQUIRE(numGetColorCalls == ColorMapLut::NUM_ENTRIES);
+  REQUIRE(colorMapLut.GetColor(1.0F, getColor) == Pixel{255U, 255U, 255U, MAX_ALPHA});
+  REQUIRE(colorMapLut.GetColor(0.5F, getColor).R() >= 126U);
+  REQUIRE(colorMapLut.GetColor(0.5F, getColor).R() <= 128U);
+
+  // Out of range t's are clamped.
+  REQUIRE(colorMapLut.GetColor(-1.0F, getColor) == colorMapLut.GetColor(0.0F, getColor));
+  REQUIRE(colorMapLut.GetColor(2.0F, getColor) == colorMapLut.GetColor(1.0F, getColor));
+
+  // Only baked once.
+  REQUIRE(numGetColorCalls == ColorMapLut::NUM_ENTRIES);
+}
+
+TEST_CASE("Prebuilt ColorMaps Lut Accuracy")
+{
+  const auto colorMaps = ColorMaps{};
+
+  for (const auto colorMapName : ColorMaps::GetColorMapNames(ColorMapGroup::ALL))
+  {
+    const auto colorMap = colorMaps.GetColorMap(colorMapName);
+    UNSCOPED_INFO(std::format("colorMapName = {}", static_cast<uint32_t>(colorMapName)));
+    REQUIRE(GetMaxChannelDiff(colorMap) <= MAX_CHANNEL_DIFF);
+  }
+}
+
+TEST_CASE("Rotated and Tinted ColorMaps Lut Accuracy")
+{
+  const auto colorMaps = ColorMaps{};
+
+  for (const auto colorMapName : {ColorMapName::VIRIDIS, ColorMapName::TWILIGHT})
+  {
+    CheckExactAtLutEntries(*colorMaps.GetRotatedColorMapPtr(colorMapName, ROTATE_POINT));
+    CheckExactAtLutEntries(*colorMaps.GetTintedColorMapPtr(colorMapName, TINT_PROPERTIES));
+  }
+
+  // Away from the wrap around point, a rotated map is as good as the map it rotates.
+  const auto rotatedColorMap = colorMaps.GetRotatedColorMapPtr(ColorMapName::VIRIDIS, 0.0F);
+  REQUIRE(GetMaxChannelDiff(*rotatedColorMap) <= MAX_CHANNEL_DIFF);
+}
+
+TEST_CASE("ColorMaps Lut Speed")
+{
+  static constexpr auto NUM_BENCH_SAMPLES = 10000U;
+
+  const auto colorMaps = ColorMaps{};
+  const auto colorMap  = colorMaps.GetColorMap(ColorMapName::VIRIDIS);
+  const auto tintedColorMap =
+      colorMaps.GetTintedColorMapPtr(ColorMapName::VIRIDIS, TINT_PROPERTIES);
+
+  const auto sumColors = [](const auto& getColor)
+  {
+    auto sum = 0U;
+    for (auto i = 0U; i < NUM_BENCH_SAMPLES; ++i)
+    {
+      sum += getColor(GetSampleT(i, NUM_BENCH_SAMPLES)).G();
+    }
+    return sum;
+  };
+
+  BENCHMARK("prebuilt exact")
+  {
+    return sumColors([&colorMap](const float t) { return colorMap.GetExactColor(t); });
+  };
+  BENCHMARK("prebuilt lut")
+  {
+    return sumColors([&colorMap](const float t) { return colorMap.GetColor(t); });
+  };
+  BENCHMARK("tinted exact")
+  {
+    return sumColors([&tintedColorMap](const float t) { return tintedColorMap->GetExactColor(t); });
+  };
+  BENCHMARK("tinted lut")
+  {
+    return sumColors([&tintedColorMap](const float t) { return tintedColorMap->GetColor(t); });
+  };
+}
+// NOLINTEND(readability-function-cognitive-complexity)
+// NOLINTEND(bugprone-chained-comparison)
+
+} // namespace GOOM::UNIT_TESTS
+
+// NOLINTEND(cert-err58-cpp): Catch2 3.6.0 issue
@@ -0,0 +1,99 @@
+module;
+
+#include "goom/goom_logger.h"
+
+#include <algorithm>
+#include <cstdint>
+
+export module Goom.Tests.Draw.DrawHelper;
+
+import Goom.Draw.DirtyTiles;
+import Goom.Draw.GoomDrawBase;
+import Goom.Draw.GoomDrawToBuffer;
+import Goom.Utils.DebuggingLogger;
+import Goom.Lib.GoomGraphic;
+import Goom.Lib.GoomTypes;
+
+export namespace GOOM::UNIT_TESTS
+{
+
+// Deliberately not a multiple of the tile size.
+inline constexpr auto TEST_WIDTH  = (3U * DRAW::DirtyTiles::TILE_SIZE) + 5U;
+inline constexpr auto TEST_HEIGHT = (2U * DRAW::DirtyTiles::TILE_SIZE) + 7U;
+
+// Not black, so the blends have something to work on.
+inline constexpr auto BGND_COLOR1 = Pixel{
+    {.red = 100U, .green = 50U, .blue = 25U, .alpha = MAX_ALPHA}
+};
+inline constexpr auto BGND_COLOR2 = Pixel{
+    {.red = 10U, .green = 150U, .blue = 250U, .alpha = MAX_ALPHA}
+};
+
+// Two buffers filled with the background colors, and a draw to them with no dirty tiles.
+struct TwoBuffers
+{
+  explicit TwoBuffers(const Dimensions& dimensions = Dimensions{TEST_WIDTH, TEST_HEIGHT}) noexcept;
+
+  PixelBufferVector buffer1;
+  PixelBufferVector buffer2;
+  DRAW::GoomDrawToTwoBuffers draw;
+};
+
+// Not commutative, so any change in the order pixels are drawn in changes the result.
+[[nodiscard]] auto SubtractBlend(const Pixel& bgndColor,
+                                 uint32_t intBuffIntensity,
+                                 const Pixel& fgndColor,
+                                 PixelChannelType newAlpha) -> Pixel;
+
+// Different colors for different 'i'.
+[[nodiscard]] auto GetColors(uint32_t i) noexcept -> DRAW::MultiplePixels;
+
+[[nodiscard]] auto AreEqual(const PixelBuffer& buffer1, const PixelBuffer& buffer2) noexcept
+    -> bool;
+
+} // namespace GOOM::UNIT_TESTS
+
+namespace GOOM::UNIT_TESTS
+{
+
+inline TwoBuffers::TwoBuffers(const Dimensions& dimensions) noexcept
+  : buffer1{dimensions},
+    buffer2{dimensions},
+    draw{dimensions, UTILS::GetGoomLogger(), buffer1, buffer2}
+{
+  buffer1.Fill(BGND_COLOR1);
+  buffer2.Fill(BGND_COLOR2);
+  draw.GetDirtyTiles().Clear();
+}
+
+inline auto SubtractBlend(const Pixel& bgndColor,
+                          [[maybe_unused]] const uint32_t intBuffIntensity,
+                          const Pixel& fgndColor,
+                          [[maybe_unused]] const PixelChannelType newAlpha) -> Pixel
+{
+  const auto subtract = [](const PixelChannelType bgnd, const PixelChannelType fgnd)
+  { return static_cast<PixelChannelType>(bgnd > fgnd ? bgnd - fgnd : fgnd - bgnd); };
+
+  return Pixel{
+      {.red   = subtract(bgndColor.R(), fgndColor.R()),
+       .green = subtract(bgndColor.G(), fgndColor.G()),
+       .blue  = subtract(bgndColor.B(), fgndColor.B()),
+       .alpha = MAX_ALPHA}
+  };
+}
+
+inline auto GetColors(const uint32_t i) noexcept -> DRAW::MultiplePixels
+{
+  const auto channel = static_cast<PixelChannelType>((i * 37U) % 251U);
+  return {
+      .color1 = Pixel{{.red = channel, .green = 10U, .blue = 200U, .alpha = MAX_ALPHA}},
+      .color2 = Pixel{{.red = 5U, .green = channel, .blue = 99U, .alpha = MAX_ALPHA}},
+  };
+}
+
+inline auto AreEqual(const PixelBuffer& buffer1, const PixelBuffer& buffer2) noexcept -> bool
+{
+  return std::ranges::equal(buffer1.GetPixelBuffer(), buffer2.GetPixelBuffer());
+}
+
+} // namespace GOOM::UNIT_TESTS
@@ -0,0 +1,253 @@
+// NOLINTBEGIN(cert-err58-cpp): Catch2 3.6.0 issue
+
+#include <array>
+#include <catch2/catch_message.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+import Goom.Draw.GoomDrawBase;
+import Goom.Draw.ShapeDrawers.BitmapDrawer;
+import Goom.Tests.Draw.DrawHelper;
+import Goom.Utils.Graphics.ImageBitmaps;
+import Goom.Lib.GoomGraphic;
+import Goom.Lib.Point2d;
+
+namespace GOOM::UNIT_TESTS
+{
+
+using DRAW::IGoomDraw;
+using DRAW::SHAPE_DRAWERS::BitmapDrawer;
+using UTILS::GRAPHICS::ImageBitmap;
+
+namespace
+{
+
+// 'C' is a colored pixel, 'T' is transparent and 'K' is black.
+constexpr auto BITMAP_ROWS = std::array{
+    "CCCCCCCC",
+    "CCTKCCCT",
+    "TCCCCKCC",
+    "KKCCTTCC",
+    "CTCTCTCT",
+    "CCCCCCCK",
+};
+constexpr auto BITMAP_WIDTH  = 8;
+constexpr auto BITMAP_HEIGHT = static_cast<int32_t>(BITMAP_ROWS.size());
+
+[[nodiscard]] auto GetBitmapChar(const int32_t bitmapX, const int32_t bitmapY) -> char
+{
+  return BITMAP_ROWS.at(static_cast<size_t>(bitmapY))[bitmapX];
+}
+
+// An uncompressed, top to bottom, 32 bit TGA. The channel bytes end up in the bitmap as red,
+// green, blue and alpha.
+auto WriteBitmapFile(const std::string& filename) -> void
+{
+  static constexpr auto TGA_TRUE_COLOR = 2U;
+  static constexpr auto TGA_BPP        = 32U;
+  static constexpr auto TGA_TOP_DOWN   = 0x28U;
+
+  auto bytes = std::vector<uint8_t>{0U, 0U, TGA_TRUE_COLOR, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U};
+  bytes.insert(bytes.end(), {BITMAP_WIDTH, 0U, BITMAP_HEIGHT, 0U, TGA_BPP, TGA_TOP_DOWN});
+
+  for (auto bitmapY = 0; bitmapY < BITMAP_HEIGHT; ++bitmapY)
+  {
+    for (auto bitmapX = 0; bitmapX < BITMAP_WIDTH; ++bitmapX)
+    {
+      switch (GetBitmapChar(bitmapX, bitmapY))
+      {
+        case 'T':
+          bytes.insert(bytes.end(), {50U, 60U, 70U, 0U});
+          break;
+        case 'K':
+          bytes.insert(bytes.end(), {0U, 0U, 0U, MAX_ALPHA});
+          break;
+        default:
+          bytes.insert(bytes.end(),
+                       {static_cast<uint8_t>(20 + (10 * bitmapX)),
+                        static_cast<uint8_t>(30 + (10 * bitmapY)),
+                        77U,
+                        MAX_ALPHA});
+          break;
+      }
+    }
+  }
+
+  auto file = std::ofstream{filename, std::ios::binary};
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): Need the raw bytes.
+  file.write(reinterpret_cast<const char*>(bytes.data()),
+             static_cast<std::streamsize>(bytes.size()));
+}
+
+[[nodiscard]] auto GetTestBitmap() -> const ImageBitmap&
+{
+  static const auto s_BITMAP = []
+  {
+    const auto filename =
+        (std::filesystem::temp_directory_path() / "goom_test_bitmap_drawer.tga").string();
+    WriteBitmapFile(filename);
+    return ImageBitmap{filename};
+  }();
+  return s_BITMAP;
+}
+
+// The colors depend on the bitmap point, so a pixel from the wrong column or row shows up.
+[[nodiscard]] auto GetBitmapColor1(const Point2dInt& bitmapPoint, const Pixel& imageColor)
+    -> Pixel
+{
+  return Pixel{
+      {.red   = imageColor.R(),
+       .green = static_cast<PixelChannelType>(5 + (20 * bitmapPoint.x)),
+       .blue  = static_cast<PixelChannelType>(5 + (20 * bitmapPoint.y)),
+       .alpha = MAX_ALPHA}
+  };
+}
+
+[[nodiscard]] auto GetBitmapColor2(const Point2dInt& bitmapPoint, const Pixel& imageColor)
+    -> Pixel
+{
+  return Pixel{
+      {.red   = static_cast<PixelChannelType>(200 - (20 * bitmapPoint.y)),
+       .green = imageColor.G(),
+       .blue  = static_cast<PixelChannelType>(200 - (20 * bitmapPoint.x)),
+       .alpha = MAX_ALPHA}
+  };
+}
+
+[[nodiscard]] auto GetTopLeft(const Point2dInt& centre) -> Point2dInt
+{
+  return {.x = centre.x - (BITMAP_WIDTH / 2), .y = centre.y - (BITMAP_HEIGHT / 2)};
+}
+
+[[nodiscard]] auto IsOnScreen(const Point2dInt& point) -> bool
+{
+  return (point.x >= 0) and (point.x < static_cast<int32_t>(TEST_WIDTH)) and (point.y >= 0) and
+         (point.y < static_cast<int32_t>(TEST_HEIGHT));
+}
+
+// Draws each colored bitmap pixel that's on the screen, one at a time.
+auto DrawBitmapPixelByPixel(IGoomDraw& draw, const Point2dInt& centre) -> void
+{
+  const auto& bitmap = GetTestBitmap();
+  const auto topLeft = GetTopLeft(centre);
+
+  for (auto bitmapY = 0; bitmapY < BITMAP_HEIGHT; ++bitmapY)
+  {
+    for (auto bitmapX = 0; bitmapX < BITMAP_WIDTH; ++bitmapX)
+    {
+      const auto point = Point2dInt{.x = topLeft.x + bitmapX, .y = topLeft.y + bitmapY};
+      if ((GetBitmapChar(bitmapX, bitmapY) != 'C') or (not IsOnScreen(point)))
+      {
+        continue;
+      }
+      const auto bitmapPoint = Point2dInt{.x = bitmapX, .y = bitmapY};
+      const auto imageColor =
+          bitmap(static_cast<size_t>(bitmapX), static_cast<size_t>(bitmapY));
+      draw.DrawPixels(point,
+                      {.color1 = GetBitmapColor1(bitmapPoint, imageColor),
+                       .color2 = GetBitmapColor2(bitmapPoint, imageColor)});
+    }
+  }
+}
+
+auto CheckSameAsPixelByPixel(const Point2dInt& centre) -> void
+{
+  auto bitmapBuffers = TwoBuffers{};
+  auto bitmapDrawer  = BitmapDrawer{bitmapBuffers.draw};
+  bitmapDrawer.Bitmap(centre,
+                      GetTestBitmap(),
+                      std::vector<BitmapDrawer::GetBitmapColorFunc>{GetBitmapColor1,
+                                                                    GetBitmapColor2});
+
+  auto pixelBuffers = TwoBuffers{};
+  DrawBitmapPixelByPixel(pixelBuffers.draw, centre);
+
+  REQUIRE(AreEqual(bitmapBuffers.buffer1, pixelBuffers.buffer1));
+  REQUIRE(AreEqual(bitmapBuffers.buffer2, pixelBuffers.buffer2));
+
+  // The transparent and black pixels are never drawn.
+  const auto topLeft = GetTopLeft(centre);
+  for (auto bitmapY = 0; bitmapY < BITMAP_HEIGHT; ++bitmapY)
+  {
+    for (auto bitmapX = 0; bitmapX < BITMAP_WIDTH; ++bitmapX)
+    {
+      const auto point = Point2dInt{.x = topLeft.x + bitmapX, .y = topLeft.y + bitmapY};
+      if ((GetBitmapChar(bitmapX, bitmapY) == 'C') or (not IsOnScreen(point)))
+      {
+        continue;
+      }
+      UNSCOPED_INFO("bitmapX = " << bitmapX << ", bitmapY = " << bitmapY);
+      REQUIRE(bitmapBuffers.buffer1(point.x, point.y) == BGND_COLOR1);
+      REQUIRE(bitmapBuffers.buffer2(point.x, point.y) == BGND_COLOR2);
+    }
+  }
+}
+
+[[nodiscard]] auto GetRowRuns(const size_t bitmapY) -> std::vector<std::pair<uint32_t, uint32_t>>
+{
+  auto rowRuns = std::vector<std::pair<uint32_t, uint32_t>>{};
+  for (const auto& pixelRun : GetTestBitmap().GetRowRuns(bitmapY))
+  {
+    rowRuns.emplace_back(pixelRun.xBegin, pixelRun.xEnd);
+  }
+  return rowRuns;
+}
+
+} // namespace
+
+// NOLINTBEGIN(bugprone-chained-comparison): Catch2 needs to fix this.
+// NOLINTBEGIN(readability-function-cognitive-complexity)
+TEST_CASE("Bitmap Row Runs")
+{
+  using Runs = std::vector<std::pair<uint32_t, uint32_t>>;
+
+  REQUIRE(GetTestBitmap().GetIntWidth() == BITMAP_WIDTH);
+  REQUIRE(GetTestBitmap().GetIntHeight() == BITMAP_HEIGHT);
+
+  REQUIRE(GetRowRuns(0) == Runs{{0U, 8U}});
+  REQUIRE(GetRowRuns(1) == Runs{{0U, 2U}, {4U, 7U}});
+  REQUIRE(GetRowRuns(2) == Runs{{1U, 5U}, {6U, 8U}});
+  REQUIRE(GetRowRuns(3) == Runs{{2U, 4U}, {6U, 8U}});
+  REQUIRE(GetRowRuns(4) == Runs{{0U, 1U}, {2U, 3U}, {4U, 5U}, {6U, 7U}});
+  REQUIRE(GetRowRuns(5) == Runs{{0U, 7U}});
+}
+
+TEST_CASE("Bitmap Same As Pixels")
+{
+  SECTION("On screen")
+  {
+    CheckSameAsPixelByPixel({.x = static_cast<int32_t>(TEST_WIDTH / 2),
+                             .y = static_cast<int32_t>(TEST_HEIGHT / 2)});
+  }
+  SECTION("Clipped at the left and top")
+  {
+    // The screen's top left is bitmap column 3, row 2.
+    CheckSameAsPixelByPixel({.x = 1, .y = 1});
+  }
+  SECTION("Clipped at the right and bottom")
+  {
+    CheckSameAsPixelByPixel({.x = static_cast<int32_t>(TEST_WIDTH) - 1,
+                             .y = static_cast<int32_t>(TEST_HEIGHT) - 1});
+  }
+  SECTION("Off screen")
+  {
+    auto bitmapBuffers = TwoBuffers{};
+    auto bitmapDrawer  = BitmapDrawer{bitmapBuffers.draw};
+    bitmapDrawer.Bitmap({.x = -BITMAP_WIDTH, .y = 2}, GetTestBitmap(), GetBitmapColor1);
+
+    REQUIRE(AreEqual(bitmapBuffers.buffer1, TwoBuffers{}.buffer1));
+    REQUIRE(AreEqual(bitmapBuffers.buffer2, TwoBuffers{}.buffer2));
+  }
+}
+// NOLINTEND(readability-function-cognitive-complexity)
+// NOLINTEND(bugprone-chained-comparison)
+
+} // namespace GOOM::UNIT_TESTS
+
+// NOLINTEND(cert-err58-cpp): Catch2 3.6.0 issue
@@ -0,0 +1,162 @@
+// NOLINTBEGIN(cert-err58-cpp): Catch2 3.6.0 issue
+
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+import Goom.Draw.ShaperDrawers.TextDrawer;
+import Goom.Tests.Draw.DrawHelper;
+
+namespace GOOM::UNIT_TESTS
+{
+
+using DRAW::SHAPE_DRAWERS::TextDrawer;
+
+namespace
+{
+
+constexpr auto FONT_SIZE     = 30;
+constexpr auto OUTLINE_WIDTH = 1.0F;
+constexpr auto TEXT          = "Goom Text";
+
+[[nodiscard]] auto GetFontFile() -> std::string
+{
+  return (std::filesystem::path{__FILE__}.parent_path().parent_path().parent_path() /
+          "Rubik-Regular.ttf")
+      .string();
+}
+
+auto SetUpTextDrawer(TextDrawer& textDrawer) -> void
+{
+  textDrawer.SetFontFile(GetFontFile());
+  textDrawer.SetFontSize(FONT_SIZE);
+  textDrawer.SetOutlineWidth(OUTLINE_WIDTH);
+  textDrawer.SetParallelRender(false);
+}
+
+[[nodiscard]] auto GetPreparedText(TextDrawer& textDrawer, const std::string& text)
+    -> TextDrawer::PreparedText
+{
+  textDrawer.SetText(text);
+  textDrawer.Prepare();
+
+  auto preparedText = TextDrawer::PreparedText{};
+  textDrawer.GetPreparedText(preparedText);
+  return preparedText;
+}
+
+// Prepared by a new text drawer, so nothing comes from a glyph cache.
+[[nodiscard]] auto GetUncachedPreparedText(const int32_t fontSize,
+                                           const float outlineWidth,
+                                           const std::string& text) -> TextDrawer::PreparedText
+{
+  auto buffers    = TwoBuffers{};
+  auto textDrawer = TextDrawer{buffers.draw};
+  SetUpTextDrawer(textDrawer);
+  textDrawer.SetFontSize(fontSize);
+  textDrawer.SetOutlineWidth(outlineWidth);
+
+  return GetPreparedText(textDrawer, text);
+}
+
+[[nodiscard]] auto IsSameSpan(const TextDrawer::TextSpan& span1, const TextDrawer::TextSpan& span2)
+    -> bool
+{
+  return (span1.start == span2.start) and (span1.width == span2.width) and
+         (span1.coverage == span2.coverage) and (span1.isOutline == span2.isOutline) and
+         (span1.textIndexOfChar == span2.textIndexOfChar) and
+         (span1.charPoint == span2.charPoint) and
+         (span1.charDimensions.GetWidth() == span2.charDimensions.GetWidth()) and
+         (span1.charDimensions.GetHeight() == span2.charDimensions.GetHeight());
+}
+
+[[nodiscard]] auto IsSameText(const TextDrawer::PreparedText& preparedText1,
+                              const TextDrawer::PreparedText& preparedText2) -> bool
+{
+  return (preparedText1.numChars == preparedText2.numChars) and
+         (preparedText1.width == preparedText2.width) and
+         std::ranges::equal(preparedText1.spans, preparedText2.spans, IsSameSpan);
+}
+
+} // namespace
+
+// NOLINTBEGIN(bugprone-chained-comparison): Catch2 needs to fix this.
+// NOLINTBEGIN(readability-function-cognitive-complexity)
+TEST_CASE("TextDrawer Glyph Cache")
+{
+  const auto uncachedPreparedText = GetUncachedPreparedText(FONT_SIZE, OUTLINE_WIDTH, TEXT);
+  REQUIRE(not uncachedPreparedText.spans.empty());
+
+  auto buffers    = TwoBuffers{};
+  auto textDrawer = TextDrawer{buffers.draw};
+  SetUpTextDrawer(textDrawer);
+
+  SECTION("Same text prepared twice")
+  {
+    const auto preparedText1 = GetPreparedText(textDrawer, TEXT);
+    const auto preparedText2 = GetPreparedText(textDrawer, TEXT);
+
+    REQUIRE(IsSameText(preparedText1, uncachedPreparedText));
+    REQUIRE(IsSameText(preparedText2, uncachedPreparedText));
+  }
+
+  SECTION("Font size changed between prepares")
+  {
+    static constexpr auto NEW_FONT_SIZE = FONT_SIZE + 10;
+
+    REQUIRE(IsSameText(GetPreparedText(textDrawer, TEXT), uncachedPreparedText));
+    textDrawer.SetFontSize(NEW_FONT_SIZE);
+    const auto preparedText = GetPreparedText(textDrawer, TEXT);
+
+    REQUIRE(not IsSameText(preparedText, uncachedPreparedText));
+    REQUIRE(IsSameText(preparedText, GetUncachedPreparedText(NEW_FONT_SIZE, OUTLINE_WIDTH, TEXT)));
+
+    textDrawer.SetFontSize(FONT_SIZE);
+    REQUIRE(IsSameText(GetPreparedText(textDrawer, TEXT), uncachedPreparedText));
+  }
+
+  SECTION("Outline width changed between prepares")
+  {
+    static constexpr auto NEW_OUTLINE_WIDTH = OUTLINE_WIDTH + 1.5F;
+
+    REQUIRE(IsSameText(GetPreparedText(textDrawer, TEXT), uncachedPreparedText));
+    textDrawer.SetOutlineWidth(NEW_OUTLINE_WIDTH);
+    const auto preparedText = GetPreparedText(textDrawer, TEXT);
+
+    REQUIRE(not IsSameText(preparedText, uncachedPreparedText));
+    REQUIRE(IsSameText(preparedText, GetUncachedPreparedText(FONT_SIZE, NEW_OUTLINE_WIDTH, TEXT)));
+
+    textDrawer.SetOutlineWidth(OUTLINE_WIDTH);
+    REQUIRE(IsSameText(GetPreparedText(textDrawer, TEXT), uncachedPreparedText));
+  }
+
+  SECTION("More glyphs than the cache holds")
+  {
+    // Each font size gives a new set of glyphs.
+    static constexpr auto CHARS =
+        std::string_view{"abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"};
+    static constexpr auto NUM_FONT_SIZES = (TextDrawer::MAX_CACHED_GLYPHS / CHARS.size()) + 1U;
+    static_assert((NUM_FONT_SIZES * CHARS.size()) > TextDrawer::MAX_CACHED_GLYPHS);
+
+    REQUIRE(IsSameText(GetPreparedText(textDrawer, TEXT), uncachedPreparedText));
+    for (auto i = 1U; i <= NUM_FONT_SIZES; ++i)
+    {
+      textDrawer.SetFontSize(FONT_SIZE + static_cast<int32_t>(i));
+      static_cast<void>(GetPreparedText(textDrawer, std::string{CHARS}));
+    }
+
+    // The cache is emptied by this prepare.
+    textDrawer.SetFontSize(FONT_SIZE);
+    REQUIRE(IsSameText(GetPreparedText(textDrawer, TEXT), uncachedPreparedText));
+    REQUIRE(IsSameText(GetPreparedText(textDrawer, TEXT), uncachedPreparedText));
+  }
+}
+// NOLINTEND(readability-function-cognitive-complexity)
+// NOLINTEND(bugprone-chained-comparison)
+
+} // namespace GOOM::UNIT_TESTS
+
+// NOLINTEND(cert-err58-cpp): Catch2 3.6.0 issue
@@ -0,0 +1,187 @@
+// NOLINTBEGIN(cert-err58-cpp): Catch2 3.6.0 issue
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+import Goom.Draw.DirtyTiles;
+import Goom.Lib.GoomGraphic;
+import Goom.Lib.GoomTypes;
+import Goom.Lib.Point2d;
+
+namespace GOOM::UNIT_TESTS
+{
+
+using DRAW::CopyTiles;
+using DRAW::DirtyTiles;
+using DRAW::FillTiles;
+using DRAW::TileGrid;
+
+namespace
+{
+
+// Deliberately not a multiple of the tile size.
+constexpr auto WIDTH  = (3U * DirtyTiles::TILE_SIZE) + 5U;
+constexpr auto HEIGHT = (2U * DirtyTiles::TILE_SIZE) + 7U;
+
+constexpr auto DRAWN_POINT = Point2dInt{.x = static_cast<int32_t>(DirtyTiles::TILE_SIZE) + 3,
+                                        .y = static_cast<int32_t>(DirtyTiles::TILE_SIZE) + 2};
+constexpr auto EDGE_POINT  = Point2dInt{.x = static_cast<int32_t>(WIDTH) - 1,
+                                        .y = static_cast<int32_t>(HEIGHT) - 1};
+
+[[nodiscard]] auto GetTileIndex(const DirtyTiles& dirtyTiles, const Point2dInt& point) noexcept
+    -> uint32_t
+{
+  return ((static_cast<uint32_t>(point.y) / DirtyTiles::TILE_SIZE) * dirtyTiles.GetNumTilesX()) +
+         (static_cast<uint32_t>(point.x) / DirtyTiles::TILE_SIZE);
+}
+
+} // namespace
+
+// NOLINTBEGIN(bugprone-chained-comparison): Catch2 needs to fix this.
+// NOLINTBEGIN(readability-function-cognitive-complexity)
+TEST_CASE("TileGrid Geometry")
+{
+  const auto tileGrid = TileGrid{
+      Dimensions{WIDTH, HEIGHT}
+  };
+  REQUIRE(4U == tileGrid.GetNumTilesX());
+  REQUIRE(3U == tileGrid.GetNumTilesY());
+  REQUIRE(12U == tileGrid.GetNumTiles());
+  REQUIRE(5U == tileGrid.GetTileIndex(DRAWN_POINT));
+  REQUIRE(tileGrid.GetNumTiles() - 1 == tileGrid.GetTileIndex(EDGE_POINT));
+
+  const auto edgeTileBounds = tileGrid.GetTileBounds(tileGrid.GetTileIndex(EDGE_POINT));
+  REQUIRE(edgeTileBounds.xBegin == 3U * TileGrid::TILE_SIZE);
+  REQUIRE(edgeTileBounds.xEnd == WIDTH);
+  REQUIRE(edgeTileBounds.yBegin == 2U * TileGrid::TILE_SIZE);
+  REQUIRE(edgeTileBounds.yEnd == HEIGHT);
+
+  // The dirty tiles have the same geometry.
+  const auto dirtyTiles = DirtyTiles{
+      Dimensions{WIDTH, HEIGHT}
+  };
+  REQUIRE(dirtyTiles.GetTileGrid().GetNumTiles() == tileGrid.GetNumTiles());
+  REQUIRE(dirtyTiles.GetTileIndex(EDGE_POINT) == tileGrid.GetTileIndex(EDGE_POINT));
+}
+
+TEST_CASE("DirtyTiles Marking")
+{
+  auto dirtyTiles = DirtyTiles{
+      Dimensions{WIDTH, HEIGHT}
+  };
+  REQUIRE(4U == dirtyTiles.GetNumTilesX());
+  REQUIRE(3U == dirtyTiles.GetNumTilesY());
+  REQUIRE(dirtyTiles.GetNumTiles() == dirtyTiles.GetNumDirtyTiles());
+
+  dirtyTiles.Clear();
+  REQUIRE(0U == dirtyTiles.GetNumDirtyTiles());
+
+  dirtyTiles.MarkPoint(DRAWN_POINT);
+  dirtyTiles.MarkPoint(DRAWN_POINT);
+  dirtyTiles.MarkPoint(EDGE_POINT);
+  REQUIRE(2U == dirtyTiles.GetNumDirtyTiles());
+  REQUIRE(dirtyTiles.IsDirty(GetTileIndex(dirtyTiles, DRAWN_POINT)));
+  REQUIRE(dirtyTiles.IsDirty(GetTileIndex(dirtyTiles, EDGE_POINT)));
+
+  auto tileMask = DirtyTiles::TileMask(dirtyTiles.GetNumTiles(), 0U);
+  tileMask[0]   = 1U;
+  dirtyTiles.AddToTileMask(tileMask);
+  REQUIRE(1U == tileMask[0]);
+  REQUIRE(1U == tileMask[GetTileIndex(dirtyTiles, DRAWN_POINT)]);
+  REQUIRE(1U == tileMask[GetTileIndex(dirtyTiles, EDGE_POINT)]);
+  REQUIRE(0U == tileMask[1]);
+}
+
+TEST_CASE("DirtyTiles Rectangles")
+{
+  auto dirtyTiles = DirtyTiles{
+      Dimensions{WIDTH, HEIGHT}
+  };
+  dirtyTiles.Clear();
+
+  // Hangs off the top left corner.
+  dirtyTiles.MarkRectangle({.x = -10, .y = -10}, DRAWN_POINT);
+  auto tileIndexes = std::vector<uint32_t>{};
+  dirtyTiles.GetDirtyTileIndexes(tileIndexes);
+  REQUIRE(tileIndexes == std::vector<uint32_t>{0U, 1U, 4U, 5U});
+
+  // Completely off screen.
+  dirtyTiles.Clear();
+  dirtyTiles.MarkRectangle({.x = static_cast<int32_t>(WIDTH), .y = 0},
+                           {.x = static_cast<int32_t>(WIDTH) + 10, .y = 10});
+  dirtyTiles.GetDirtyTileIndexes(tileIndexes);
+  REQUIRE(tileIndexes.empty());
+
+  // Hangs off the bottom right corner.
+  dirtyTiles.MarkRectangle(EDGE_POINT, {.x = EDGE_POINT.x + 10, .y = EDGE_POINT.y + 10});
+  dirtyTiles.GetDirtyTileIndexes(tileIndexes);
+  REQUIRE(tileIndexes == std::vector<uint32_t>{dirtyTiles.GetNumTiles() - 1});
+
+  const auto edgeBounds = dirtyTiles.GetTileBounds(dirtyTiles.GetNumTiles() - 1);
+  REQUIRE(edgeBounds.xBegin == (3U * DirtyTiles::TILE_SIZE));
+  REQUIRE(edgeBounds.xEnd == WIDTH);
+  REQUIRE(edgeBounds.yBegin == (2U * DirtyTiles::TILE_SIZE));
+  REQUIRE(edgeBounds.yEnd == HEIGHT);
+
+  const auto innerBounds = dirtyTiles.GetTileBounds(GetTileIndex(dirtyTiles, DRAWN_POINT));
+  REQUIRE(innerBounds.xBegin == DirtyTiles::TILE_SIZE);
+  REQUIRE(innerBounds.xEnd == (2U * DirtyTiles::TILE_SIZE));
+  REQUIRE(innerBounds.yBegin == DirtyTiles::TILE_SIZE);
+  REQUIRE(innerBounds.yEnd == (2U * DirtyTiles::TILE_SIZE));
+}
+
+TEST_CASE("DirtyTiles Copy and Fill")
+{
+  static constexpr auto OLD_PIXEL   = Pixel{1U, 1U, 1U, 1U};
+  static constexpr auto DRAWN_PIXEL = Pixel{10U, 20U, 30U, MAX_ALPHA};
+
+  auto dirtyTiles = DirtyTiles{
+      Dimensions{WIDTH, HEIGHT}
+  };
+  auto srceBuffer = PixelBufferVector{
+      Dimensions{WIDTH, HEIGHT}
+  };
+  auto destBufferVec = std::vector<Pixel>(static_cast<size_t>(WIDTH) * HEIGHT, OLD_PIXEL);
+  auto destBuffer    = PixelBuffer{
+      destBufferVec, Dimensions{WIDTH, HEIGHT}
+  };
+
+  dirtyTiles.Clear();
+  srceBuffer(DRAWN_POINT.x, DRAWN_POINT.y) = DRAWN_PIXEL;
+  dirtyTiles.MarkPoint(DRAWN_POINT);
+
+  const auto tileMask = dirtyTiles.GetTileMask();
+  CopyTiles(srceBuffer, destBuffer, tileMask);
+
+  const auto drawnTileIndex = GetTileIndex(dirtyTiles, DRAWN_POINT);
+  for (auto y = 0; y < static_cast<int32_t>(HEIGHT); ++y)
+  {
+    for (auto x = 0; x < static_cast<int32_t>(WIDTH); ++x)
+    {
+      const auto point = Point2dInt{.x = x, .y = y};
+      if (point == DRAWN_POINT)
+      {
+        REQUIRE(DRAWN_PIXEL == destBuffer(x, y));
+      }
+      else if (drawnTileIndex == GetTileIndex(dirtyTiles, point))
+      {
+        REQUIRE(ZERO_PIXEL == destBuffer(x, y));
+      }
+      else
+      {
+        REQUIRE(OLD_PIXEL == destBuffer(x, y));
+      }
+    }
+  }
+
+  FillTiles(destBuffer, tileMask, OLD_PIXEL);
+  REQUIRE(OLD_PIXEL == destBuffer(DRAWN_POINT.x, DRAWN_POINT.y));
+}
+// NOLINTEND(readability-function-cognitive-complexity)
+// NOLINTEND(bugprone-chained-comparison)
+
+} // namespace GOOM::UNIT_TESTS
+
+// NOLINTEND(cert-err58-cpp): Catch2 3.6.0 issue
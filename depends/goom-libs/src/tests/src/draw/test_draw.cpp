@@ -81,7 +81,7 @@ void CheckContainer(const GoomDrawToContainer& draw, const std::vector<PixelInfo
   const auto emplaceCoords = [&](const Point2dInt& point, const ColorsList& colorsList)
   {
     changedPixels.emplace_back(PixelInfo{
-        .point = point, .colors = {.color1 = colorsList.colorsArray[0], .color2 = BLACK_PIXEL}
+        .point = point, .colors = {.color1 = colorsList.colors[0], .color2 = BLACK_PIXEL}
     });
   };
   draw.IterateChangedCoordsNewToOld(emplaceCoords);
@@ -217,7 +217,7 @@ TEST_CASE("Test DrawMovingText to Container with Duplicates")
   const auto& coords0     = draw.GetChangedCoordsList()[0];
   const auto& colorsList0 = draw.GetColorsList(coords0);
   REQUIRE(colorsListOldest.count == colorsList0.count);
-  REQUIRE(colorsListOldest.colorsArray == colorsList0.colorsArray);
+  REQUIRE(std::ranges::equal(colorsListOldest.colors, colorsList0.colors));
 
   draw.ResizeChangedCoordsKeepingNewest(NUM_CHANGED_COORDS - 1);
   REQUIRE(draw.GetNumChangedCoords() == NUM_CHANGED_COORDS - 1);
@@ -250,7 +250,15 @@ TEST_CASE("Test DrawMovingText ClearAll", "[GoomDrawToContainerClearAll]")
   {
     const auto& colorsList = draw.GetColorsList(pixelInfo.point);
     REQUIRE(0 == colorsList.count);
+    REQUIRE(draw.GetPixel(pixelInfo.point) == BLACK_PIXEL);
   }
+
+  // Redrawn pixels must start from scratch, not carry on from before the clear.
+  const auto& redrawnPixel = pixelsNewToOld.front();
+  draw.DrawPixels(redrawnPixel.point, redrawnPixel.colors);
+  REQUIRE(draw.GetNumChangedCoords() == 1);
+  REQUIRE(1 == draw.GetColorsList(redrawnPixel.point).count);
+  REQUIRE(draw.GetPixel(redrawnPixel.point) == redrawnPixel.colors.color1);
 }
 
 // NOLINTEND(misc-const-correctness)
@@ -0,0 +1,128 @@
+// NOLINTBEGIN(cert-err58-cpp): Catch2 3.6.0 issue
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <vector>
+
+import Goom.Draw.DirtyTiles;
+import Goom.Draw.GoomDrawBase;
+import Goom.Draw.GoomDrawToBuffer;
+import Goom.Draw.GoomDrawToContainer;
+import Goom.Lib.GoomGraphic;
+import Goom.Lib.GoomTypes;
+import Goom.Lib.Point2d;
+import Goom.Tests.Draw.DrawHelper;
+
+namespace GOOM::UNIT_TESTS
+{
+
+using DRAW::DirtyTiles;
+using DRAW::GoomDrawToContainer;
+using DRAW::IGoomDraw;
+using DRAW::MultiplePixels;
+
+namespace
+{
+
+// Crosses a tile boundary.
+constexpr auto SPAN_START  = Point2dInt{.x = static_cast<int32_t>(DirtyTiles::TILE_SIZE) - 3,
+                                        .y = static_cast<int32_t>(DirtyTiles::TILE_SIZE) + 1};
+constexpr auto SPAN_LENGTH = DirtyTiles::TILE_SIZE + 10U;
+
+[[nodiscard]] auto GetRunColors() noexcept -> std::vector<MultiplePixels>
+{
+  auto runColors = std::vector<MultiplePixels>{};
+  for (auto i = 0U; i < SPAN_LENGTH; ++i)
+  {
+    runColors.emplace_back(GetColors(i));
+  }
+  return runColors;
+}
+
+auto DrawSpanPixelByPixel(IGoomDraw& draw) noexcept -> void
+{
+  for (auto i = 0U; i < SPAN_LENGTH; ++i)
+  {
+    draw.DrawPixels({.x = SPAN_START.x + static_cast<int32_t>(i), .y = SPAN_START.y},
+                    GetColors(1));
+  }
+}
+
+auto DrawRunPixelByPixel(IGoomDraw& draw) noexcept -> void
+{
+  const auto runColors = GetRunColors();
+  for (auto i = 0U; i < SPAN_LENGTH; ++i)
+  {
+    draw.DrawPixels({.x = SPAN_START.x + static_cast<int32_t>(i), .y = SPAN_START.y + 1},
+                    runColors[i]);
+  }
+}
+
+auto DrawSpanAndRun(IGoomDraw& draw) noexcept -> void
+{
+  draw.DrawHorizontalSpan(SPAN_START, SPAN_LENGTH, GetColors(1));
+  draw.DrawPixelRun({.x = SPAN_START.x, .y = SPAN_START.y + 1}, GetRunColors());
+}
+
+auto CheckSameAsPixelByPixel(const IGoomDraw::PixelBlendFunc& blendFunc) noexcept -> void
+{
+  auto pixelBuffers = TwoBuffers{};
+  auto spanBuffers  = TwoBuffers{};
+  if (blendFunc)
+  {
+    pixelBuffers.draw.SetPixelBlendFunc(blendFunc);
+    spanBuffers.draw.SetPixelBlendFunc(blendFunc);
+  }
+
+  DrawSpanPixelByPixel(pixelBuffers.draw);
+  DrawRunPixelByPixel(pixelBuffers.draw);
+  DrawSpanAndRun(spanBuffers.draw);
+
+  REQUIRE(AreEqual(spanBuffers.buffer1, pixelBuffers.buffer1));
+  REQUIRE(AreEqual(spanBuffers.buffer2, pixelBuffers.buffer2));
+  REQUIRE(not AreEqual(spanBuffers.buffer1, TwoBuffers{}.buffer1));
+  REQUIRE(spanBuffers.draw.GetDirtyTiles().GetTileMask() ==
+          pixelBuffers.draw.GetDirtyTiles().GetTileMask());
+  REQUIRE(3U == spanBuffers.draw.GetDirtyTiles().GetNumDirtyTiles());
+}
+
+} // namespace
+
+// NOLINTBEGIN(bugprone-chained-comparison): Catch2 needs to fix this.
+// NOLINTBEGIN(readability-function-cognitive-complexity)
+TEST_CASE("Spans Same As Pixels - Default Blend")
+{
+  CheckSameAsPixelByPixel(IGoomDraw::PixelBlendFunc{});
+}
+
+TEST_CASE("Spans Same As Pixels - Custom Blend")
+{
+  CheckSameAsPixelByPixel(SubtractBlend);
+}
+
+TEST_CASE("Spans Same As Pixels - Default Device Spans")
+{
+  auto pixelDraw = GoomDrawToContainer{
+      Dimensions{TEST_WIDTH, TEST_HEIGHT}
+  };
+  auto spanDraw = GoomDrawToContainer{
+      Dimensions{TEST_WIDTH, TEST_HEIGHT}
+  };
+
+  DrawSpanPixelByPixel(pixelDraw);
+  DrawRunPixelByPixel(pixelDraw);
+  DrawSpanAndRun(spanDraw);
+
+  REQUIRE(spanDraw.GetNumChangedCoords() == (2U * SPAN_LENGTH));
+  REQUIRE(spanDraw.GetChangedCoordsList() == pixelDraw.GetChangedCoordsList());
+  for (const auto& point : pixelDraw.GetChangedCoordsList())
+  {
+    REQUIRE(spanDraw.GetPixel(point) == pixelDraw.GetPixel(point));
+  }
+}
+// NOLINTEND(readability-function-cognitive-complexity)
+// NOLINTEND(bugprone-chained-comparison)
+
+} // namespace GOOM::UNIT_TESTS
+
+// NOLINTEND(cert-err58-cpp): Catch2 3.6.0 issue
@@ -0,0 +1,192 @@
+// NOLINTBEGIN(cert-err58-cpp): Catch2 3.6.0 issue
+
+#include "goom/goom_logger.h"
+
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+
+import Goom.Draw.GoomDrawBase;
+import Goom.Draw.GoomDrawTo;
+import Goom.Draw.GoomDrawToBuffer;
+import Goom.Draw.ShaperDrawers.CircleDrawer;
+import Goom.Draw.ShaperDrawers.LineDrawer;
+import Goom.Draw.ShaperDrawers.PixelDrawer;
+import Goom.Utils.DebuggingLogger;
+import Goom.Utils.Graphics.PixelBlend;
+import Goom.Lib.GoomGraphic;
+import Goom.Lib.GoomTypes;
+import Goom.Lib.Point2d;
+import Goom.Tests.Draw.DrawHelper;
+
+namespace GOOM::UNIT_TESTS
+{
+
+using DRAW::GoomDrawTo;
+using DRAW::GoomDrawToSingleBuffer;
+using DRAW::MultiplePixels;
+using DRAW::TransparentBgnd;
+using DRAW::SHAPE_DRAWERS::BasicCircleDrawer;
+using DRAW::SHAPE_DRAWERS::BasicLineDrawerClippedEndPoints;
+using DRAW::SHAPE_DRAWERS::BasicLineDrawerNoClippedEndPoints;
+using DRAW::SHAPE_DRAWERS::BasicPixelDrawer;
+using UTILS::GetGoomLogger;
+using UTILS::GRAPHICS::GetColorAddPixelBlend;
+using UTILS::GRAPHICS::GetDarkenOnlyPixelBlend;
+using UTILS::GRAPHICS::PixelBlendRowType;
+
+namespace
+{
+
+// Big enough for all the shapes, unlike the default test size.
+constexpr auto WIDTH          = 150U;
+constexpr auto HEIGHT         = 100U;
+constexpr auto BUFF_INTENSITY = 0.8F;
+
+constexpr auto COLORS = MultiplePixels{
+    .color1 = Pixel{{.red = 200U, .green = 10U, .blue = 90U, .alpha = MAX_ALPHA}},
+    .color2 = Pixel{{.red = 5U, .green = 150U, .blue = 99U, .alpha = 30000U}},
+};
+
+// Uses every kind of drawing the shape drawers do - single pixels, clipped pixels, spans
+// and runs.
+template<class DrawT>
+auto DrawShapes(DrawT& draw) noexcept -> void
+{
+  auto circleDrawer = BasicCircleDrawer<DrawT>{draw};
+  circleDrawer.DrawCircle({.x = 40, .y = 30}, 20, COLORS);
+  circleDrawer.DrawFilledCircle({.x = 100, .y = 60}, 25, COLORS);
+
+  auto lineDrawer = BasicLineDrawerClippedEndPoints<DrawT>{draw};
+  lineDrawer.DrawLine({.x = 10, .y = 90}, {.x = 140, .y = 5}, COLORS);
+  lineDrawer.SetLineThickness(3U);
+  lineDrawer.DrawLine({.x = 10, .y = 10}, {.x = 130, .y = 80}, COLORS);
+
+  // Runs off the screen.
+  auto clippedLineDrawer = BasicLineDrawerNoClippedEndPoints<DrawT>{draw};
+  clippedLineDrawer.DrawLine({.x = -20, .y = 50}, {.x = 200, .y = 70}, COLORS);
+
+  auto pixelDrawer = BasicPixelDrawer<DrawT>{draw};
+  pixelDrawer.DrawPixels({.x = 3, .y = 4}, COLORS);
+  pixelDrawer.DrawPixelsClipped({.x = -1, .y = 4}, COLORS);
+
+  auto runColors = std::array<MultiplePixels, 70>{};
+  for (auto i = 0U; i < runColors.size(); ++i)
+  {
+    runColors.at(i) = GetColors(i);
+  }
+  draw.DrawPixelRun({.x = 60, .y = 95}, runColors);
+}
+
+// As left by clearing the buffers, so the shapes are drawn over both transparent and opaque
+// pixels.
+auto MakeTopHalfTransparent(TwoBuffers& buffers) noexcept -> void
+{
+  for (auto y = size_t{0}; y < (HEIGHT / 2U); ++y)
+  {
+    for (auto x = size_t{0}; x < WIDTH; ++x)
+    {
+      buffers.buffer1(x, y) = ZERO_PIXEL;
+      buffers.buffer2(x, y) = ZERO_PIXEL;
+    }
+  }
+}
+
+template<PixelBlendRowType BLEND_TYPE, TransparentBgnd TRANSPARENT_BGND = TransparentBgnd::BLEND>
+auto CheckSameAsVirtualDraw(const DRAW::IGoomDraw::PixelBlendFunc& blendFunc) noexcept -> void
+{
+  auto virtualBuffers = TwoBuffers{Dimensions{WIDTH, HEIGHT}};
+  auto staticBuffers  = TwoBuffers{Dimensions{WIDTH, HEIGHT}};
+  if constexpr (TRANSPARENT_BGND == TransparentBgnd::USE_FGND)
+  {
+    MakeTopHalfTransparent(virtualBuffers);
+    MakeTopHalfTransparent(staticBuffers);
+  }
+  virtualBuffers.draw.SetBuffIntensity(BUFF_INTENSITY);
+  staticBuffers.draw.SetBuffIntensity(BUFF_INTENSITY);
+  if (blendFunc)
+  {
+    virtualBuffers.draw.SetPixelBlendFunc(blendFunc);
+  }
+
+  DrawShapes(virtualBuffers.draw);
+  auto staticDraw = GoomDrawTo<2U, BLEND_TYPE, TRANSPARENT_BGND>{staticBuffers.draw};
+  DrawShapes(staticDraw);
+
+  REQUIRE(staticDraw.GetBuffIntensity() == BUFF_INTENSITY);
+  REQUIRE(AreEqual(staticBuffers.buffer1, virtualBuffers.buffer1));
+  REQUIRE(AreEqual(staticBuffers.buffer2, virtualBuffers.buffer2));
+  REQUIRE(not AreEqual(staticBuffers.buffer1, TwoBuffers{Dimensions{WIDTH, HEIGHT}}.buffer1));
+  REQUIRE(staticBuffers.draw.GetDirtyTiles().GetTileMask() ==
+          virtualBuffers.draw.GetDirtyTiles().GetTileMask());
+}
+
+} // namespace
+
+// NOLINTBEGIN(bugprone-chained-comparison): Catch2 needs to fix this.
+// NOLINTBEGIN(readability-function-cognitive-complexity)
+TEST_CASE("GoomDrawTo Same As Virtual Draw - Default Blend")
+{
+  CheckSameAsVirtualDraw<PixelBlendRowType::COLOR_ADD>(DRAW::IGoomDraw::PixelBlendFunc{});
+}
+
+TEST_CASE("GoomDrawTo Same As Virtual Draw - Darken Only Blend")
+{
+  CheckSameAsVirtualDraw<PixelBlendRowType::DARKEN_ONLY>(GetDarkenOnlyPixelBlend);
+}
+
+TEST_CASE("GoomDrawTo Same As Virtual Draw - Transparent Bgnd Uses Fgnd")
+{
+  // The same rule as the random pixel blenders of the visual fx.
+  const auto blendFunc = [](const Pixel& bgndColor,
+                            const uint32_t intBuffIntensity,
+                            const Pixel& fgndColor,
+                            const PixelChannelType newAlpha)
+  {
+    if (0 == bgndColor.A())
+    {
+      return Pixel{fgndColor.R(), fgndColor.G(), fgndColor.B(), newAlpha};
+    }
+    return GetColorAddPixelBlend(bgndColor, intBuffIntensity, fgndColor, newAlpha);
+  };
+
+  CheckSameAsVirtualDraw<PixelBlendRowType::COLOR_ADD, TransparentBgnd::USE_FGND>(blendFunc);
+}
+
+TEST_CASE("GoomDrawTo Same As Virtual Draw - Single Buffer")
+{
+  auto virtualBuffer = PixelBufferVector{
+      Dimensions{WIDTH, HEIGHT}
+  };
+  auto staticBuffer = PixelBufferVector{
+      Dimensions{WIDTH, HEIGHT}
+  };
+  virtualBuffer.Fill(BGND_COLOR1);
+  staticBuffer.Fill(BGND_COLOR1);
+
+  auto virtualDraw = GoomDrawToSingleBuffer{
+      Dimensions{WIDTH, HEIGHT},
+      GetGoomLogger(),
+      virtualBuffer
+  };
+  auto staticDraw = GoomDrawTo<1U, PixelBlendRowType::COLOR_ADD>{
+      Dimensions{WIDTH, HEIGHT},
+      {&staticBuffer},
+      nullptr
+  };
+  virtualDraw.SetBuffIntensity(BUFF_INTENSITY);
+  staticDraw.SetBuffIntensity(BUFF_INTENSITY);
+
+  DrawShapes(virtualDraw);
+  DrawShapes(staticDraw);
+
+  REQUIRE(AreEqual(staticBuffer, virtualBuffer));
+  REQUIRE(staticDraw.GetPixel({.x = 3, .y = 4}) == virtualDraw.GetPixel({.x = 3, .y = 4}));
+}
+// NOLINTEND(readability-function-cognitive-complexity)
+// NOLINTEND(bugprone-chained-comparison)
+
+} // namespace GOOM::UNIT_TESTS
+
+// NOLINTEND(cert-err58-cpp): Catch2 3.6.0 issue
@@ -0,0 +1,216 @@
+// NOLINTBEGIN(cert-err58-cpp): Catch2 3.6.0 issue
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <vector>
+
+import Goom.Draw.DirtyTiles;
+import Goom.Draw.GoomDrawBase;
+import Goom.Draw.GoomDrawToBuffer;
+import Goom.Draw.GoomDrawToLayer;
+import Goom.Utils.Parallel;
+import Goom.Lib.GoomGraphic;
+import Goom.Lib.GoomTypes;
+import Goom.Lib.Point2d;
+import Goom.Tests.Draw.DrawHelper;
+
+namespace GOOM::UNIT_TESTS
+{
+
+using DRAW::GoomDrawToLayer;
+using DRAW::IGoomDraw;
+using DRAW::LayerCompositor;
+using DRAW::MultiplePixels;
+using UTILS::Parallel;
+
+namespace
+{
+
+constexpr auto NUM_POOL_THREADS = 4;
+
+// Like 'SubtractBlend', not commutative.
+[[nodiscard]] auto HalveAndAddBlend(const Pixel& bgndColor,
+                                    [[maybe_unused]] const uint32_t intBuffIntensity,
+                                    const Pixel& fgndColor,
+                                    [[maybe_unused]] const PixelChannelType newAlpha) -> Pixel
+{
+  return Pixel{
+      {.red   = static_cast<PixelChannelType>((bgndColor.R() / 2U) + fgndColor.R()),
+       .green = static_cast<PixelChannelType>((bgndColor.G() / 2U) + fgndColor.G()),
+       .blue  = static_cast<PixelChannelType>((bgndColor.B() / 2U) + fgndColor.B()),
+       .alpha = MAX_ALPHA}
+  };
+}
+
+// The two draws overlap, so some pixels get drawn by both, and by one more than once.
+auto DrawFirst(IGoomDraw& draw) noexcept -> void
+{
+  for (auto i = 0U; i < TEST_WIDTH; ++i)
+  {
+    const auto point = Point2dInt{.x = static_cast<int32_t>(i),
+                                  .y = static_cast<int32_t>((i * 3U) % TEST_HEIGHT)};
+    draw.DrawPixels(point, GetColors(i));
+    draw.DrawPixels(point, GetColors(i + 1));
+  }
+}
+
+auto DrawSecond(IGoomDraw& draw) noexcept -> void
+{
+  for (auto i = 0U; i < (2U * TEST_WIDTH); ++i)
+  {
+    const auto point = Point2dInt{.x = static_cast<int32_t>((i * 7U) % TEST_WIDTH),
+                                  .y = static_cast<int32_t>((i * 5U) % TEST_HEIGHT)};
+    draw.DrawPixels(point, GetColors(3U * i));
+  }
+  draw.DrawPixelsUnblended({.x = 1, .y = 3}, GetColors(1));
+}
+
+// Spans and runs over the first two draws, with the default blend.
+auto DrawThird(IGoomDraw& draw) noexcept -> void
+{
+  static constexpr auto SPAN_LENGTH = 100U;
+  for (auto y = 0; y < static_cast<int32_t>(TEST_HEIGHT); y += 3)
+  {
+    draw.DrawHorizontalSpan(
+        {.x = y % 50, .y = y}, SPAN_LENGTH, GetColors(static_cast<uint32_t>(y)));
+  }
+
+  auto run = std::vector<MultiplePixels>{};
+  for (auto i = 0U; i < (TEST_WIDTH - 10U); ++i)
+  {
+    run.emplace_back(GetColors(5U * i));
+  }
+  draw.DrawPixelRun({.x = 10, .y = 2}, run);
+  draw.DrawPixelRun({.x = 0, .y = static_cast<int32_t>(TEST_HEIGHT) - 1}, run);
+}
+
+} // namespace
+
+// NOLINTBEGIN(bugprone-chained-comparison): Catch2 needs to fix this.
+// NOLINTBEGIN(readability-function-cognitive-complexity)
+TEST_CASE("GoomDrawToLayer Same As Straight Draw")
+{
+  auto straightBuffers = TwoBuffers{};
+  auto straightDraw1   = GoomDrawToLayer{straightBuffers.draw};
+  auto straightDraw2   = GoomDrawToLayer{straightBuffers.draw};
+  straightDraw1.SetPixelBlendFunc(HalveAndAddBlend);
+  straightDraw2.SetPixelBlendFunc(SubtractBlend);
+  REQUIRE(not straightDraw1.IsDrawingToLayer());
+
+  DrawFirst(straightDraw1);
+  DrawSecond(straightDraw2);
+  REQUIRE(0U == straightDraw1.GetNumLayerPixels());
+  REQUIRE(0U == straightDraw2.GetNumLayerPixels());
+
+  auto layerBuffers = TwoBuffers{};
+  auto layerDraw1   = GoomDrawToLayer{layerBuffers.draw};
+  auto layerDraw2   = GoomDrawToLayer{layerBuffers.draw};
+  layerDraw1.SetPixelBlendFunc(HalveAndAddBlend);
+  layerDraw2.SetPixelBlendFunc(SubtractBlend);
+  layerDraw1.SetDrawToLayer(true);
+  layerDraw2.SetDrawToLayer(true);
+
+  // Draw the second layer first, as if its thread got there first.
+  DrawSecond(layerDraw2);
+  DrawFirst(layerDraw1);
+  REQUIRE((2U * TEST_WIDTH) == layerDraw1.GetNumLayerPixels());
+  REQUIRE(((2U * TEST_WIDTH) + 1U) == layerDraw2.GetNumLayerPixels());
+  REQUIRE(0U == layerBuffers.draw.GetDirtyTiles().GetNumDirtyTiles());
+  REQUIRE(AreEqual(layerBuffers.buffer1, TwoBuffers{}.buffer1));
+
+  auto parallel         = Parallel{NUM_POOL_THREADS};
+  auto layerCompositor  = LayerCompositor{parallel, layerBuffers.draw.GetDirtyTiles()};
+  const auto layers     = std::vector<GoomDrawToLayer*>{&layerDraw1, &layerDraw2};
+  layerCompositor.CompositeLayers(layers);
+
+  REQUIRE(AreEqual(layerBuffers.buffer1, straightBuffers.buffer1));
+  REQUIRE(AreEqual(layerBuffers.buffer2, straightBuffers.buffer2));
+  REQUIRE(layerBuffers.draw.GetDirtyTiles().GetTileMask() ==
+          straightBuffers.draw.GetDirtyTiles().GetTileMask());
+
+  REQUIRE(0U == layerDraw1.GetNumLayerPixels());
+  REQUIRE(0U == layerDraw2.GetNumLayerPixels());
+  REQUIRE(layerDraw1.GetLayerTiles().empty());
+}
+
+// The same draws as the layers record, done straight to the two buffers, switching the blend
+// and buffer intensity between them.
+TEST_CASE("LayerCompositor Same As Drawing To The Two Buffers")
+{
+  static constexpr auto BUFF_INTENSITY1 = 0.8F;
+  static constexpr auto BUFF_INTENSITY3 = 0.3F;
+
+  auto directBuffers = TwoBuffers{};
+  directBuffers.draw.SetPixelBlendFunc(HalveAndAddBlend);
+  directBuffers.draw.SetBuffIntensity(BUFF_INTENSITY1);
+  DrawFirst(directBuffers.draw);
+  directBuffers.draw.SetPixelBlendFunc(SubtractBlend);
+  directBuffers.draw.SetBuffIntensity(IGoomDraw::DEFAULT_BUFF_INTENSITY);
+  DrawSecond(directBuffers.draw);
+  directBuffers.draw.SetDefaultPixelBlendFunc();
+  directBuffers.draw.SetBuffIntensity(BUFF_INTENSITY3);
+  DrawThird(directBuffers.draw);
+
+  auto layerBuffers = TwoBuffers{};
+  auto layerDraw1   = GoomDrawToLayer{layerBuffers.draw};
+  auto layerDraw2   = GoomDrawToLayer{layerBuffers.draw};
+  auto layerDraw3   = GoomDrawToLayer{layerBuffers.draw};
+  layerDraw1.SetPixelBlendFunc(HalveAndAddBlend);
+  layerDraw1.SetBuffIntensity(BUFF_INTENSITY1);
+  layerDraw2.SetPixelBlendFunc(SubtractBlend);
+  layerDraw3.SetBuffIntensity(BUFF_INTENSITY3);
+  layerDraw1.SetDrawToLayer(true);
+  layerDraw2.SetDrawToLayer(true);
+  layerDraw3.SetDrawToLayer(true);
+
+  // The layers are drawn in the reverse of their composite order.
+  DrawThird(layerDraw3);
+  DrawSecond(layerDraw2);
+  DrawFirst(layerDraw1);
+
+  auto parallel        = Parallel{NUM_POOL_THREADS};
+  auto layerCompositor = LayerCompositor{parallel, layerBuffers.draw.GetDirtyTiles()};
+  const auto layers    = std::vector<GoomDrawToLayer*>{&layerDraw1, &layerDraw2, &layerDraw3};
+  layerCompositor.CompositeLayers(layers);
+
+  REQUIRE(not AreEqual(directBuffers.buffer1, TwoBuffers{}.buffer1));
+  REQUIRE(AreEqual(layerBuffers.buffer1, directBuffers.buffer1));
+  REQUIRE(AreEqual(layerBuffers.buffer2, directBuffers.buffer2));
+  REQUIRE(layerBuffers.draw.GetDirtyTiles().GetTileMask() ==
+          directBuffers.draw.GetDirtyTiles().GetTileMask());
+}
+
+TEST_CASE("GoomDrawToLayer Reused")
+{
+  auto buffers   = TwoBuffers{};
+  auto layerDraw = GoomDrawToLayer{buffers.draw};
+  layerDraw.SetDrawToLayer(true);
+
+  DrawFirst(layerDraw);
+  REQUIRE(0U != layerDraw.GetNumLayerPixels());
+
+  // Switching modes throws away anything not composited.
+  layerDraw.SetDrawToLayer(true);
+  REQUIRE(0U == layerDraw.GetNumLayerPixels());
+
+  auto parallel        = Parallel{NUM_POOL_THREADS};
+  auto layerCompositor = LayerCompositor{parallel, buffers.draw.GetDirtyTiles()};
+  const auto layers    = std::vector<GoomDrawToLayer*>{&layerDraw};
+  layerCompositor.CompositeLayers(layers);
+  REQUIRE(0U == buffers.draw.GetDirtyTiles().GetNumDirtyTiles());
+
+  static constexpr auto POINT = Point2dInt{.x = 2, .y = 1};
+  layerDraw.DrawPixels(POINT, GetColors(1));
+  layerCompositor.CompositeLayers(layers);
+  REQUIRE(1U == buffers.draw.GetDirtyTiles().GetNumDirtyTiles());
+  REQUIRE(buffers.buffer1(POINT.x, POINT.y) != BGND_COLOR1);
+
+  layerDraw.SetDrawToLayer(false);
+  REQUIRE(layerDraw.GetPixel(POINT) == buffers.buffer1(POINT.x, POINT.y));
+}
+// NOLINTEND(readability-function-cognitive-complexity)
+// NOLINTEND(bugprone-chained-comparison)
+
+} // namespace GOOM::UNIT_TESTS
+
+// NOLINTEND(cert-err58-cpp): Catch2 3.6.0 issue
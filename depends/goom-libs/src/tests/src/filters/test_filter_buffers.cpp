@@ -42,8 +42,8 @@ class TestFilterBuffers : public ZoomFilterBuffers
 public:
   TestFilterBuffers(const PluginInfo& goomInfo,
                     const NormalizedCoordsConverter& normalizedCoordsConverter,
-                    const ZoomFilterBuffers::ZoomPointFunc& getZoomPointFunc) noexcept
-    : ZoomFilterBuffers{goomInfo, normalizedCoordsConverter, getZoomPointFunc}
+                    const ZoomFilterBuffers::ZoomPointsFunc& getZoomPointsFunc) noexcept
+    : ZoomFilterBuffers{goomInfo, normalizedCoordsConverter, getZoomPointsFunc}
   {
   }
 
@@ -105,6 +105,8 @@ public:
 
   [[nodiscard]] auto GetZoomPoint(const NormalizedCoords& coords) const noexcept
       -> NormalizedCoords override;
+  auto GetZoomPoints(std::span<const NormalizedCoords> coords,
+                     std::span<NormalizedCoords> zoomPoints) const noexcept -> void override;
 
 private:
   bool m_returnConst;
@@ -128,6 +130,16 @@ auto TestZoomVector::GetZoomPoint(const NormalizedCoords& coords) const noexcept
   return (1.0F - m_zoomAdjustment) * coords;
 }
 
+auto TestZoomVector::GetZoomPoints(const std::span<const NormalizedCoords> coords,
+                                   const std::span<NormalizedCoords> zoomPoints) const noexcept
+    -> void
+{
+  for (auto i = 0U; i < coords.size(); ++i)
+  {
+    zoomPoints[i] = GetZoomPoint(coords[i]);
+  }
+}
+
 const auto IDENTITY_ZOOM_VECTOR = TestZoomVector{false};
 const auto CONSTANT_ZOOM_VECTOR = TestZoomVector{true};
 
@@ -135,8 +147,9 @@ const auto CONSTANT_ZOOM_VECTOR = TestZoomVector{true};
 {
   return TestFilterBuffers{GOOM_INFO,
                            NORMALIZED_COORDS_CONVERTER,
-                           [&zoomVector](const NormalizedCoords& normalizedCoords)
-                           { return zoomVector.GetZoomPoint(normalizedCoords); }};
+                           [&zoomVector](const std::span<const NormalizedCoords> normalizedCoords,
+                                         const std::span<NormalizedCoords> zoomPoints)
+                           { zoomVector.GetZoomPoints(normalizedCoords, zoomPoints); }};
 }
 
 constexpr auto TEST_X          = 10;
@@ -369,6 +382,78 @@ TEST_CASE("ZoomFilterBuffers Clipping")
     // TODO(glk) Test coeff values
   }
 }
+
+TEST_CASE("ZoomFilterBuffers Restart")
+{
+  auto filterBuffers = GetFilterBuffers(CONSTANT_ZOOM_VECTOR);
+  filterBuffers.SetTransformBufferMidpoint(MID_PT);
+  filterBuffers.Start();
+  REQUIRE(ZoomFilterBuffers::UpdateStatus::IN_PROGRESS == filterBuffers.GetUpdateStatus());
+  REQUIRE(0.0F == filterBuffers.GetTransformBufferProgress());
+
+  SECTION("Abandoned buffer goes back to start")
+  {
+    filterBuffers.RequestTransformBufferRestart();
+    REQUIRE(filterBuffers.IsTransformBufferRestartRequested());
+
+    filterBuffers.UpdateTransBuffer();
+    REQUIRE(ZoomFilterBuffers::UpdateStatus::AT_START == filterBuffers.GetUpdateStatus());
+    REQUIRE(not filterBuffers.IsTransformBufferRestartRequested());
+    REQUIRE(filterBuffers.GetTransformBufferProgress() < 1.0F);
+
+    filterBuffers.StartTransformBufferUpdates();
+    REQUIRE(ZoomFilterBuffers::UpdateStatus::IN_PROGRESS == filterBuffers.GetUpdateStatus());
+    REQUIRE(0.0F == filterBuffers.GetTransformBufferProgress());
+    filterBuffers.UpdateTransBuffer();
+    REQUIRE(ZoomFilterBuffers::UpdateStatus::AT_END == filterBuffers.GetUpdateStatus());
+    REQUIRE(1.0F == filterBuffers.GetTransformBufferProgress());
+  }
+  SECTION("Restart ignored once buffer is done")
+  {
+    filterBuffers.UpdateTransBuffer();
+    REQUIRE(ZoomFilterBuffers::UpdateStatus::AT_END == filterBuffers.GetUpdateStatus());
+    REQUIRE(1.0F == filterBuffers.GetTransformBufferProgress());
+
+    filterBuffers.RequestTransformBufferRestart();
+    REQUIRE(not filterBuffers.IsTransformBufferRestartRequested());
+    REQUIRE(ZoomFilterBuffers::UpdateStatus::AT_END == filterBuffers.GetUpdateStatus());
+  }
+}
+
+TEST_CASE("ZoomFilterBuffers Dest Buffer")
+{
+  auto filterBuffers = GetFilterBuffers(CONSTANT_ZOOM_VECTOR);
+  REQUIRE(filterBuffers.UsesOwnTransformBuffer());
+
+  auto destBuffVec    = std::vector<Point2dFlt>(GOOM_INFO.GetDimensions().GetSize());
+  const auto destBuff = std::span<Point2dFlt>{destBuffVec};
+  filterBuffers.SetTransformBufferDest(destBuff);
+  REQUIRE(not filterBuffers.UsesOwnTransformBuffer());
+  REQUIRE(destBuff.data() == filterBuffers.GetTransformBufferDest().data());
+
+  filterBuffers.SetTransformBufferMidpoint(MID_PT);
+  filterBuffers.Start();
+  filterBuffers.UpdateTransBuffer();
+  REQUIRE(ZoomFilterBuffers::UpdateStatus::AT_END == filterBuffers.GetUpdateStatus());
+
+  static constexpr auto NML_UNCENTERED_ZOOM_VECTOR_COORDS_1 =
+      NORMALIZED_COORDS_CONVERTER.OtherToNormalizedCoords(MID_PT) +
+      NORMALIZED_COORDS_CONVERTER.OtherToNormalizedCoords(CONST_ZOOM_VECTOR_COORDS_1);
+
+  // The buffer was produced in place, so there's nothing to copy.
+  for (const auto& destVal : destBuff)
+  {
+    REQUIRE(destVal.x == NML_UNCENTERED_ZOOM_VECTOR_COORDS_1.GetX());
+    REQUIRE(destVal.y == NML_UNCENTERED_ZOOM_VECTOR_COORDS_1.GetY());
+  }
+  filterBuffers.CopyTransformBuffer(destBuff);
+  REQUIRE(ZoomFilterBuffers::UpdateStatus::HAS_BEEN_COPIED == filterBuffers.GetUpdateStatus());
+
+  filterBuffers.ResetTransformBufferToStart();
+  filterBuffers.SetTransformBufferDest({});
+  REQUIRE(filterBuffers.UsesOwnTransformBuffer());
+}
+
 // NOLINTEND(readability-function-cognitive-complexity)
 // NOLINTEND(bugprone-chained-comparison)
 
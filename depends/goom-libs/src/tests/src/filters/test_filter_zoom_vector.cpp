@@ -8,23 +8,32 @@
 #pragma warning(pop)
 #endif
 
+#include <array>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_message.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 import Goom.FilterFx.AfterEffects.TheEffects.Rotation;
 import Goom.FilterFx.AfterEffects.AfterEffectsStates;
 import Goom.FilterFx.AfterEffects.AfterEffectsTypes;
+import Goom.FilterFx.FilterEffects.AdjustmentEffects.Amulet;
+import Goom.FilterFx.FilterEffects.AdjustmentEffects.CrystalBall;
+import Goom.FilterFx.FilterEffects.AdjustmentEffects.Scrunch;
 import Goom.FilterFx.FilterEffects.AdjustmentEffects.UniformZoomAdjustmentEffect;
+import Goom.FilterFx.FilterEffects.AdjustmentEffects.ZoomAdjustmentKernels;
+import Goom.FilterFx.FilterEffects.ZoomAdjustmentEffect;
 import Goom.FilterFx.FilterEffects.ZoomVectorEffects;
 import Goom.FilterFx.FilterSettings;
 import Goom.FilterFx.FilterSpeed;
 import Goom.FilterFx.FilterZoomVector;
 import Goom.FilterFx.NormalizedCoords;
+import Goom.Utils.CpuFeatures;
 import Goom.Utils.EnumUtils;
 import Goom.Utils.Math.GoomRand;
+import Goom.Lib.Point2d;
 
 namespace GOOM::UNIT_TESTS
 {
@@ -37,9 +46,17 @@ using FILTER_FX::Vitesse;
 using FILTER_FX::AFTER_EFFECTS::AfterEffectsTypes;
 using FILTER_FX::AFTER_EFFECTS::HypercosOverlayMode;
 using FILTER_FX::AFTER_EFFECTS::RotationAdjustments;
+using FILTER_FX::FILTER_EFFECTS::Amulet;
+using FILTER_FX::FILTER_EFFECTS::CrystalBall;
+using FILTER_FX::FILTER_EFFECTS::GetRadialVelocityZoomAdjustments;
+using FILTER_FX::FILTER_EFFECTS::IZoomAdjustmentEffect;
+using FILTER_FX::FILTER_EFFECTS::RadialVelocityParams;
+using FILTER_FX::FILTER_EFFECTS::Scrunch;
 using FILTER_FX::FILTER_EFFECTS::UniformZoomAdjustmentEffect;
 using FILTER_FX::FILTER_EFFECTS::ZoomVectorEffects;
 using UTILS::EnumMap;
+using UTILS::IsSimdLevelSupported;
+using UTILS::SimdLevel;
 using UTILS::MATH::GoomRand;
 
 namespace
@@ -189,6 +206,144 @@ TEST_CASE("FilterZoomVector")
   }
 }
 
+TEST_CASE("FilterZoomVector Batched Zoom Points")
+{
+  auto filterZoomVector = FilterZoomVector{WIDTH, RESOURCES_DIRECTORY, GOOM_RAND};
+
+  auto filterSettings = GetZoomFilterEffectsSettings();
+  filterSettings.vitesse.SetVitesse(Vitesse::STOP_SPEED + 1U);
+
+  // Odd number of coords to make sure partial batches are handled.
+  static constexpr auto NUM_COORDS = 301U;
+  static constexpr auto Y_COORD    = 0.3F;
+  static constexpr auto X_STEP =
+      NormalizedCoords::COORD_WIDTH / static_cast<float>(NUM_COORDS - 1);
+
+  auto coords = std::vector<NormalizedCoords>{};
+  for (auto i = 0U; i < NUM_COORDS; ++i)
+  {
+    coords.emplace_back(NormalizedCoords::MIN_COORD + (static_cast<float>(i) * X_STEP), Y_COORD);
+  }
+
+  const auto testBatchedZoomPoints = [&filterZoomVector, &coords]()
+  {
+    auto zoomPoints = std::vector<NormalizedCoords>(coords.size());
+    filterZoomVector.GetZoomPoints(coords, zoomPoints);
+
+    for (auto i = 0U; i < coords.size(); ++i)
+    {
+      const auto expectedZoomPoint = filterZoomVector.GetZoomPoint(coords[i]);
+      UNSCOPED_INFO("i = " << i);
+      REQUIRE(zoomPoints[i].GetX() == Approx(expectedZoomPoint.GetX()));
+      REQUIRE(zoomPoints[i].GetY() == Approx(expectedZoomPoint.GetY()));
+    }
+  };
+
+  SECTION("No Effects")
+  {
+    filterZoomVector.SetFilterEffectsSettings(filterSettings);
+    testBatchedZoomPoints();
+  }
+  SECTION("Multiplier and After Effects")
+  {
+    filterSettings.filterMultiplierEffectsSettings.isActive                         = true;
+    filterSettings.afterEffectsSettings.isActive[AfterEffectsTypes::ROTATION]       = true;
+    filterSettings.afterEffectsSettings.isActive[AfterEffectsTypes::XY_LERP_EFFECT] = true;
+    filterZoomVector.SetFilterEffectsSettings(filterSettings);
+    testBatchedZoomPoints();
+  }
+}
+
+TEST_CASE("Zoom Adjustment Row Kernels")
+{
+  // Not a multiple of any SIMD width to make sure the scalar tail is handled.
+  static constexpr auto NUM_COORDS = 301U;
+  static constexpr auto Y_COORD    = -0.7F;
+  static constexpr auto X_STEP =
+      NormalizedCoords::COORD_WIDTH / static_cast<float>(NUM_COORDS - 1);
+
+  auto coords = std::vector<NormalizedCoords>{};
+  for (auto i = 0U; i < NUM_COORDS; ++i)
+  {
+    coords.emplace_back(NormalizedCoords::MIN_COORD + (static_cast<float>(i) * X_STEP), Y_COORD);
+  }
+
+  // The kernels are meant to be bit-identical, so no Approx here.
+  SECTION("SIMD Levels Match Scalar")
+  {
+    static constexpr auto PARAMS = RadialVelocityParams{
+        .viewportOffset = {.x = 0.1F, .y = -0.2F},
+        .viewportScale  = {.x = 0.5F, .y = 0.7F},
+        .baseVelocity   = {.x = 0.03F, .y = 0.04F},
+        .amplitude      = {.x = -0.05F, .y = 0.02F},
+        .sqDistMult     = {.x = 0.3F, .y = 1.7F},
+        .sqDistOffset   = {.x = 0.2F, .y = -0.1F},
+    };
+    static constexpr auto Y_FROM_X_PARAMS = RadialVelocityParams{
+        .baseVelocity    = {.x = 0.03F, .y = 0.04F},
+        .amplitude       = {.x = -0.05F, .y = 0.02F},
+        .yVelocityFromX  = true,
+        .yVelocityFactor = 1.3F,
+    };
+    static constexpr auto ALL_PARAMS = std::array{PARAMS, Y_FROM_X_PARAMS};
+    static constexpr auto SIMD_LEVELS =
+        std::array{SimdLevel::SCALAR, SimdLevel::SSE4_1, SimdLevel::AVX2};
+
+    for (const auto& params : ALL_PARAMS)
+    {
+      auto expectedZoomAdjustments = std::vector<Vec2dFlt>(coords.size());
+      GetRadialVelocityZoomAdjustments(
+          SimdLevel::SCALAR, params, coords, expectedZoomAdjustments);
+
+      for (const auto simdLevel : SIMD_LEVELS)
+      {
+        if (not IsSimdLevelSupported(simdLevel))
+        {
+          continue;
+        }
+
+        auto zoomAdjustments = std::vector<Vec2dFlt>(coords.size());
+        GetRadialVelocityZoomAdjustments(simdLevel, params, coords, zoomAdjustments);
+
+        for (auto i = 0U; i < coords.size(); ++i)
+        {
+          UNSCOPED_INFO("simdLevel = " << static_cast<int>(simdLevel) << ", i = " << i);
+          REQUIRE(zoomAdjustments[i].x == expectedZoomAdjustments[i].x);
+          REQUIRE(zoomAdjustments[i].y == expectedZoomAdjustments[i].y);
+        }
+      }
+    }
+  }
+
+  SECTION("Effects Match Single Point")
+  {
+    static constexpr auto BASE_ZOOM_ADJUSTMENT = Vec2dFlt{.x = 0.02F, .y = 0.03F};
+
+    auto effects = std::vector<std::unique_ptr<IZoomAdjustmentEffect>>{};
+    effects.emplace_back(std::make_unique<Amulet>(GOOM_RAND));
+    effects.emplace_back(std::make_unique<Scrunch>(GOOM_RAND));
+    effects.emplace_back(std::make_unique<CrystalBall>(CrystalBall::Modes::MODE0, GOOM_RAND));
+    effects.emplace_back(std::make_unique<CrystalBall>(CrystalBall::Modes::MODE1, GOOM_RAND));
+
+    for (auto& effect : effects)
+    {
+      effect->SetBaseZoomAdjustment(BASE_ZOOM_ADJUSTMENT);
+      effect->SetRandomParams();
+
+      auto zoomAdjustments = std::vector<Vec2dFlt>(coords.size());
+      effect->GetZoomAdjustments(coords, zoomAdjustments);
+
+      for (auto i = 0U; i < coords.size(); ++i)
+      {
+        const auto expectedZoomAdjustment = effect->GetZoomAdjustment(coords[i]);
+        UNSCOPED_INFO("i = " << i);
+        REQUIRE(zoomAdjustments[i].x == expectedZoomAdjustment.x);
+        REQUIRE(zoomAdjustments[i].y == expectedZoomAdjustment.y);
+      }
+    }
+  }
+}
+
 // NOLINTEND(bugprone-chained-comparison)
 
 } // namespace GOOM::UNIT_TESTS
@@ -0,0 +1,175 @@
+// NOLINTBEGIN(cert-err58-cpp): Catch2 3.6.0 issue
+
+#include <array>
+#include <catch2/catch_message.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+import Goom.Utils.CpuFeatures;
+import Goom.Utils.Graphics.PixelBlend;
+import Goom.Lib.GoomGraphic;
+
+namespace GOOM::UNIT_TESTS
+{
+
+using UTILS::IsSimdLevelSupported;
+using UTILS::SimdLevel;
+using UTILS::GRAPHICS::BlendPixelRow;
+using UTILS::GRAPHICS::GetColorAddPixelBlend;
+using UTILS::GRAPHICS::GetColorAlphaAndAddBlend;
+using UTILS::GRAPHICS::GetColorAlphaNoAddBlend;
+using UTILS::GRAPHICS::GetColorMultiplyPixelBlend;
+using UTILS::GRAPHICS::GetDarkenOnlyPixelBlend;
+using UTILS::GRAPHICS::GetLightenOnlyPixelBlend;
+using UTILS::GRAPHICS::PixelBlendRowType;
+
+namespace
+{
+
+// Odd, so the SIMD kernels have a tail to do.
+constexpr auto ROW_LENGTH = 301U;
+
+constexpr auto SIMD_LEVELS = std::array{SimdLevel::SCALAR, SimdLevel::SSE4_1, SimdLevel::AVX2};
+constexpr auto BLEND_TYPES = std::array{
+    PixelBlendRowType::COLOR_ADD,
+    PixelBlendRowType::DARKEN_ONLY,
+    PixelBlendRowType::LIGHTEN_ONLY,
+    PixelBlendRowType::COLOR_MULTIPLY,
+    PixelBlendRowType::COLOR_ALPHA,
+    PixelBlendRowType::COLOR_ALPHA_AND_ADD,
+};
+constexpr auto BUFF_INTENSITIES = std::array{0U, 128U, 256U, 777U};
+
+[[nodiscard]] auto GetSingleBlendedPixel(const PixelBlendRowType blendType,
+                                         const Pixel& bgndColor,
+                                         const uint32_t intBuffIntensity,
+                                         const Pixel& fgndColor) noexcept -> Pixel
+{
+  switch (blendType)
+  {
+    case PixelBlendRowType::COLOR_ADD:
+      return GetColorAddPixelBlend(bgndColor, intBuffIntensity, fgndColor, fgndColor.A());
+    case PixelBlendRowType::DARKEN_ONLY:
+      return GetDarkenOnlyPixelBlend(bgndColor, intBuffIntensity, fgndColor, fgndColor.A());
+    case PixelBlendRowType::LIGHTEN_ONLY:
+      return GetLightenOnlyPixelBlend(bgndColor, intBuffIntensity, fgndColor, fgndColor.A());
+    case PixelBlendRowType::COLOR_MULTIPLY:
+      return GetColorMultiplyPixelBlend(bgndColor, intBuffIntensity, fgndColor, fgndColor.A());
+    case PixelBlendRowType::COLOR_ALPHA:
+      return GetColorAlphaNoAddBlend(bgndColor, intBuffIntensity, fgndColor, fgndColor.A());
+    case PixelBlendRowType::COLOR_ALPHA_AND_ADD:
+      return GetColorAlphaAndAddBlend(bgndColor, intBuffIntensity, fgndColor, fgndColor.A());
+  }
+  return bgndColor;
+}
+
+// A mix of near black, ordinary and HDR colors, so all the blend branches get used.
+[[nodiscard]] auto GetRandomRow(std::mt19937& randGen) noexcept -> std::vector<Pixel>
+{
+  static constexpr auto NEAR_BLACK_MAX = 40U;
+  static constexpr auto CHANNEL_MAXES =
+      std::array{NEAR_BLACK_MAX, static_cast<uint32_t>(MAX_COLOR_VAL), MAX_CHANNEL_VALUE_HDR};
+
+  auto row = std::vector<Pixel>(ROW_LENGTH);
+  for (auto& pixel : row)
+  {
+    const auto channelMax = CHANNEL_MAXES.at(randGen() % CHANNEL_MAXES.size());
+    const auto channel    = [&randGen, &channelMax]
+    { return static_cast<PixelChannelType>(randGen() % (channelMax + 1U)); };
+    const auto alpha = (0U == (randGen() % 3U)) ? MAX_ALPHA
+                                                : static_cast<PixelChannelType>(randGen());
+
+    pixel = Pixel{channel(), channel(), channel(), alpha};
+  }
+  return row;
+}
+
+auto CheckRowsMatch(const std::vector<Pixel>& row, const std::vector<Pixel>& expectedRow) noexcept
+    -> void
+{
+  for (auto i = 0U; i < expectedRow.size(); ++i)
+  {
+    UNSCOPED_INFO("i = " << i);
+    REQUIRE(row[i] == expectedRow[i]);
+  }
+}
+
+} // namespace
+
+// NOLINTBEGIN(bugprone-chained-comparison): Catch2 needs to fix this.
+// NOLINTBEGIN(readability-function-cognitive-complexity)
+TEST_CASE("Pixel Blend Rows Match Single Pixel Blends")
+{
+  auto randGen          = std::mt19937{}; // NOLINT(cert-msc51-cpp): Want repeatable rows.
+  const auto fgndColors = GetRandomRow(randGen);
+  const auto bgndColors = GetRandomRow(randGen);
+
+  for (const auto blendType : BLEND_TYPES)
+  {
+    for (const auto intBuffIntensity : BUFF_INTENSITIES)
+    {
+      auto expectedRow          = bgndColors;
+      auto expectedSpanRow      = bgndColors;
+      const auto& fgndSpanColor = fgndColors.front();
+      for (auto i = 0U; i < ROW_LENGTH; ++i)
+      {
+        expectedRow[i] =
+            GetSingleBlendedPixel(blendType, bgndColors[i], intBuffIntensity, fgndColors[i]);
+        expectedSpanRow[i] =
+            GetSingleBlendedPixel(blendType, bgndColors[i], intBuffIntensity, fgndSpanColor);
+      }
+
+      for (const auto simdLevel : SIMD_LEVELS)
+      {
+        if (not IsSimdLevelSupported(simdLevel))
+        {
+          continue;
+        }
+        UNSCOPED_INFO("blendType = " << static_cast<int>(blendType)
+                                     << ", intBuffIntensity = " << intBuffIntensity
+                                     << ", simdLevel = " << static_cast<int>(simdLevel));
+
+        auto row = bgndColors;
+        BlendPixelRow(simdLevel, blendType, intBuffIntensity, fgndColors, row);
+        CheckRowsMatch(row, expectedRow);
+
+        auto spanRow = bgndColors;
+        BlendPixelRow(simdLevel, blendType, intBuffIntensity, fgndSpanColor, spanRow);
+        CheckRowsMatch(spanRow, expectedSpanRow);
+      }
+    }
+  }
+}
+
+TEST_CASE("Pixel Blend Rows Short And Empty")
+{
+  static constexpr auto BGND_COLOR = Pixel{100U, 200U, 300U, MAX_ALPHA};
+  static constexpr auto FGND_COLOR = Pixel{50U, 60U, 70U, MAX_ALPHA};
+  static constexpr auto INTENSITY  = 128U;
+
+  for (const auto simdLevel : SIMD_LEVELS)
+  {
+    if (not IsSimdLevelSupported(simdLevel))
+    {
+      continue;
+    }
+
+    auto emptyRow = std::vector<Pixel>{};
+    BlendPixelRow(simdLevel, PixelBlendRowType::COLOR_ADD, INTENSITY, FGND_COLOR, emptyRow);
+    REQUIRE(emptyRow.empty());
+
+    auto row = std::vector<Pixel>{BGND_COLOR};
+    BlendPixelRow(simdLevel, PixelBlendRowType::COLOR_ADD, INTENSITY, FGND_COLOR, row);
+    REQUIRE(row.front() ==
+            GetColorAddPixelBlend(BGND_COLOR, INTENSITY, FGND_COLOR, FGND_COLOR.A()));
+  }
+}
+// NOLINTEND(readability-function-cognitive-complexity)
+// NOLINTEND(bugprone-chained-comparison)
+
+} // namespace GOOM::UNIT_TESTS
+
+// NOLINTEND(cert-err58-cpp): Catch2 3.6.0 issue
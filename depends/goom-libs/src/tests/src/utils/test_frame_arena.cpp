@@ -0,0 +1,106 @@
+// NOLINTBEGIN(cert-err58-cpp): Catch2 3.6.0 issue
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+import Goom.Utils.FrameArena;
+
+namespace GOOM::UNIT_TESTS
+{
+
+using UTILS::FrameArena;
+
+// NOLINTBEGIN(bugprone-chained-comparison): Catch2 needs to fix this.
+// NOLINTBEGIN(readability-function-cognitive-complexity)
+
+TEST_CASE("FrameArena Usage")
+{
+  static constexpr auto BLOCK_SIZE = 1024U;
+  auto frameArena                  = FrameArena{BLOCK_SIZE};
+  REQUIRE(frameArena.GetBlockSize() == BLOCK_SIZE);
+  REQUIRE(frameArena.GetNumFrames() == 0);
+
+  auto* const ptr1 = frameArena.allocate(100U, alignof(uint32_t));
+  auto* const ptr2 = frameArena.allocate(20U, alignof(uint64_t));
+  REQUIRE(ptr1 != nullptr);
+  REQUIRE(ptr2 != nullptr);
+  REQUIRE(ptr1 != ptr2);
+  REQUIRE(reinterpret_cast<uintptr_t>(ptr2) % alignof(uint64_t) == 0);
+  frameArena.deallocate(ptr1, 100U, alignof(uint32_t));
+  REQUIRE(frameArena.GetCurrentFrameUsage().numAllocations == 2);
+  REQUIRE(frameArena.GetCurrentFrameUsage().numBytes == 120);
+
+  frameArena.Reset();
+  REQUIRE(frameArena.GetNumFrames() == 1);
+  REQUIRE(frameArena.GetCurrentFrameUsage().numAllocations == 0);
+  REQUIRE(frameArena.GetCurrentFrameUsage().numBytes == 0);
+  REQUIRE(frameArena.GetLastFrameUsage().numAllocations == 2);
+  REQUIRE(frameArena.GetLastFrameUsage().numBytes == 120);
+
+  // After a reset, the block is used again from the start.
+  REQUIRE(frameArena.allocate(100U, alignof(uint32_t)) == ptr1);
+
+  frameArena.Reset();
+  REQUIRE(frameArena.GetNumFrames() == 2);
+  REQUIRE(frameArena.GetLastFrameUsage().numAllocations == 1);
+  REQUIRE(frameArena.GetLastFrameUsage().numBytes == 100);
+  REQUIRE(frameArena.GetMaxFrameUsage().numAllocations == 2);
+  REQUIRE(frameArena.GetMaxFrameUsage().numBytes == 120);
+  REQUIRE(frameArena.GetTotalUsage().numAllocations == 3);
+  REQUIRE(frameArena.GetTotalUsage().numBytes == 220);
+  REQUIRE(frameArena.GetBlockSize() == BLOCK_SIZE);
+}
+
+TEST_CASE("FrameArena Grows")
+{
+  static constexpr auto BLOCK_SIZE = 256U;
+  auto frameArena                  = FrameArena{BLOCK_SIZE};
+
+  static constexpr auto NUM_VALUES = 1000U;
+  const auto fillValues = [&frameArena]
+  {
+    auto values = std::pmr::vector<uint32_t>{&frameArena};
+    for (auto i = 0U; i < NUM_VALUES; ++i)
+    {
+      values.emplace_back(i);
+    }
+    REQUIRE(values.size() == NUM_VALUES);
+    REQUIRE(values.back() == NUM_VALUES - 1);
+  };
+
+  // The first frame overflows the block, the next frames fit.
+  fillValues();
+  const auto firstFrameNumBytes = frameArena.GetCurrentFrameUsage().numBytes;
+  REQUIRE(firstFrameNumBytes > BLOCK_SIZE);
+  frameArena.Reset();
+  REQUIRE(frameArena.GetBlockSize() >= firstFrameNumBytes);
+
+  const auto grownBlockSize = frameArena.GetBlockSize();
+  fillValues();
+  frameArena.Reset();
+  REQUIRE(frameArena.GetBlockSize() == grownBlockSize);
+  REQUIRE(frameArena.GetLastFrameUsage().numBytes == firstFrameNumBytes);
+  REQUIRE(frameArena.GetMaxFrameUsage().numBytes == firstFrameNumBytes);
+}
+
+TEST_CASE("FrameArena Block Size Is Limited")
+{
+  auto frameArena = FrameArena{};
+
+  static constexpr auto LARGE_SIZE = 2U * FrameArena::MAX_BLOCK_SIZE;
+  REQUIRE(frameArena.allocate(LARGE_SIZE, alignof(std::byte)) != nullptr);
+  frameArena.Reset();
+
+  REQUIRE(frameArena.GetBlockSize() == FrameArena::MAX_BLOCK_SIZE);
+  REQUIRE(frameArena.GetLastFrameUsage().numBytes == LARGE_SIZE);
+}
+
+// NOLINTEND(readability-function-cognitive-complexity)
+// NOLINTEND(bugprone-chained-comparison)
+
+} // namespace GOOM::UNIT_TESTS
+
+// NOLINTEND(cert-err58-cpp): Catch2 3.6.0 issue
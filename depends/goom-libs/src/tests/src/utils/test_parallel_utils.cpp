@@ -1,5 +1,8 @@
 // NOLINTBEGIN(cert-err58-cpp): Catch2 3.6.0 issue
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <catch2/catch_message.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <cstdint>
@@ -15,6 +18,7 @@ namespace GOOM::UNIT_TESTS
 {
 
 using UTILS::Parallel;
+using UTILS::TaskPriority;
 
 // NOLINTBEGIN(bugprone-chained-comparison): Catch2 needs to fix this.
 TEST_CASE("Test Parallel Utils", "[ParallelFor]")
@@ -50,7 +54,9 @@ TEST_CASE("Test Parallel Utils", "[ParallelFor]")
     }
     UNSCOPED_INFO("numSupportedConcurrentThreads = " << numSupportedConcurrentThreads);
     REQUIRE(parallel.GetNumThreadsUsed() == expectedNumThreadsUsed);
-    REQUIRE(threadsUsed.size() == expectedNumThreadsUsed);
+    // The calling thread takes chunks as well as the pool threads.
+    REQUIRE(threadsUsed.contains(std::this_thread::get_id()));
+    REQUIRE(threadsUsed.size() == (expectedNumThreadsUsed + 1));
   };
 
   auto parallel               = std::make_unique<Parallel>(-1);
@@ -71,6 +77,78 @@ TEST_CASE("Test Parallel Utils", "[ParallelFor]")
   parallel->ForLoop(ARRAY_LEN, assignFunc);
   checkResults(*parallel, expectedNumThreadsUsed);
 }
+
+TEST_CASE("Test Parallel Utils Each Iteration Done Once", "[ParallelFor]")
+{
+  static constexpr auto NUM_POOL_THREADS = 4;
+  auto parallel                          = Parallel{NUM_POOL_THREADS};
+
+  const auto testNumIters = [&parallel](const uint32_t numIters)
+  {
+    auto iterCounts = std::vector<std::atomic<uint32_t>>(numIters);
+
+    // Make some iterations much slower than the others so that work gets stolen.
+    static constexpr auto SLOW_ITER_PERIOD = 97U;
+    static constexpr auto NUM_SLOW_STEPS   = 10000U;
+    parallel.ForLoop(numIters,
+                     [&iterCounts](const size_t i)
+                     {
+                       if (0 == (i % SLOW_ITER_PERIOD))
+                       {
+                         auto sum = std::atomic<uint64_t>{0U};
+                         for (auto j = 0U; j < NUM_SLOW_STEPS; ++j)
+                         {
+                           sum += j;
+                         }
+                       }
+                       ++iterCounts[i];
+                     });
+
+    for (auto i = 0U; i < numIters; ++i)
+    {
+      UNSCOPED_INFO("numIters = " << numIters << ", i = " << i);
+      REQUIRE(iterCounts[i] == 1U);
+    }
+  };
+
+  static constexpr auto NUM_ITERS_TO_TEST = std::array{1U, 2U, 3U, 17U, 1000U, 12345U};
+  for (const auto numIters : NUM_ITERS_TO_TEST)
+  {
+    testNumIters(numIters);
+  }
+}
+
+TEST_CASE("Test Parallel Utils Shared Pool Priorities", "[ParallelFor]")
+{
+  static constexpr auto NUM_ITERS = 5000U;
+  static constexpr auto NUM_LOOPS = 20U;
+
+  const auto runLoops = [](const TaskPriority taskPriority)
+  {
+    auto parallel = Parallel{taskPriority};
+    auto allOk    = true;
+    for (auto loop = 0U; loop < NUM_LOOPS; ++loop)
+    {
+      auto iterCounts = std::vector<std::atomic<uint32_t>>(NUM_ITERS);
+      parallel.ForLoop(NUM_ITERS, [&iterCounts](const size_t i) { ++iterCounts[i]; });
+      allOk = allOk and std::ranges::all_of(iterCounts,
+                                            [](const auto& count) { return 1U == count; });
+    }
+    return allOk;
+  };
+
+  // Both priorities share the one pool at the same time.
+  auto backgroundOk     = false;
+  auto backgroundThread = std::thread{[&backgroundOk, &runLoops]
+                                      { backgroundOk = runLoops(TaskPriority::BACKGROUND); }};
+
+  const auto frameCriticalOk = runLoops(TaskPriority::FRAME_CRITICAL);
+  backgroundThread.join();
+
+  REQUIRE(frameCriticalOk);
+  REQUIRE(backgroundOk);
+}
+
 // NOLINTEND(bugprone-chained-comparison)
 
 } // namespace GOOM::UNIT_TESTS
@@ -0,0 +1,102 @@
+// NOLINTBEGIN(cert-err58-cpp): Catch2 3.6.0 issue
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+import Goom.Utils.StageTimings;
+
+namespace GOOM::UNIT_TESTS
+{
+
+using UTILS::ScopedStageTimer;
+using UTILS::StageTimings;
+
+// NOLINTBEGIN(bugprone-chained-comparison): Catch2 needs to fix this.
+// NOLINTBEGIN(readability-function-cognitive-complexity)
+
+TEST_CASE("StageTimings Totals")
+{
+  auto stageTimings = StageTimings{
+      std::vector<std::string>{"stage0", "stage1"}
+  };
+  REQUIRE(stageTimings.GetNumStages() == 2);
+  REQUIRE(stageTimings.GetStageName(1) == "stage1");
+
+  const auto newStage = stageTimings.AddStage("stage2");
+  REQUIRE(newStage == 2);
+  REQUIRE(stageTimings.GetNumStages() == 3);
+  REQUIRE(stageTimings.GetStageName(newStage) == "stage2");
+
+  stageTimings.AddTime(1, 10U);
+  stageTimings.AddTime(1, 30U);
+  stageTimings.AddTime(1, 20U);
+
+  REQUIRE(stageTimings.GetNumTimes(0) == 0);
+  REQUIRE(stageTimings.GetTotalTimeInNs(0) == 0);
+  REQUIRE(stageTimings.GetLastTimeInNs(0) == 0);
+  REQUIRE(stageTimings.GetRecentPercentileTimeInNs(0, 50.0F) == 0);
+
+  REQUIRE(stageTimings.GetNumTimes(1) == 3);
+  REQUIRE(stageTimings.GetTotalTimeInNs(1) == 60);
+  REQUIRE(stageTimings.GetMaxTimeInNs(1) == 30);
+  REQUIRE(stageTimings.GetLastTimeInNs(1) == 20);
+
+  stageTimings.Reset();
+  REQUIRE(stageTimings.GetNumTimes(1) == 0);
+  REQUIRE(stageTimings.GetTotalTimeInNs(1) == 0);
+  REQUIRE(stageTimings.GetMaxTimeInNs(1) == 0);
+  REQUIRE(stageTimings.GetNumStages() == 3);
+}
+
+TEST_CASE("StageTimings Percentiles")
+{
+  auto stageTimings = StageTimings{
+      std::vector<std::string>{"stage"}
+  };
+
+  for (auto i = 100U; i >= 1U; --i)
+  {
+    stageTimings.AddTime(0, i);
+  }
+
+  REQUIRE(stageTimings.GetRecentPercentileTimeInNs(0, 0.0F) == 1);
+  REQUIRE(stageTimings.GetRecentPercentileTimeInNs(0, 50.0F) == 51);
+  REQUIRE(stageTimings.GetRecentPercentileTimeInNs(0, 99.0F) == 99);
+  REQUIRE(stageTimings.GetRecentPercentileTimeInNs(0, 100.0F) == 100);
+
+  // Only the most recent times count towards the percentiles.
+  static constexpr auto BIG_TIME = 1000U;
+  for (auto i = 0U; i < StageTimings::NUM_RECENT_TIMES; ++i)
+  {
+    stageTimings.AddTime(0, BIG_TIME);
+  }
+  REQUIRE(stageTimings.GetRecentPercentileTimeInNs(0, 0.0F) == BIG_TIME);
+  REQUIRE(stageTimings.GetRecentPercentileTimeInNs(0, 100.0F) == BIG_TIME);
+  REQUIRE(stageTimings.GetNumTimes(0) == 100 + StageTimings::NUM_RECENT_TIMES);
+  REQUIRE(stageTimings.GetLastTimeInNs(0) == BIG_TIME);
+}
+
+TEST_CASE("ScopedStageTimer")
+{
+  auto stageTimings = StageTimings{
+      std::vector<std::string>{"stage0", "stage1"}
+  };
+
+  {
+    const auto stageTimer = ScopedStageTimer{stageTimings, 1};
+    REQUIRE(stageTimings.GetNumTimes(1) == 0);
+  }
+
+  REQUIRE(stageTimings.GetNumTimes(0) == 0);
+  REQUIRE(stageTimings.GetNumTimes(1) == 1);
+  REQUIRE(stageTimings.GetTotalTimeInNs(1) == stageTimings.GetLastTimeInNs(1));
+}
+
+// NOLINTEND(readability-function-cognitive-complexity)
+// NOLINTEND(bugprone-chained-comparison)
+
+} // namespace GOOM::UNIT_TESTS
+
+// NOLINTEND(cert-err58-cpp): Catch2 3.6.0 issue
@@ -0,0 +1,138 @@
+// NOLINTBEGIN(cert-err58-cpp): Catch2 3.6.0 issue
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+import Goom.Draw.ShaperDrawers.TextDrawer;
+import Goom.Tests.Draw.DrawHelper;
+import Goom.Utils.Text.CachedText;
+import Goom.Lib.GoomGraphic;
+import Goom.Lib.GoomTypes;
+import Goom.Lib.Point2d;
+
+namespace GOOM::UNIT_TESTS
+{
+
+using DRAW::SHAPE_DRAWERS::TextDrawer;
+using UTILS::TEXT::CachedText;
+
+namespace
+{
+
+constexpr auto FONT_SIZE     = 30;
+constexpr auto OUTLINE_WIDTH = 1.0F;
+constexpr auto TEXT          = "Goom Text";
+
+[[nodiscard]] auto GetFontFile() -> std::string
+{
+  return (std::filesystem::path{__FILE__}.parent_path().parent_path().parent_path() /
+          "Rubik-Regular.ttf")
+      .string();
+}
+
+// The colors change along the text and across each char, so a misplaced span shows up.
+[[nodiscard]] auto GetFontColor(const size_t textIndexOfChar,
+                                const Point2dInt& pen,
+                                [[maybe_unused]] const Dimensions& charDimensions) -> Pixel
+{
+  return Pixel{
+      {.red   = static_cast<PixelChannelType>(50U + (20U * textIndexOfChar)),
+       .green = static_cast<PixelChannelType>((3 * pen.x) % 256),
+       .blue  = static_cast<PixelChannelType>((5 * pen.y) % 256),
+       .alpha = MAX_ALPHA}
+  };
+}
+
+[[nodiscard]] auto GetOutlineFontColor(const size_t textIndexOfChar,
+                                       [[maybe_unused]] const Point2dInt& pen,
+                                       [[maybe_unused]] const Dimensions& charDimensions)
+    -> Pixel
+{
+  return Pixel{
+      {.red   = 5U,
+       .green = static_cast<PixelChannelType>(10U * textIndexOfChar),
+       .blue  = 200U,
+       .alpha = MAX_ALPHA}
+  };
+}
+
+auto SetUpTextDrawer(TextDrawer& textDrawer, const float charSpacing) -> void
+{
+  textDrawer.SetFontFile(GetFontFile());
+  textDrawer.SetFontSize(FONT_SIZE);
+  textDrawer.SetOutlineWidth(OUTLINE_WIDTH);
+  textDrawer.SetCharSpacing(charSpacing);
+  textDrawer.SetAlignment(TextDrawer::TextAlignment::CENTER);
+  textDrawer.SetParallelRender(false);
+  textDrawer.SetFontColorFunc(GetFontColor);
+  textDrawer.SetOutlineFontColorFunc(GetOutlineFontColor);
+}
+
+// The cached text is laid out once, then drawn at each pen in turn.
+auto CheckSameAsTextDrawer(const float charSpacing, const std::vector<Point2dInt>& pens) -> void
+{
+  auto textDrawerBuffers = TwoBuffers{};
+  auto textDrawer        = TextDrawer{textDrawerBuffers.draw};
+  SetUpTextDrawer(textDrawer, charSpacing);
+  textDrawer.SetText(TEXT);
+  textDrawer.Prepare();
+  for (const auto& pen : pens)
+  {
+    textDrawer.Draw(pen);
+  }
+
+  auto cachedTextBuffers = TwoBuffers{};
+  auto cachedTextDrawer  = TextDrawer{cachedTextBuffers.draw};
+  SetUpTextDrawer(cachedTextDrawer, charSpacing);
+  auto cachedText = CachedText{cachedTextBuffers.draw, cachedTextDrawer};
+  cachedText.SetParallelRender(false);
+  for (const auto& pen : pens)
+  {
+    cachedText.SetText(TEXT);
+    cachedText.Draw(pen, GetFontColor, GetOutlineFontColor);
+  }
+
+  // Make sure there is some text to compare.
+  REQUIRE(not AreEqual(textDrawerBuffers.buffer1, TwoBuffers{}.buffer1));
+
+  REQUIRE(AreEqual(cachedTextBuffers.buffer1, textDrawerBuffers.buffer1));
+  REQUIRE(AreEqual(cachedTextBuffers.buffer2, textDrawerBuffers.buffer2));
+}
+
+} // namespace
+
+// NOLINTBEGIN(bugprone-chained-comparison): Catch2 needs to fix this.
+TEST_CASE("CachedText Same As TextDrawer")
+{
+  static constexpr auto PEN = Point2dInt{.x = static_cast<int32_t>(TEST_WIDTH / 2),
+                                          .y = static_cast<int32_t>(TEST_HEIGHT / 2)};
+
+  SECTION("No char spacing")
+  {
+    CheckSameAsTextDrawer(0.0F, {PEN});
+  }
+  SECTION("Char spacing")
+  {
+    static constexpr auto CHAR_SPACING = 0.2F;
+    CheckSameAsTextDrawer(CHAR_SPACING, {PEN});
+  }
+  SECTION("Partly off screen")
+  {
+    static constexpr auto OFF_SCREEN_PEN = Point2dInt{.x = 10, .y = 5};
+    CheckSameAsTextDrawer(0.0F, {OFF_SCREEN_PEN});
+  }
+  SECTION("Drawn again at another pen")
+  {
+    static constexpr auto OTHER_PEN = Point2dInt{.x = PEN.x + 7, .y = PEN.y + 31};
+    CheckSameAsTextDrawer(0.0F, {PEN, OTHER_PEN});
+  }
+}
+// NOLINTEND(bugprone-chained-comparison)
+
+} // namespace GOOM::UNIT_TESTS
+
+// NOLINTEND(cert-err58-cpp): Catch2 3.6.0 issue
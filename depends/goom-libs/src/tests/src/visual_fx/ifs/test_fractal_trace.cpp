@@ -0,0 +1,175 @@
+// NOLINTBEGIN(cert-err58-cpp): Catch2 3.6.0 issue
+
+#include <algorithm>
+#include <catch2/catch_message.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+import Goom.Utils.Parallel;
+import Goom.VisualFx.IfsDancersFx.FractalTrace;
+
+namespace GOOM::UNIT_TESTS
+{
+
+using UTILS::Parallel;
+using VISUAL_FX::IFS::FractalTrace;
+
+namespace
+{
+
+struct TestPoint
+{
+  int32_t x;
+  int32_t y;
+  auto operator==(const TestPoint&) const -> bool = default;
+};
+
+// Random contracting rotations from a fixed seed, in fixed point, like the ifs simis.
+class TestSimiTransformer
+{
+public:
+  using Point = TestPoint;
+
+  TestSimiTransformer(uint32_t numSimis, std::mt19937& randGen);
+
+  [[nodiscard]] auto GetNumSimis() const -> uint32_t;
+  [[nodiscard]] auto Transform(uint32_t simiIndex, const TestPoint& point0) const -> TestPoint;
+  [[nodiscard]] static auto AreSimilarPoints(const TestPoint& point1, const TestPoint& point2)
+      -> bool;
+
+  static constexpr auto UNIT_SHIFT = 10;
+  static constexpr auto UNIT       = 1 << UNIT_SHIFT;
+
+private:
+  struct Simi
+  {
+    TestPoint centre;
+    int32_t cosFactor;
+    int32_t sinFactor;
+  };
+  std::vector<Simi> m_simis;
+};
+
+TestSimiTransformer::TestSimiTransformer(const uint32_t numSimis, std::mt19937& randGen)
+{
+  auto centres = std::uniform_int_distribution<int32_t>{-UNIT, UNIT};
+  auto factors = std::uniform_int_distribution<int32_t>{-(UNIT / 2), UNIT / 2};
+  for (auto i = 0U; i < numSimis; ++i)
+  {
+    m_simis.emplace_back(Simi{
+        .centre    = {.x = centres(randGen), .y = centres(randGen)},
+        .cosFactor = factors(randGen),
+        .sinFactor = factors(randGen),
+    });
+  }
+}
+
+auto TestSimiTransformer::GetNumSimis() const -> uint32_t
+{
+  return static_cast<uint32_t>(m_simis.size());
+}
+
+auto TestSimiTransformer::Transform(const uint32_t simiIndex, const TestPoint& point0) const
+    -> TestPoint
+{
+  const auto& simi = m_simis.at(simiIndex);
+  const auto x     = point0.x - simi.centre.x;
+  const auto y     = point0.y - simi.centre.y;
+  return {
+      .x = simi.centre.x + (((x * simi.cosFactor) - (y * simi.sinFactor)) / UNIT),
+      .y = simi.centre.y + (((x * simi.sinFactor) + (y * simi.cosFactor)) / UNIT),
+  };
+}
+
+auto TestSimiTransformer::AreSimilarPoints(const TestPoint& point1, const TestPoint& point2)
+    -> bool
+{
+  static constexpr auto CUTOFF = 16;
+  return (std::abs(point1.x - point2.x) < CUTOFF) or (std::abs(point1.y - point2.y) < CUTOFF);
+}
+
+using Hit = FractalTrace<TestSimiTransformer>::Hit;
+
+// The plain recursive trace, as the ifs used to do it.
+// NOLINTNEXTLINE(misc-no-recursion)
+auto TraceRecursively(const TestSimiTransformer& simiTransformer,
+                      const uint32_t depth,
+                      const TestPoint& point0,
+                      std::vector<Hit>& hits) -> void
+{
+  for (auto i = 0U; i < simiTransformer.GetNumSimis(); ++i)
+  {
+    const auto point = simiTransformer.Transform(i, point0);
+    hits.emplace_back(point, i);
+
+    if (0 == depth)
+    {
+      continue;
+    }
+    if (TestSimiTransformer::AreSimilarPoints(point0, point))
+    {
+      continue;
+    }
+
+    TraceRecursively(simiTransformer, depth - 1, point, hits);
+  }
+}
+
+} // namespace
+
+// NOLINTBEGIN(bugprone-chained-comparison): Catch2 needs to fix this.
+// NOLINTBEGIN(readability-function-cognitive-complexity)
+TEST_CASE("FractalTrace Same As Recursive Trace")
+{
+  static constexpr auto SEED          = 1234U;
+  static constexpr auto NUM_SIMIS     = 4U;
+  static constexpr auto NUM_TOP_LEVEL = 5U;
+
+  auto randGen               = std::mt19937{SEED};
+  const auto simiTransformer = TestSimiTransformer{NUM_SIMIS, randGen};
+
+  auto coords         = std::uniform_int_distribution<int32_t>{-TestSimiTransformer::UNIT,
+                                                       TestSimiTransformer::UNIT};
+  auto topLevelPoints = std::vector<TestPoint>{};
+  for (auto i = 0U; i < NUM_TOP_LEVEL; ++i)
+  {
+    topLevelPoints.emplace_back(TestPoint{.x = coords(randGen), .y = coords(randGen)});
+  }
+
+  const auto isSameHit = [](const Hit& hit1, const Hit& hit2)
+  { return (hit1.point == hit2.point) and (hit1.simiIndex == hit2.simiIndex); };
+
+  // More threads means more of the top levels are expanded into tasks.
+  for (const auto numPoolThreads : {1, 3, 8})
+  {
+    auto parallel     = Parallel{numPoolThreads};
+    auto fractalTrace = FractalTrace<TestSimiTransformer>{parallel};
+
+    for (const auto depth : {0U, 1U, 3U, 6U})
+    {
+      auto expectedHits = std::vector<Hit>{};
+      for (const auto& point : topLevelPoints)
+      {
+        TraceRecursively(simiTransformer, depth, point, expectedHits);
+      }
+
+      fractalTrace.Trace(simiTransformer, topLevelPoints, depth);
+      auto hits = std::vector<Hit>{};
+      fractalTrace.ForEachHit([&hits](const Hit& hit) { hits.emplace_back(hit); });
+
+      UNSCOPED_INFO("numPoolThreads = " << numPoolThreads << ", depth = " << depth);
+      REQUIRE(hits.size() == expectedHits.size());
+      const auto mismatch = std::ranges::mismatch(hits, expectedHits, isSameHit);
+      REQUIRE(mismatch.in1 == hits.end());
+    }
+  }
+}
+// NOLINTEND(readability-function-cognitive-complexity)
+// NOLINTEND(bugprone-chained-comparison)
+
+} // namespace GOOM::UNIT_TESTS
+
+// NOLINTEND(cert-err58-cpp): Catch2 3.6.0 issue
@@ -0,0 +1,148 @@
+// NOLINTBEGIN(cert-err58-cpp): Catch2 3.6.0 issue
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <vector>
+
+import Goom.Draw.DirtyTiles;
+import Goom.Draw.GoomDrawBase;
+import Goom.Utils.Parallel;
+import Goom.VisualFx.ImageFx.TiledChunks;
+import Goom.Lib.GoomTypes;
+import Goom.Lib.Point2d;
+import Goom.Tests.Draw.DrawHelper;
+
+namespace GOOM::UNIT_TESTS
+{
+
+using DRAW::DirtyTiles;
+using DRAW::IGoomDraw;
+using DRAW::MultiplePixels;
+using UTILS::Parallel;
+using VISUAL_FX::IMAGE::TiledChunks;
+
+namespace
+{
+
+constexpr auto NUM_POOL_THREADS = 4;
+constexpr auto TILE_SIZE        = static_cast<int32_t>(DirtyTiles::TILE_SIZE);
+
+// Not square, so a mix up of x and y shows up.
+constexpr auto CHUNK_WIDTH  = 3;
+constexpr auto CHUNK_HEIGHT = 2;
+
+// As for the image fx, chunks are kept out of the last chunk's width and height of the screen.
+constexpr auto DRAW_WIDTH  = static_cast<int32_t>(TEST_WIDTH) - CHUNK_WIDTH;
+constexpr auto DRAW_HEIGHT = static_cast<int32_t>(TEST_HEIGHT) - CHUNK_HEIGHT;
+
+// Overlapping chunks straddling the tile boundaries, the same chunk twice, and chunks partly
+// or wholly off the draw area.
+[[nodiscard]] auto GetFirstChunkPositions() -> std::vector<Point2dInt>
+{
+  return {
+      {.x = TILE_SIZE - 1, .y = TILE_SIZE - 1},
+      {.x = TILE_SIZE - 2, .y = TILE_SIZE},
+      {.x = TILE_SIZE - 1, .y = 10},
+      {.x = 10, .y = TILE_SIZE - 1},
+      {.x = TILE_SIZE - 1, .y = TILE_SIZE - 1},
+      {.x = (2 * TILE_SIZE) - 2, .y = (2 * TILE_SIZE) - 1},
+      {.x = -1, .y = -1},
+      {.x = -2, .y = 20},
+      {.x = DRAW_WIDTH - 2, .y = 30},
+      {.x = 40, .y = DRAW_HEIGHT - 1},
+      {.x = DRAW_WIDTH - 1, .y = DRAW_HEIGHT - 1},
+      {.x = -CHUNK_WIDTH, .y = 50},
+      {.x = DRAW_WIDTH, .y = 50},
+      {.x = (3 * TILE_SIZE) - 1, .y = 60},
+  };
+}
+
+// Drawn after the first chunks, to check the bins are redone.
+[[nodiscard]] auto GetSecondChunkPositions() -> std::vector<Point2dInt>
+{
+  return {
+      {.x = TILE_SIZE - 2, .y = TILE_SIZE - 1},
+      {.x = (2 * TILE_SIZE) - 1, .y = 5},
+      {.x = DRAW_WIDTH - 3, .y = DRAW_HEIGHT - 2},
+  };
+}
+
+[[nodiscard]] auto GetChunkColors(const uint32_t chunkIndex, const Point2dInt& chunkPoint)
+    -> MultiplePixels
+{
+  return GetColors((chunkIndex * static_cast<uint32_t>(CHUNK_WIDTH * CHUNK_HEIGHT)) +
+                   static_cast<uint32_t>((chunkPoint.y * CHUNK_WIDTH) + chunkPoint.x));
+}
+
+auto DrawTiledChunks(TiledChunks& tiledChunks,
+                     IGoomDraw& draw,
+                     const std::vector<Point2dInt>& chunkPositions) -> void
+{
+  tiledChunks.Draw(chunkPositions,
+                   [&draw](const uint32_t chunkIndex,
+                           const Point2dInt& chunkPoint,
+                           const Point2dInt& point)
+                   { draw.DrawPixels(point, GetChunkColors(chunkIndex, chunkPoint)); });
+}
+
+// As the image fx used to draw: each whole chunk, one after the other, clipped to the draw
+// area.
+auto DrawChunksOneByOne(IGoomDraw& draw, const std::vector<Point2dInt>& chunkPositions) -> void
+{
+  for (auto chunkIndex = 0U; chunkIndex < chunkPositions.size(); ++chunkIndex)
+  {
+    const auto& chunkPosition = chunkPositions[chunkIndex];
+    for (auto y = 0; y < CHUNK_HEIGHT; ++y)
+    {
+      for (auto x = 0; x < CHUNK_WIDTH; ++x)
+      {
+        const auto point = Point2dInt{.x = chunkPosition.x + x, .y = chunkPosition.y + y};
+        if ((point.x < 0) or (point.x >= DRAW_WIDTH) or (point.y < 0) or
+            (point.y >= DRAW_HEIGHT))
+        {
+          continue;
+        }
+        draw.DrawPixels(point, GetChunkColors(chunkIndex, {.x = x, .y = y}));
+      }
+    }
+  }
+}
+
+} // namespace
+
+// NOLINTBEGIN(bugprone-chained-comparison): Catch2 needs to fix this.
+TEST_CASE("TiledChunks Same As Drawing Whole Chunks")
+{
+  auto parallel    = Parallel{NUM_POOL_THREADS};
+  auto tiledChunks = TiledChunks{
+      parallel,
+      Dimensions{TEST_WIDTH, TEST_HEIGHT},
+      Dimensions{static_cast<uint32_t>(DRAW_WIDTH), static_cast<uint32_t>(DRAW_HEIGHT)},
+      Dimensions{CHUNK_WIDTH, CHUNK_HEIGHT}
+  };
+  const auto firstChunkPositions  = GetFirstChunkPositions();
+  const auto secondChunkPositions = GetSecondChunkPositions();
+
+  // The subtract blend does not commute, so a pixel blended out of order, twice, or not at
+  // all shows up.
+  auto tiledBuffers = TwoBuffers{};
+  tiledBuffers.draw.SetPixelBlendFunc(SubtractBlend);
+  DrawTiledChunks(tiledChunks, tiledBuffers.draw, firstChunkPositions);
+  DrawTiledChunks(tiledChunks, tiledBuffers.draw, secondChunkPositions);
+
+  auto oneByOneBuffers = TwoBuffers{};
+  oneByOneBuffers.draw.SetPixelBlendFunc(SubtractBlend);
+  DrawChunksOneByOne(oneByOneBuffers.draw, firstChunkPositions);
+  DrawChunksOneByOne(oneByOneBuffers.draw, secondChunkPositions);
+
+  REQUIRE(AreEqual(tiledBuffers.buffer1, oneByOneBuffers.buffer1));
+  REQUIRE(AreEqual(tiledBuffers.buffer2, oneByOneBuffers.buffer2));
+  REQUIRE(not AreEqual(tiledBuffers.buffer1, TwoBuffers{}.buffer1));
+  REQUIRE(tiledBuffers.draw.GetDirtyTiles().GetTileMask() ==
+          oneByOneBuffers.draw.GetDirtyTiles().GetTileMask());
+}
+// NOLINTEND(bugprone-chained-comparison)
+
+} // namespace GOOM::UNIT_TESTS
+
+// NOLINTEND(cert-err58-cpp): Catch2 3.6.0 issue
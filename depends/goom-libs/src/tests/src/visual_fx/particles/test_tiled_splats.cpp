@@ -0,0 +1,172 @@
+// NOLINTBEGIN(cert-err58-cpp): Catch2 3.6.0 issue
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+import Goom.Draw.DirtyTiles;
+import Goom.Draw.GoomDrawBase;
+import Goom.Draw.GoomDrawTo;
+import Goom.Draw.ShaperDrawers.CircleDrawer;
+import Goom.Draw.ShaperDrawers.PixelDrawer;
+import Goom.Utils.Graphics.PixelBlend;
+import Goom.Utils.Parallel;
+import Goom.VisualFx.ParticlesFx.Particles.TiledSplats;
+import Goom.Lib.GoomGraphic;
+import Goom.Lib.Point2d;
+import Goom.Tests.Draw.DrawHelper;
+
+namespace GOOM::UNIT_TESTS
+{
+
+using DRAW::DirtyTiles;
+using DRAW::GoomDrawTo;
+using DRAW::MultiplePixels;
+using DRAW::TransparentBgnd;
+using DRAW::SHAPE_DRAWERS::BasicCircleDrawer;
+using DRAW::SHAPE_DRAWERS::BasicPixelDrawer;
+using UTILS::Parallel;
+using UTILS::GRAPHICS::PixelBlendRowType;
+using VISUAL_FX::PARTICLES::TiledSplats;
+
+namespace
+{
+
+constexpr auto NUM_POOL_THREADS = 4;
+constexpr auto TILE_SIZE        = static_cast<int32_t>(DirtyTiles::TILE_SIZE);
+constexpr auto SCREEN_WIDTH     = static_cast<int32_t>(TEST_WIDTH);
+
+struct SplatPoint
+{
+  Point2dInt centre;
+  bool isCircle;
+};
+
+[[nodiscard]] auto GetSplats(const std::vector<SplatPoint>& splatPoints)
+    -> std::vector<TiledSplats::Splat>
+{
+  auto splats = std::vector<TiledSplats::Splat>{};
+  for (const auto& splatPoint : splatPoints)
+  {
+    splats.emplace_back(TiledSplats::Splat{
+        .centre   = splatPoint.centre,
+        .color    = GetColors(static_cast<uint32_t>(splats.size())).color1,
+        .isCircle = splatPoint.isCircle,
+    });
+  }
+  return splats;
+}
+
+// Overlapping circles and pixels around a corner where four tiles meet, the same circle twice,
+// circles straddling a tile boundary in x or y, and one touching the right edge of the screen.
+[[nodiscard]] auto GetFirstSplats() -> std::vector<TiledSplats::Splat>
+{
+  return GetSplats({
+      {.centre = {.x = TILE_SIZE - 2, .y = TILE_SIZE - 2}, .isCircle = true},
+      {.centre = {.x = TILE_SIZE + 1, .y = TILE_SIZE - 1}, .isCircle = true},
+      {.centre = {.x = TILE_SIZE, .y = TILE_SIZE}, .isCircle = false},
+      {.centre = {.x = TILE_SIZE - 1, .y = TILE_SIZE}, .isCircle = false},
+      {.centre = {.x = TILE_SIZE + 2, .y = TILE_SIZE - 4}, .isCircle = true},
+      {.centre = {.x = TILE_SIZE - 2, .y = TILE_SIZE - 2}, .isCircle = true},
+      {.centre = {.x = TILE_SIZE, .y = TILE_SIZE}, .isCircle = false},
+      {.centre = {.x = (3 * TILE_SIZE) - 2, .y = 100}, .isCircle = true},
+      {.centre = {.x = TILE_SIZE, .y = (2 * TILE_SIZE) - 1}, .isCircle = true},
+      {.centre = {.x = SCREEN_WIDTH - 5, .y = TILE_SIZE - 1}, .isCircle = true},
+  });
+}
+
+// Drawn after the first splats, to check the bins are redone.
+[[nodiscard]] auto GetSecondSplats() -> std::vector<TiledSplats::Splat>
+{
+  return GetSplats({
+      {.centre = {.x = TILE_SIZE - 4, .y = TILE_SIZE + 2}, .isCircle = true},
+      {.centre = {.x = TILE_SIZE, .y = TILE_SIZE}, .isCircle = false},
+      {.centre = {.x = (2 * TILE_SIZE) - 1, .y = 10}, .isCircle = true},
+  });
+}
+
+template<class DrawT>
+auto DrawSplatsOneByOne(DrawT& draw, const std::span<const TiledSplats::Splat> splats) -> void
+{
+  auto circleDrawer = BasicCircleDrawer<DrawT>{draw};
+  auto pixelDrawer  = BasicPixelDrawer<DrawT>{draw};
+
+  for (const auto& splat : splats)
+  {
+    const auto colors = MultiplePixels{.color1 = splat.color, .color2 = splat.color};
+    if (splat.isCircle)
+    {
+      circleDrawer.DrawFilledCircle(splat.centre, TiledSplats::CIRCLE_RADIUS, colors);
+    }
+    else
+    {
+      pixelDrawer.DrawPixelsClipped(splat.centre, colors);
+    }
+  }
+}
+
+auto CheckSameBuffers(const TwoBuffers& tiledBuffers, const TwoBuffers& oneByOneBuffers) -> void
+{
+  REQUIRE(AreEqual(tiledBuffers.buffer1, oneByOneBuffers.buffer1));
+  REQUIRE(AreEqual(tiledBuffers.buffer2, oneByOneBuffers.buffer2));
+  REQUIRE(not AreEqual(tiledBuffers.buffer1, TwoBuffers{}.buffer1));
+  REQUIRE(tiledBuffers.draw.GetDirtyTiles().GetTileMask() ==
+          oneByOneBuffers.draw.GetDirtyTiles().GetTileMask());
+}
+
+} // namespace
+
+// NOLINTBEGIN(bugprone-chained-comparison): Catch2 needs to fix this.
+TEST_CASE("TiledSplats Same As Drawing One By One - Goom Draw")
+{
+  auto parallel    = Parallel{NUM_POOL_THREADS};
+  auto tiledSplats = TiledSplats{
+      parallel, Dimensions{TEST_WIDTH, TEST_HEIGHT}
+  };
+  const auto firstSplats  = GetFirstSplats();
+  const auto secondSplats = GetSecondSplats();
+
+  // The subtract blend does not commute, so a pixel blended out of order, twice, or not at
+  // all shows up.
+  auto tiledBuffers = TwoBuffers{};
+  tiledBuffers.draw.SetPixelBlendFunc(SubtractBlend);
+  tiledSplats.Draw(tiledBuffers.draw, firstSplats);
+  tiledSplats.Draw(tiledBuffers.draw, secondSplats);
+
+  auto oneByOneBuffers = TwoBuffers{};
+  oneByOneBuffers.draw.SetPixelBlendFunc(SubtractBlend);
+  DrawSplatsOneByOne(oneByOneBuffers.draw, firstSplats);
+  DrawSplatsOneByOne(oneByOneBuffers.draw, secondSplats);
+
+  CheckSameBuffers(tiledBuffers, oneByOneBuffers);
+}
+
+TEST_CASE("TiledSplats Same As Drawing One By One - GoomDrawTo")
+{
+  using DrawTo = GoomDrawTo<2U, PixelBlendRowType::COLOR_ALPHA, TransparentBgnd::USE_FGND>;
+
+  auto parallel    = Parallel{NUM_POOL_THREADS};
+  auto tiledSplats = TiledSplats{
+      parallel, Dimensions{TEST_WIDTH, TEST_HEIGHT}
+  };
+  const auto firstSplats  = GetFirstSplats();
+  const auto secondSplats = GetSecondSplats();
+
+  auto tiledBuffers = TwoBuffers{};
+  auto tiledDraw    = DrawTo{tiledBuffers.draw};
+  tiledSplats.Draw(tiledDraw, firstSplats);
+  tiledSplats.Draw(tiledDraw, secondSplats);
+
+  auto oneByOneBuffers = TwoBuffers{};
+  auto oneByOneDraw    = DrawTo{oneByOneBuffers.draw};
+  DrawSplatsOneByOne(oneByOneDraw, firstSplats);
+  DrawSplatsOneByOne(oneByOneDraw, secondSplats);
+
+  CheckSameBuffers(tiledBuffers, oneByOneBuffers);
+}
+// NOLINTEND(bugprone-chained-comparison)
+
+} // namespace GOOM::UNIT_TESTS
+
+// NOLINTEND(cert-err58-cpp): Catch2 3.6.0 issue
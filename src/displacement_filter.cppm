@@ -137,6 +137,7 @@ private:
 
   size_t m_currentPboIndex = 0U;
   std::vector<FrameData> m_frameDataArray;
+  uint32_t m_filterDestPosMapGeneration = 0U;
   auto InitFrameDataArrayPointers(std::vector<FrameData>& frameDataArray) noexcept -> void;
   auto InitFrameDataArray() noexcept -> void;
   auto InitFrameDataArrayToGl() -> void;
@@ -1004,10 +1005,15 @@ auto DisplacementFilter::GetLumAverage() const -> float
 auto DisplacementFilter::InitFrameDataArrayPointers(std::vector<FrameData>& frameDataArray) noexcept
     -> void
 {
+  // The dest pos buffers are persistently mapped until the scene is destroyed, and are only
+  // read when 'filterDestPosNeedsUpdating' is set, so goom can produce straight into them.
+  ++m_filterDestPosMapGeneration;
+
   for (auto i = 0U; i < NUM_PBOS; ++i)
   {
     frameDataArray.at(i).filterPosArrays.filterDestPos =
         m_glFilterPosBuffers.filterDestPosTexture.GetMappedBuffer(i);
+    frameDataArray.at(i).filterPosArrays.filterDestPosMapGeneration = m_filterDestPosMapGeneration;
 
     frameDataArray.at(i).imageArrays.mainImagePixelBuffer.SetPixelBuffer(
         m_glImageBuffers.mainImageTexture.GetMappedBuffer(i),